@@ -1,19 +1,25 @@
 ///
 /// \file   angle.hpp
-/// \brief  x@ƌʓx@\NX`wb_
+/// \brief  度数法と弧度法を表すクラス定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/7/27
-///             - wb_ǉ
-///             - Degrees `
-///             - Radians `
+///             - ヘッダ追加
+///             - Degrees 定義
+///             - Radians 定義
+///         - 2026/10/19
+///             - MSVC 以外のコンパイラでは M_PI を <cmath> から取得するよう変更
 ///
 #ifndef INCLUDED_EGEG_MLIB_ANGLE_HEADER_
 #define INCLUDED_EGEG_MLIB_ANGLE_HEADER_
 
+#ifdef _MSC_VER
 #include <corecrt_math_defines.h>
+#else
+#include <cmath>
+#endif
 #include <cfloat>
 
 namespace easy_engine {
@@ -1,4 +1,4 @@
-// 쐬 : 
+// 作成者 : 板場
 /******************************************************************************
 
     include
@@ -6,6 +6,7 @@
 ******************************************************************************/
 #include "blend_state.hpp"
 #include "easy_engine.hpp"
+#include "graphic_manager.hpp"
 #include "utility_function.hpp"
 
 
@@ -1,22 +1,22 @@
 ///
 /// \file   blend_state.hpp
-/// \brief  uhԒ`NX`wb_
+/// \brief  ブレンド状態定義クラス定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/9/4
-///             - wb_ǉ
-///             - BlendState `
-///             - BlendDesc `
-///                 - BlendCoefficient `
-///                 - BlendOperation `
-///                 - OpaqueBlend `
-///                 - AlphaBlend `
-///                 - AddtiveBlend `
-///                 - NonPremultipliedBlend `
+///             - ヘッダ追加
+///             - BlendState 定義
+///             - BlendDesc 定義
+///                 - BlendCoefficient 定義
+///                 - BlendOperation 定義
+///                 - OpaqueBlend 定義
+///                 - AlphaBlend 定義
+///                 - AddtiveBlend 定義
+///                 - NonPremultipliedBlend 定義
 ///         - 2020/9/8
-///             - vZbg֐ɒu
+///             - プリセットを関数に置き換えた
 ///
 #ifndef INCLUDED_EGEG_GLIB_BLEND_STATE_HEADER_
 #define INCLUDED_EGEG_GLIB_BLEND_STATE_HEADER_
@@ -34,8 +34,8 @@ namespace g_lib {
     BlendDesc
 
 ******************************************************************************/
-/// ͂ɑ΂W
-// ڍ : https://docs.microsoft.com/en-us/windows/win32/api/D3D11/ne-d3d11-d3d11_blend
+/// 入力に対する係数
+// 詳細 : https://docs.microsoft.com/en-us/windows/win32/api/D3D11/ne-d3d11-d3d11_blend
 enum class BlendCoefficient {
     kZero,
     kOne,
@@ -55,8 +55,8 @@ enum class BlendCoefficient {
     kSrc1Alpha,
     kInvSrc1Alpha	
 };
-/// uhZ
-// ڍ : https://docs.microsoft.com/en-us/windows/win32/api/d3d11/ne-d3d11-d3d11_blend_op
+/// ブレンド演算
+// 詳細 : https://docs.microsoft.com/en-us/windows/win32/api/d3d11/ne-d3d11-d3d11_blend_op
 enum class BlendOperation {
     kAdd,
     kSubtract,
@@ -66,14 +66,14 @@ enum class BlendOperation {
 };
 
 struct BlendDesc {
-    bool enable;                      ///< true:uh@false : uhȂ
-    BlendCoefficient src_coef;        ///< \[XFɑ΂W
-    BlendCoefficient dest_coef;       ///< ݐ̐Fɑ΂W
-    BlendOperation operation;         ///< uhZ
-    BlendCoefficient src_alpha_coef;  ///< \[Xlɑ΂W
-    BlendCoefficient dest_alpha_coef; ///< ݐ惿lɑ΂W
-    BlendOperation alpha_operation;   ///< uhZ
-    ColorFlag write_color_mask;       ///< ސF(rbgtO)
+    bool enable;                      ///< true:ブレンドあり　false : ブレンドなし
+    BlendCoefficient src_coef;        ///< ソース色に対する係数
+    BlendCoefficient dest_coef;       ///< 書き込み先の色に対する係数
+    BlendOperation operation;         ///< ブレンド演算
+    BlendCoefficient src_alpha_coef;  ///< ソースα値に対する係数
+    BlendCoefficient dest_alpha_coef; ///< 書き込み先α値に対する係数
+    BlendOperation alpha_operation;   ///< αブレンド演算
+    ColorFlag write_color_mask;       ///< 書き込む色(ビットフラグ)
 };
 
 
@@ -83,44 +83,44 @@ struct BlendDesc {
 
 ******************************************************************************/
 ///
-/// \brief  uhԒ`NX
+/// \brief  ブレンド状態定義クラス
 ///
 class BlendState {
 public :
     ///
-    /// \brief  ftHg̃RXgN^
+    /// \brief  デフォルトのコンストラクタ
     ///
-    ///         Ԃ̒`܂B
+    ///         状態の定義を持ちません。
     ///
     BlendState() = default;
 
     ///
-    /// \brief  uhXe[g̍쐬𔺂RXgN^
+    /// \brief  ブレンドステートの作成を伴うコンストラクタ
     ///
-    ///         2ɂ͏o̓^[Qbg̃uhԂݒł܂B
-    ///         ̃^[Qbgݒ肷ꍇstd::array<c>Ɋi[ēnĂB
+    ///         第2引数には出力ターゲット毎のブレンド状態を設定できます。
+    ///         複数のターゲットを設定する場合はstd::array<…>に格納して渡してください。
     ///
-    /// \param[in] Desc : uhԒ`\
-    /// \param[in] AlphaToCaverageEnable : At@gDJ@bWwtO@true:L@false:
+    /// \param[in] Desc : ブレンド状態定義構造体
+    /// \param[in] AlphaToCaverageEnable : アルファトゥカヴァレッジ指定フラグ　true:有効　false:無効
     ///
-    /// \attention ̃^[Qbgݒ肷ہAݒłő吔8łB
+    /// \attention 複数のターゲットを設定する際、設定できる最大数は8です。
     ///
     BlendState(const BlendDesc& Desc, bool AlphaToCaverageEnable=false);
     BlendState(const std::array<BlendDesc, 8U>& Descs, bool AlphaToCaverageEnable=false);
 
     ///
-    /// \brief  LȃuhԒ`IuWFNgǂ
+    /// \brief  有効なブレンド状態定義オブジェクトかどうか判定
     ///
-    ///         true  : L
-    ///         false : 
+    ///         true  : 有効
+    ///         false : 無効
     ///
-    /// \return 茋
+    /// \return 判定結果
     ///
     bool isValid() const noexcept { return state_; }
     operator bool() const noexcept { return isValid(); }
 
 
-    /// uhXe[gIuWFNg擾
+    /// ブレンドステートオブジェクトを取得
     ID3D11BlendState* state() const noexcept { return state_.Get(); }
 private :
     Microsoft::WRL::ComPtr<ID3D11BlendState> state_;
@@ -132,7 +132,7 @@ private :
     blend presets
 
 ******************************************************************************/
-// Ql : https://github.com/microsoft/DirectXTK
+// 参考 : https://github.com/microsoft/DirectXTK
 //        https://github.com/microsoft/DirectXTK/blob/master/Src/CommonStates.cpp
   namespace blend_impl {
       inline BlendState createBlend(const bool E, const BlendCoefficient Src, const BlendCoefficient Dest, const BlendOperation Op) {
@@ -148,13 +148,13 @@ private :
   }
 
 namespace blend_presets {
-/// uh
+/// ブレンド無し
 inline BlendState opaque() { return blend_impl::createBlend(false, BlendCoefficient::kOne, BlendCoefficient::kZero, BlendOperation::kAdd); }
-/// uh
+/// αブレンド
 inline BlendState alpha() { return blend_impl::createBlend(true, BlendCoefficient::kOne, BlendCoefficient::kInvSrcAlpha, BlendOperation::kAdd); }
-/// Z
+/// 加算合成
 inline BlendState addtive() { return blend_impl::createBlend(true, BlendCoefficient::kSrcAlpha, BlendCoefficient::kOne, BlendOperation::kAdd); }
-/// OZ
+/// 事前乗算無し
 inline BlendState nonPremultiplied() { return blend_impl::createBlend(true, BlendCoefficient::kSrcAlpha, BlendCoefficient::kInvSrcAlpha, BlendOperation::kAdd); }
 } // namespace blend_preset
 
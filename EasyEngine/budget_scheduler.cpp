@@ -0,0 +1,167 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include "budget_scheduler.hpp"
+#include <algorithm>
+#include "egeg_state.hpp"
+#include "profiler.hpp"
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace egeg_ns = easy_engine;
+namespace {
+    using ClockUsedDuration = egeg_ns::ClockUsed::duration;
+
+    // ClockUsed::time_point との演算用
+    ClockUsedDuration toDuration(const egeg_ns::Time Time) noexcept {
+        return std::chrono::duration_cast<ClockUsedDuration>(egeg_ns::Nanoseconds{Time.nanoseconds()});
+    }
+} // unnamed namespace
+
+
+/******************************************************************************
+
+    BudgetScheduler::
+
+******************************************************************************/
+egeg_ns::BudgetScheduler::BudgetScheduler() {
+    setBudget(ratio_, min_slice_);
+}
+
+egeg_ns::BudgetScheduler::~BudgetScheduler() = default;
+
+egeg_ns::BudgetedTaskInfo egeg_ns::BudgetScheduler::registerTask(Task Function, const uint32_t Priority, const char* Name) {
+    if(!Function) return BudgetedTaskInfo{};
+
+    if(++last_id_ == 0U) ++last_id_; // 0 は解除済みを表すため使用しない
+    const uint32_t id = last_id_;
+    Entry entry{std::move(Function), Name, Priority, id, false, BudgetedTaskStats{}};
+    entry.stats.pending = true; // 最初のフレームで必ず呼び出す
+    if(running_) added_.push_back(std::move(entry));
+    else         insert(std::move(entry));
+    return BudgetedTaskInfo{this, id};
+}
+
+void egeg_ns::BudgetScheduler::setBudget(const double Ratio, const Time MinSlice) noexcept {
+    ratio_ = std::clamp(Ratio, 0.0, 1.0);
+    budget_ = Nanoseconds{static_cast<int64_t>(kTPF<std::nano> * ratio_)};
+    min_slice_ = std::max(MinSlice, Time{});
+}
+
+void egeg_ns::BudgetScheduler::run() {
+    // 実行中の状態の設定と、終了時の登録、解除の反映(例外送出時も反映する)
+    struct Scope { BudgetScheduler& self; ~Scope() { self.running_ = false; self.apply(); } } scope{*this};
+    running_ = true;
+
+    const auto start = ClockUsed::now();
+    const auto deadline = start + toDuration(budget_);
+    auto now = start;
+    last_starved_ = 0U;
+    for(auto& task : tasks_) task.called = false;
+
+  // 飢餓閾値に達したタスクを優先度に関わらず先に呼び出す
+  //  飢餓状態の長い順(同じ場合は優先度順)に、残りの予算を残りのタスク数で等分して渡す
+  //  等分した時間が最小の割り当て時間に満たない場合は最小の割り当て時間を渡し、
+  //  呼び出せなかったタスクは、次のフレームで最も飢餓状態の長いタスクとして先に呼び出す
+    starved_.clear();
+    for(auto& task : tasks_) {
+        if(task.id == 0U || !task.stats.pending || task.stats.starved_frames < starvation_limit_) continue;
+        starved_.push_back(&task);
+    }
+    std::stable_sort(starved_.begin(), starved_.end(),
+        [](const Entry* L, const Entry* R) { return L->stats.starved_frames > R->stats.starved_frames; });
+    const auto min_slice = toDuration(min_slice_);
+    for(size_t i=0; i<starved_.size(); ++i) {
+        Entry& task = *starved_[i];
+        if(task.id == 0U) continue; // 先に呼び出したタスクにより解除された
+        const auto share = std::max((deadline-now) / static_cast<ClockUsedDuration::rep>(starved_.size()-i), min_slice);
+        task.called = invoke(task, now, std::min(now+share, deadline));
+    }
+
+  // 残りのタスクを優先度順に呼び出す(予算の残り全てを渡す)
+    for(auto& task : tasks_) {
+        if(task.id == 0U || task.called) continue;
+        task.called = invoke(task, now, deadline);
+    }
+    last_used_ = now - start;
+
+  // 呼び出されなかったタスクの飢餓状態を更新
+    for(auto& task : tasks_) {
+        BudgetedTaskStats& stats = task.stats;
+        if(task.called || task.id == 0U || !stats.pending) continue;
+        ++stats.starved_frames;
+        ++stats.total_starved_frames;
+        stats.max_starved_frames = std::max(stats.max_starved_frames, stats.starved_frames);
+        ++last_starved_;
+    }
+}
+
+const egeg_ns::BudgetedTaskStats* egeg_ns::BudgetScheduler::stats(const BudgetedTaskInfo& Info) const noexcept {
+    if(Info.scheduler_ != this) return nullptr;
+    for(const auto& task : tasks_) if(task.id == Info.id_) return &task.stats;
+    for(const auto& task : added_) if(task.id == Info.id_) return &task.stats;
+    return nullptr;
+}
+
+void egeg_ns::BudgetScheduler::unregisterTask(const uint32_t ID) noexcept {
+    for(auto& task : tasks_) {
+        if(task.id != ID) continue;
+        task.id = 0U; // 呼び出し中である可能性があるため、取り除くのは実行の終了後
+        ++num_removed_;
+        if(!running_) apply();
+        return;
+    }
+    for(auto itr = added_.begin(); itr != added_.end(); ++itr) {
+        if(itr->id == ID) { added_.erase(itr); return; }
+    }
+}
+
+// 予算が残っていればタスクを呼び出す
+//  Now は呼び出し後の時刻に更新する
+bool egeg_ns::BudgetScheduler::invoke(Entry& Task, ClockUsed::time_point& Now, const ClockUsed::time_point Deadline) {
+    if(Deadline - Now < toDuration(min_slice_)) return false;
+
+    EGEG_PROFILE_SCOPE(Task.name);
+    BudgetedTaskStats& stats = Task.stats;
+    ++stats.runs;
+    stats.starved_frames = 0U;
+    struct Record { // 使用した時間の記録(例外送出時も記録する)
+        BudgetedTaskStats& stats;
+        ClockUsed::time_point& now;
+        const ClockUsed::time_point start;
+        ~Record() {
+            now = ClockUsed::now();
+            stats.last_used = now - start;
+            stats.total_used += stats.last_used;
+        }
+    } record{stats, Now, Now};
+    stats.pending = Task.task(TaskBudget{record.start, Time{Deadline-record.start}});
+    return true;
+}
+
+// 優先度順の位置(同じ優先度の末尾)に挿入
+void egeg_ns::BudgetScheduler::insert(Entry&& Task) {
+    const auto pos = std::upper_bound(tasks_.begin(), tasks_.end(), Task.priority,
+                                      [](const uint32_t P, const Entry& E) { return P < E.priority; });
+    tasks_.insert(pos, std::move(Task));
+}
+
+// 実行中の登録、解除を反映
+void egeg_ns::BudgetScheduler::apply() {
+    if(num_removed_ > 0U) {
+        tasks_.erase(std::remove_if(tasks_.begin(), tasks_.end(), [](const Entry& E) { return E.id == 0U; }),
+                     tasks_.end());
+        num_removed_ = 0U;
+    }
+    for(auto& task : added_) insert(std::move(task));
+    added_.clear();
+}
+
+// EOF
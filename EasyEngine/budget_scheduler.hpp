@@ -0,0 +1,269 @@
+///
+/// \file   budget_scheduler.hpp
+/// \brief  時間予算付きタスクのスケジューラ定義ヘッダ
+///
+/// \author 板場
+///
+/// \par    履歴
+///         - 2026/10/19
+///             - ヘッダ追加
+///             - TaskBudget 定義
+///             - BudgetedTaskStats 定義
+///             - BudgetedTaskInfo 定義
+///             - BudgetScheduler 定義
+///
+#ifndef INCLUDED_EGEG_BUDGET_SCHEDULER_HEADER_
+#define INCLUDED_EGEG_BUDGET_SCHEDULER_HEADER_
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "inplace_function.hpp"
+#include "noncopyable.hpp"
+#include "time.hpp"
+
+namespace easy_engine {
+
+class BudgetScheduler;
+
+/******************************************************************************
+
+    TaskBudget
+
+******************************************************************************/
+///
+/// \brief  タスクに割り当てた時間
+///
+///         予算付きタスクの呼び出しに渡されます。
+///         タスクは作業の区切り毎に exhausted() を確認し、true であれば中断して戻ってください。
+///
+class TaskBudget {
+public :
+    TaskBudget(const ClockUsed::time_point Start, const Time Budget) noexcept :
+        start_{Start},
+        deadline_{Start + std::chrono::duration_cast<ClockUsed::duration>(Nanoseconds{Budget.nanoseconds()})} {}
+
+    /// 割り当てられた時間
+    Time budget() const noexcept { return deadline_ - start_; }
+    /// 呼び出されてからの経過時間
+    Time elapsed() const noexcept { return ClockUsed::now() - start_; }
+    /// 残り時間(超過している場合は Time{})
+    Time remaining() const noexcept {
+        const auto now = ClockUsed::now();
+        return now < deadline_ ? Time{deadline_-now} : Time{};
+    }
+    /// 割り当てられた時間を使い切ったかどうか
+    bool exhausted() const noexcept { return ClockUsed::now() >= deadline_; }
+
+private :
+    ClockUsed::time_point start_;
+    ClockUsed::time_point deadline_;
+};
+
+
+/******************************************************************************
+
+    BudgetedTaskStats
+
+******************************************************************************/
+///
+/// \brief  予算付きタスクの統計
+///
+///         飢餓は、未完了の作業が残っている(前回 true を返した)のに、
+///         予算が尽きて呼び出されなかったフレームです。
+///
+struct BudgetedTaskStats {
+    uint64_t runs = 0U;                 ///< 呼び出した回数
+    uint32_t starved_frames = 0U;       ///< 連続して飢餓状態のフレーム数(呼び出されると0に戻る)
+    uint32_t max_starved_frames = 0U;   ///< 連続して飢餓状態だったフレーム数の最大
+    uint64_t total_starved_frames = 0U; ///< 飢餓状態だったフレーム数の合計
+    Time last_used;                     ///< 直前の呼び出しで使用した時間
+    Time total_used;                    ///< 使用した時間の合計
+    bool pending = false;               ///< 未完了の作業が残っているか(最後の呼び出しの戻り値)
+};
+
+
+/******************************************************************************
+
+    BudgetedTaskInfo
+
+******************************************************************************/
+///
+/// \brief  予算付きタスクの登録情報
+///
+///         BudgetScheduler::registerTask の戻り値です。
+///         破棄されると登録を解除します。
+///
+/// \attention 登録したスケジューラより先に破棄してください。
+///
+class BudgetedTaskInfo final : t_lib::Noncopyable<BudgetedTaskInfo> {
+public :
+    friend BudgetScheduler;
+
+    BudgetedTaskInfo() noexcept = default;
+    BudgetedTaskInfo(BudgetedTaskInfo&& Right) noexcept :
+        scheduler_{std::exchange(Right.scheduler_, nullptr)}, id_{Right.id_} {}
+    BudgetedTaskInfo& operator=(BudgetedTaskInfo&& Right) noexcept {
+        if(this != &Right) {
+            exitFromScheduler();
+            scheduler_ = std::exchange(Right.scheduler_, nullptr);
+            id_ = Right.id_;
+        }
+        return *this;
+    }
+    ~BudgetedTaskInfo() { exitFromScheduler(); }
+
+    /// 登録を解除
+    void exitFromScheduler() noexcept;
+    /// 登録されているかどうか
+    bool isRegistered() const noexcept { return scheduler_ != nullptr; }
+
+private :
+    BudgetedTaskInfo(BudgetScheduler* Scheduler, const uint32_t ID) noexcept : scheduler_{Scheduler}, id_{ID} {}
+
+    BudgetScheduler* scheduler_ = nullptr;
+    uint32_t id_ = 0U;
+};
+
+
+/******************************************************************************
+
+    BudgetScheduler
+
+******************************************************************************/
+///
+/// \brief  時間予算付きタスクのスケジューラ
+///
+///         経路探索や AI の計画、LOD の再計算等、1回に必要な処理時間に上限の無いタスクを、
+///         1フレーム当たりの予算(1フレームの時間 kTPF の一定割合)の範囲で少しずつ実行します。
+///
+///         タスクは bool(const TaskBudget&) の関数で、残り時間を確認しながら作業を進め、
+///         予算を使い切ったら途中で戻ります。(続きは次のフレームの呼び出しで再開します。)
+///         戻り値は、未完了の作業が残っているかどうかです。
+///         false を返したタスクも、新しい作業を受け付けるため、予算が残っていれば毎フレーム呼び出します。
+///         使用例.)
+///             bool PathFinder::step(const TaskBudget& Budget) {
+///                 while(!requests_.empty() && !Budget.exhausted()) {
+///                     if(search_.expand(kNodesPerStep)) finish(requests_.pop());
+///                 }
+///                 return !requests_.empty();
+///             }
+///             info_ = scheduler.registerTask([this](const TaskBudget& B) { return step(B); }, 3U);
+///
+///         タスクは優先度の小さい順に呼び出し、各タスクには予算の残り全てを渡します。
+///         予算が尽きた時点で、以降のタスクはそのフレームでは呼び出しません。
+///         作業が残っているのに呼び出されなかったタスクは飢餓状態として数え、
+///         飢餓状態が一定フレーム数(飢餓閾値)続いたタスクは、次のフレームで優先度に関わらず先に呼び出します。
+///         飢餓閾値に達したタスクは飢餓状態の長い順に呼び出し、それぞれに残りの予算を等分した時間
+///         (最小の割り当て時間 MinSlice 以上)を渡します。
+///         そのため、各タスクが渡された時間を守り、同時に飢餓閾値に達するタスクが 予算/MinSlice 個以下であれば、
+///         作業の残っている全てのタスクは、少なくとも 飢餓閾値+1 フレームに1回呼び出されます。
+///         (飢餓状態のフレーム数は飢餓閾値を超えません。)
+///         予算/MinSlice 個を超える場合も、呼び出せなかったタスクは次のフレームで先に呼び出すため、
+///         全てのタスクが順番に呼び出されます。
+///
+///         呼び出し中の登録と解除(自身を含む)は、そのフレームの実行の終了後に反映します。
+///
+/// \attention スレッドセーフではありません。同じスレッドから操作してください。
+///
+class BudgetScheduler final : t_lib::Noncopyable<BudgetScheduler> {
+public :
+    friend BudgetedTaskInfo;
+
+    using Task = t_lib::InplaceFunction<bool(const TaskBudget&)>;
+
+    BudgetScheduler();
+    ~BudgetScheduler();
+
+    ///
+    /// \brief  タスクを登録
+    ///
+    /// \param[in] Function : 登録するタスク 未完了の作業が残っていれば true を返す
+    /// \param[in] Priority : 優先度(小さいほど先に呼び出す)
+    /// \param[in] Name     : タスク名(プロファイラ用 登録中は有効な文字列)
+    ///
+    /// \return タスクの登録情報
+    ///
+    [[nodiscard]] BudgetedTaskInfo registerTask(Task Function, uint32_t Priority=5U, const char* Name="BudgetedTask");
+
+    ///
+    /// \brief  1フレーム当たりの予算の設定
+    ///
+    ///         予算は 1フレームの時間(kTPF) * Ratio です。
+    ///         残りの予算が MinSlice 未満になった時点で、そのフレームの呼び出しを終了します。
+    ///
+    /// \param[in] Ratio    : 1フレームの時間に対する割合 [0, 1]
+    /// \param[in] MinSlice : 1回の呼び出しに割り当てる最小の時間
+    ///
+    void setBudget(double Ratio, Time MinSlice=Microseconds{50}) noexcept;
+    /// 1フレーム当たりの予算
+    Time budget() const noexcept { return budget_; }
+    double budgetRatio() const noexcept { return ratio_; }
+
+    ///
+    /// \brief  飢餓閾値の設定
+    ///
+    ///         0 の場合、作業の残っている全てのタスクに、毎フレーム予算を等分して渡します。
+    ///         (作業の残っているタスクが 予算/MinSlice 個以下であれば、毎フレーム全てのタスクを呼び出します。)
+    ///
+    /// \param[in] Frames : 優先して呼び出すまでの、連続した飢餓状態のフレーム数
+    ///
+    void setStarvationLimit(const uint32_t Frames) noexcept { starvation_limit_ = Frames; }
+    uint32_t starvationLimit() const noexcept { return starvation_limit_; }
+
+    ///
+    /// \brief  1フレーム分実行
+    ///
+    ///         予算の範囲でタスクを呼び出します。
+    ///
+    /// \throw  タスクから送出された例外(以降のタスクはそのフレームでは呼び出さない)
+    ///
+    void run();
+
+    /// タスクの統計(登録されていない場合は nullptr)
+    const BudgetedTaskStats* stats(const BudgetedTaskInfo& Info) const noexcept;
+    /// 直前のフレームで使用した時間(予算を超過する場合があります)
+    Time lastUsed() const noexcept { return last_used_; }
+    /// 直前のフレームで飢餓状態だったタスクの数
+    uint32_t lastStarved() const noexcept { return last_starved_; }
+    /// 登録されているタスクの数
+    size_t size() const noexcept { return tasks_.size() - num_removed_ + added_.size(); }
+
+private :
+    struct Entry {
+        Task task;
+        const char* name;
+        uint32_t priority;
+        uint32_t id;        // 0 で解除済み
+        bool called;        // 今回のフレームで呼び出したか
+        BudgetedTaskStats stats;
+    };
+    void unregisterTask(uint32_t ID) noexcept;
+    bool invoke(Entry& Task, ClockUsed::time_point& Now, ClockUsed::time_point Deadline);
+    void insert(Entry&& Task);
+    void apply();
+
+    std::vector<Entry> tasks_;      // 優先度順
+    std::vector<Entry> added_;      // 実行中に登録されたタスク
+    std::vector<Entry*> starved_;   // 実行中の、飢餓閾値に達したタスク(飢餓状態の長い順)
+    size_t num_removed_ = 0U;
+    uint32_t last_id_ = 0U;
+    bool running_ = false;
+
+    double ratio_ = 0.1;
+    Time budget_;
+    Time min_slice_ = Microseconds{50};
+    uint32_t starvation_limit_ = 4U;
+    Time last_used_{};
+    uint32_t last_starved_ = 0U;
+};
+
+inline void BudgetedTaskInfo::exitFromScheduler() noexcept {
+    if(!scheduler_) return;
+    scheduler_->unregisterTask(id_);
+    scheduler_ = nullptr;
+}
+
+} // namespace easy_engine
+#endif // !INCLUDED_EGEG_BUDGET_SCHEDULER_HEADER_
+// EOF
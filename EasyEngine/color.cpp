@@ -0,0 +1,340 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include "color.hpp"
+#include <cmath>
+#include <algorithm>
+#include <emmintrin.h>
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace c_ns = easy_engine::g_lib;
+namespace {
+    using easy_engine::m_lib::Vector4D;
+
+    // 8bit sRGB -> 線形 の参照表
+    struct SRGBTable {
+        SRGBTable() noexcept;
+        float to_linear[256];
+    };
+    const SRGBTable& srgbTable() noexcept;
+
+    template <class SrcTy, class DstTy, class FTy>
+    void batch4(const SrcTy*, DstTy*, size_t, FTy&&);
+    void unpack(__m128i, __m128 (&)[4]) noexcept;
+    __m128i pack(const __m128 (&)[4]) noexcept;
+    __m128 toLinear(__m128) noexcept;
+    __m128 toSRGB(__m128) noexcept;
+    __m128i floatToHalf(__m128) noexcept;
+    __m128 halfToFloat(__m128i) noexcept;
+
+    const __m128 kMaskRGB = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+    const __m128 kAlphaOne = _mm_set_ps(1.0F, 0.0F, 0.0F, 0.0F);
+} // unnamed namespace
+
+
+/******************************************************************************
+
+    g_lib::
+
+******************************************************************************/
+void c_ns::convertToFloat(const ColorUint* Src, m_lib::Vector4D* Dst, const size_t Count) noexcept {
+    const __m128 scale = _mm_set1_ps(1.0F/255.0F);
+    batch4(Src, Dst, Count, [&](const ColorUint* S, Vector4D* D) {
+        __m128 px[4];
+        unpack(_mm_loadu_si128(reinterpret_cast<const __m128i*>(S)), px);
+        for(int i=0; i<4; ++i) _mm_storeu_ps(D[i].v, _mm_mul_ps(px[i], scale));
+    });
+}
+
+void c_ns::convertToUint(const m_lib::Vector4D* Src, ColorUint* Dst, const size_t Count) noexcept {
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0F);
+    const __m128 scale = _mm_set1_ps(255.0F);
+    batch4(Src, Dst, Count, [&](const Vector4D* S, ColorUint* D) {
+        __m128 px[4];
+        for(int i=0; i<4; ++i) px[i] = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(S[i].v), zero), one), scale);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(D), pack(px));
+    });
+}
+
+void c_ns::convertSRGBToLinear(const ColorUint* Src, m_lib::Vector4D* Dst, const size_t Count) noexcept {
+    // 参照表の引き当てはSIMD化できないため、色毎に引いて4要素をまとめて書き込む
+    const float* table = srgbTable().to_linear;
+    for(size_t i=0; i<Count; ++i) {
+        const ColorUint c = Src[i];
+        _mm_storeu_ps(Dst[i].v, _mm_set_ps(
+            (c>>24) * (1.0F/255.0F), table[(c>>16)&0xFFU], table[(c>>8)&0xFFU], table[c&0xFFU]));
+    }
+}
+
+void c_ns::convertLinearToSRGB(const m_lib::Vector4D* Src, ColorUint* Dst, const size_t Count) noexcept {
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0F);
+    const __m128 scale = _mm_set1_ps(255.0F);
+    batch4(Src, Dst, Count, [&](const Vector4D* S, ColorUint* D) {
+        __m128 px[4];
+        for(int i=0; i<4; ++i) {
+            const __m128 c = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(S[i].v), zero), one);
+            const __m128 srgb = toSRGB(c);
+            px[i] = _mm_mul_ps(_mm_or_ps(_mm_and_ps(kMaskRGB, srgb), _mm_andnot_ps(kMaskRGB, c)), scale);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(D), pack(px));
+    });
+}
+
+void c_ns::srgbToLinear(m_lib::Vector4D* Colors, const size_t Count) noexcept {
+    for(size_t i=0; i<Count; ++i) {
+        const __m128 c = _mm_loadu_ps(Colors[i].v);
+        _mm_storeu_ps(Colors[i].v, _mm_or_ps(_mm_and_ps(kMaskRGB, toLinear(c)), _mm_andnot_ps(kMaskRGB, c)));
+    }
+}
+
+void c_ns::linearToSRGB(m_lib::Vector4D* Colors, const size_t Count) noexcept {
+    for(size_t i=0; i<Count; ++i) {
+        const __m128 c = _mm_loadu_ps(Colors[i].v);
+        _mm_storeu_ps(Colors[i].v, _mm_or_ps(_mm_and_ps(kMaskRGB, toSRGB(c)), _mm_andnot_ps(kMaskRGB, c)));
+    }
+}
+
+void c_ns::premultiplyAlpha(ColorUint* Colors, const size_t Count) noexcept {
+    // 16bitに展開して c*a/255 を整数で計算する(四捨五入)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i mask_rgb = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+    const __m128i alpha_255 = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+    const __m128i bias = _mm_set1_epi16(128);
+    auto multiply = [&](const __m128i Px) {
+        __m128i a = _mm_shufflelo_epi16(Px, _MM_SHUFFLE(3, 3, 3, 3));
+        a = _mm_shufflehi_epi16(a, _MM_SHUFFLE(3, 3, 3, 3));
+        a = _mm_or_si128(_mm_and_si128(a, mask_rgb), alpha_255);
+        __m128i t = _mm_add_epi16(_mm_mullo_epi16(Px, a), bias);
+        return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+    };
+    batch4(Colors, Colors, Count, [&](const ColorUint* S, ColorUint* D) {
+        const __m128i px = _mm_loadu_si128(reinterpret_cast<const __m128i*>(S));
+        const __m128i lo = multiply(_mm_unpacklo_epi8(px, zero));
+        const __m128i hi = multiply(_mm_unpackhi_epi8(px, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(D), _mm_packus_epi16(lo, hi));
+    });
+}
+
+void c_ns::premultiplyAlpha(m_lib::Vector4D* Colors, const size_t Count) noexcept {
+    for(size_t i=0; i<Count; ++i) {
+        const __m128 c = _mm_loadu_ps(Colors[i].v);
+        const __m128 a = _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 3, 3));
+        _mm_storeu_ps(Colors[i].v, _mm_mul_ps(c, _mm_or_ps(_mm_and_ps(kMaskRGB, a), kAlphaOne)));
+    }
+}
+
+void c_ns::unpremultiplyAlpha(ColorUint* Colors, const size_t Count) noexcept {
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 scale = _mm_set1_ps(255.0F);
+    batch4(Colors, Colors, Count, [&](const ColorUint* S, ColorUint* D) {
+        __m128 px[4];
+        unpack(_mm_loadu_si128(reinterpret_cast<const __m128i*>(S)), px);
+        for(auto& c : px) {
+            const __m128 a = _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 3, 3));
+            const __m128 valid = _mm_cmpneq_ps(a, zero);
+            const __m128 inv = _mm_and_ps(_mm_div_ps(scale, _mm_or_ps(a, _mm_andnot_ps(valid, scale))), valid);
+            c = _mm_mul_ps(c, _mm_or_ps(_mm_and_ps(kMaskRGB, inv), kAlphaOne));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(D), pack(px));
+    });
+}
+
+void c_ns::unpremultiplyAlpha(m_lib::Vector4D* Colors, const size_t Count) noexcept {
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0F);
+    for(size_t i=0; i<Count; ++i) {
+        const __m128 c = _mm_loadu_ps(Colors[i].v);
+        const __m128 a = _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 3, 3));
+        const __m128 valid = _mm_cmpneq_ps(a, zero);
+        const __m128 inv = _mm_and_ps(_mm_div_ps(one, _mm_or_ps(_mm_and_ps(valid, a), _mm_andnot_ps(valid, one))), valid);
+        _mm_storeu_ps(Colors[i].v, _mm_mul_ps(c, _mm_or_ps(_mm_and_ps(kMaskRGB, inv), kAlphaOne)));
+    }
+}
+
+void c_ns::swapRedBlue(const ColorUint* Src, ColorUint* Dst, const size_t Count) noexcept {
+    const __m128i mask_ga = _mm_set1_epi32(0xFF00FF00);
+    const __m128i mask_byte = _mm_set1_epi32(0x000000FF);
+    batch4(Src, Dst, Count, [&](const ColorUint* S, ColorUint* D) {
+        const __m128i px = _mm_loadu_si128(reinterpret_cast<const __m128i*>(S));
+        const __m128i rb_low = _mm_and_si128(_mm_srli_epi32(px, 16), mask_byte);
+        const __m128i rb_high = _mm_slli_epi32(_mm_and_si128(px, mask_byte), 16);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(D),
+            _mm_or_si128(_mm_and_si128(px, mask_ga), _mm_or_si128(rb_low, rb_high)));
+    });
+}
+
+void c_ns::convertToHalf(const m_lib::Vector4D* Src, std::uint16_t* Dst, const size_t Count) noexcept {
+    // 2ピクセルずつ 32bit*8 を 16bit*8 に詰める
+    // packs_epi32 は符号付き飽和のため、符号拡張してから詰める
+    size_t i = 0;
+    for(; i+2U<=Count; i+=2U) {
+        __m128i h0 = floatToHalf(_mm_loadu_ps(Src[i].v));
+        __m128i h1 = floatToHalf(_mm_loadu_ps(Src[i+1U].v));
+        h0 = _mm_srai_epi32(_mm_slli_epi32(h0, 16), 16);
+        h1 = _mm_srai_epi32(_mm_slli_epi32(h1, 16), 16);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(Dst+i*4U), _mm_packs_epi32(h0, h1));
+    }
+    if(i < Count) {
+        alignas(16) std::uint32_t h[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(h), floatToHalf(_mm_loadu_ps(Src[i].v)));
+        for(size_t k=0; k<4U; ++k) Dst[i*4U+k] = static_cast<std::uint16_t>(h[k]);
+    }
+}
+
+void c_ns::convertFromHalf(const std::uint16_t* Src, m_lib::Vector4D* Dst, const size_t Count) noexcept {
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for(; i+2U<=Count; i+=2U) {
+        const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Src+i*4U));
+        _mm_storeu_ps(Dst[i].v, halfToFloat(_mm_unpacklo_epi16(h, zero)));
+        _mm_storeu_ps(Dst[i+1U].v, halfToFloat(_mm_unpackhi_epi16(h, zero)));
+    }
+    if(i < Count) {
+        const __m128i h = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(Src+i*4U));
+        _mm_storeu_ps(Dst[i].v, halfToFloat(_mm_unpacklo_epi16(h, zero)));
+    }
+}
+
+
+/******************************************************************************
+
+    others
+
+******************************************************************************/
+namespace {
+SRGBTable::SRGBTable() noexcept {
+    for(int i=0; i<256; ++i) {
+        const float s = i / 255.0F;
+        to_linear[i] = s <= 0.04045F ? s/12.92F : std::pow((s+0.055F)/1.055F, 2.4F);
+    }
+}
+
+const SRGBTable& srgbTable() noexcept {
+    static const SRGBTable table;
+    return table;
+}
+
+// 4ピクセル単位で処理する
+//  端数は一時領域に複写して処理する
+template <class SrcTy, class DstTy, class FTy>
+void batch4(const SrcTy* Src, DstTy* Dst, const size_t Count, FTy&& Func) {
+    size_t i = 0;
+    for(; i+4U<=Count; i+=4U)
+        Func(Src+i, Dst+i);
+    if(i == Count) return;
+
+    SrcTy src[4]{};
+    DstTy dst[4]{};
+    std::copy(Src+i, Src+Count, src);
+    Func(src, dst);
+    std::copy(dst, dst+(Count-i), Dst+i);
+}
+
+// RGBA8*4 -> float*4*4 (0～255)
+void unpack(const __m128i Px, __m128 (&Dst)[4]) noexcept {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lo = _mm_unpacklo_epi8(Px, zero);
+    const __m128i hi = _mm_unpackhi_epi8(Px, zero);
+    Dst[0] = _mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero));
+    Dst[1] = _mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero));
+    Dst[2] = _mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero));
+    Dst[3] = _mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero));
+}
+
+// float*4*4 (0～255) -> RGBA8*4 (最近接偶数丸め、飽和)
+__m128i pack(const __m128 (&Src)[4]) noexcept {
+    const __m128i lo = _mm_packs_epi32(_mm_cvtps_epi32(Src[0]), _mm_cvtps_epi32(Src[1]));
+    const __m128i hi = _mm_packs_epi32(_mm_cvtps_epi32(Src[2]), _mm_cvtps_epi32(Src[3]));
+    return _mm_packus_epi16(lo, hi);
+}
+
+// sRGB -> 線形
+//  0.04045 以下は線形区間、それ以外は5次多項式で近似(最小二乗)
+__m128 toLinear(const __m128 C) noexcept {
+    const __m128 linear = _mm_mul_ps(C, _mm_set1_ps(1.0F/12.92F));
+    __m128 poly = _mm_set1_ps(0.0544705165F);
+    poly = _mm_add_ps(_mm_mul_ps(poly, C), _mm_set1_ps(-0.225698644F));
+    poly = _mm_add_ps(_mm_mul_ps(poly, C), _mm_set1_ps(0.595002564F));
+    poly = _mm_add_ps(_mm_mul_ps(poly, C), _mm_set1_ps(0.546478957F));
+    poly = _mm_add_ps(_mm_mul_ps(poly, C), _mm_set1_ps(0.0286830476F));
+    poly = _mm_add_ps(_mm_mul_ps(poly, C), _mm_set1_ps(0.00109595264F));
+    const __m128 is_linear = _mm_cmple_ps(C, _mm_set1_ps(0.04045F));
+    return _mm_or_ps(_mm_and_ps(is_linear, linear), _mm_andnot_ps(is_linear, poly));
+}
+
+// 線形 -> sRGB
+//  0.0031308 以下は線形区間、それ以外は x^(1/2), x^(1/4), x^(1/8), x の線形結合で近似(最小二乗)
+__m128 toSRGB(const __m128 C) noexcept {
+    const __m128 linear = _mm_mul_ps(C, _mm_set1_ps(12.92F));
+    const __m128 s1 = _mm_sqrt_ps(C);
+    const __m128 s2 = _mm_sqrt_ps(s1);
+    const __m128 s3 = _mm_sqrt_ps(s2);
+    __m128 poly = _mm_mul_ps(s1, _mm_set1_ps(0.644538753F));
+    poly = _mm_add_ps(poly, _mm_mul_ps(s2, _mm_set1_ps(0.709956299F)));
+    poly = _mm_add_ps(poly, _mm_mul_ps(s3, _mm_set1_ps(-0.336052322F)));
+    poly = _mm_add_ps(poly, _mm_mul_ps(C, _mm_set1_ps(-0.0184726895F)));
+    const __m128 is_linear = _mm_cmple_ps(C, _mm_set1_ps(0.0031308F));
+    return _mm_or_ps(_mm_and_ps(is_linear, linear), _mm_andnot_ps(is_linear, poly));
+}
+
+// float*4 -> half*4(各32bitの下位16bit 最近接偶数丸め)
+//  NaN は qNaN、範囲外は無限大、非正規化数にも対応
+__m128i floatToHalf(const __m128 F) noexcept {
+    const __m128i bits = _mm_castps_si128(F);
+    const __m128i sign = _mm_and_si128(bits, _mm_set1_epi32(static_cast<int>(0x80000000U)));
+    const __m128i abs = _mm_xor_si128(bits, sign);
+
+    // 無限大、NaN
+    const __m128i is_inf_nan = _mm_cmpgt_epi32(abs, _mm_set1_epi32(((127+16)<<23) - 1));
+    const __m128i is_nan = _mm_cmpgt_epi32(abs, _mm_set1_epi32(255<<23));
+    const __m128i inf_nan = _mm_or_si128(_mm_set1_epi32(0x7C00), _mm_and_si128(is_nan, _mm_set1_epi32(0x0200)));
+
+    // 非正規化数 : 加算で仮数部を丸め位置へずらす
+    const __m128 denorm_magic = _mm_castsi128_ps(_mm_set1_epi32(((127-15)+(23-10)+1)<<23));
+    const __m128i denorm = _mm_sub_epi32(
+        _mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(abs), denorm_magic)), _mm_castps_si128(denorm_magic));
+    const __m128i is_denorm = _mm_cmplt_epi32(abs, _mm_set1_epi32(113<<23));
+
+    // 正規化数 : 指数の再バイアスと最近接偶数丸め
+    const __m128i odd = _mm_and_si128(_mm_srli_epi32(abs, 13), _mm_set1_epi32(1));
+    __m128i normal = _mm_add_epi32(abs, _mm_set1_epi32(((15-127)<<23) + 0xFFF));
+    normal = _mm_srli_epi32(_mm_add_epi32(normal, odd), 13);
+
+    __m128i result = _mm_or_si128(_mm_and_si128(is_denorm, denorm), _mm_andnot_si128(is_denorm, normal));
+    result = _mm_or_si128(_mm_and_si128(is_inf_nan, inf_nan), _mm_andnot_si128(is_inf_nan, result));
+    return _mm_or_si128(result, _mm_srli_epi32(sign, 16));
+}
+
+// half*4(各32bitの下位16bit) -> float*4
+__m128 halfToFloat(const __m128i H) noexcept {
+    const __m128i shifted_exp = _mm_set1_epi32(0x7C00<<13);
+    __m128i bits = _mm_slli_epi32(_mm_and_si128(H, _mm_set1_epi32(0x7FFF)), 13);
+    const __m128i exp = _mm_and_si128(bits, shifted_exp);
+    bits = _mm_add_epi32(bits, _mm_set1_epi32((127-15)<<23));
+
+    // 無限大、NaN : 指数を最大に
+    const __m128i is_inf_nan = _mm_cmpeq_epi32(exp, shifted_exp);
+    bits = _mm_add_epi32(bits, _mm_and_si128(is_inf_nan, _mm_set1_epi32((128-16)<<23)));
+
+    // 0、非正規化数 : 浮動小数点の減算で正規化
+    const __m128i is_denorm = _mm_cmpeq_epi32(exp, _mm_setzero_si128());
+    const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32(113<<23));
+    const __m128 renorm = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(bits, _mm_set1_epi32(1<<23))), magic);
+    __m128 result = _mm_or_ps(_mm_and_ps(_mm_castsi128_ps(is_denorm), renorm),
+                              _mm_andnot_ps(_mm_castsi128_ps(is_denorm), _mm_castsi128_ps(bits)));
+
+    const __m128i sign = _mm_slli_epi32(_mm_and_si128(H, _mm_set1_epi32(0x8000)), 16);
+    return _mm_or_ps(result, _mm_castsi128_ps(sign));
+}
+} // unnamed namespace
+// EOF
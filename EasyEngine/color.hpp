@@ -1,21 +1,25 @@
 ///
 /// \file   color.hpp
-/// \brief  FɊւ錾A`wb_
+/// \brief  色に関する宣言、定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/9/4
-///             - wb_ǉ
-///             - ColorMask `
-///                 - 萔`
-///             - ColorBitMask `
-///                 - 萔`
+///             - ヘッダ追加
+///             - ColorMask 定義
+///                 - 定数定義
+///             - ColorBitMask 定義
+///                 - 定数定義
+///         - 2026/10/19
+///             - 色変換関数(一括変換) 定義
 ///
 #ifndef INCLUDED_EGEG_GLIB_COLOR_HEADER_
 #define INCLUDED_EGEG_GLIB_COLOR_HEADER_
 
 #include <cstdint>
+#include <cstddef>
+#include "mvector.hpp"
 
 namespace easy_engine {
 namespace g_lib {
@@ -30,15 +34,15 @@ using ColorUint = std::uint32_t;
 
 ******************************************************************************/
 ///
-/// \brief  J[}XN
+/// \brief  カラーマスク
 ///
-///         FF256iK(0~255)ŕ\܂B
-///         ev[gp[^ŗLȐFRGBAʂɎw肵܂B
+///         色を一色256段階(0~255)で表現します。
+///         非テンプレートパラメータで有効な色をRGBA別に指定します。
 ///
-/// \tparam Red   : ԐF(0:@0:L)
-/// \tparam Green : ΐF(0:@0:L)
-/// \tparam Blue  : F(0:@0:L)
-/// \tparam Alpha : (0:@0:L)
+/// \tparam Red   : 赤色(0:無効　非0:有効)
+/// \tparam Green : 緑色(0:無効　非0:有効)
+/// \tparam Blue  : 青色(0:無効　非0:有効)
+/// \tparam Alpha : 透過(0:無効　非0:有効)
 ///
 template <unsigned Red, unsigned Green, unsigned Blue, unsigned Alpha>
 class ColorMask {
@@ -66,10 +70,10 @@ constexpr ColorUint kMaskRGBA  = kColorMask<1,1,1,1>;
 
 ******************************************************************************/
 ///
-/// \brief  ColorUintfR[_[
+/// \brief  ColorUintデコーダー
 ///
-///         RGBA\ColorUint̊głłB
-///         e֐𗘗pĊeF̒l擾ł܂B
+///         RGBAを表すColorUintの拡張版です。
+///         各関数を利用して各色の値を取得できます。
 ///
 class Color {
 public :
@@ -96,15 +100,15 @@ constexpr Color kBlack = Color{0x000000ff};
 
 ******************************************************************************/
 ///
-/// \brief  J[rbg}XN
+/// \brief  カラービットマスク
 ///
-///         F𒼐ڕ\܂B
-///         ev[gp[^ŗLȐFRGBAʂɎw肵܂B
+///         色を直接表現しません。
+///         非テンプレートパラメータで有効な色をRGBA別に指定します。
 ///
-/// \tparam Red   : ԐF(0:@0:L)
-/// \tparam Green : ΐF(0:@0:L)
-/// \tparam Blue  : F(0:@0:L)
-/// \tparam Alpha : (0:@0:L)
+/// \tparam Red   : 赤色(0:無効　非0:有効)
+/// \tparam Green : 緑色(0:無効　非0:有効)
+/// \tparam Blue  : 青色(0:無効　非0:有効)
+/// \tparam Alpha : 透過(0:無効　非0:有効)
 ///
 template <unsigned Red, unsigned Green, unsigned Blue, unsigned Alpha>
 class ColorBitMask {
@@ -125,6 +129,53 @@ constexpr ColorFlag kBitMaskBlue  = kColorBitMask<0,0,1,0>;
 constexpr ColorFlag kBitMaskAlpha = kColorBitMask<0,0,0,1>;
 constexpr ColorFlag kBitMaskRGBA  = kColorBitMask<1,1,1,1>;
 
+
+/******************************************************************************
+
+    color conversion
+
+******************************************************************************/
+///
+/// \brief  色の一括変換
+///
+///         ピクセル配列をSSE2でまとめて変換します。
+///         ColorUint は下位バイトから R, G, B, A の順、
+///         Vector4D は x, y, z, w が R, G, B, A に対応します。
+///         特記の無い関数は、Src と Dst に同じ配列を渡すことはできません。
+///
+/// \par    sRGBの変換について
+///         - 8bit の sRGB から浮動小数点へは参照表で変換します。(誤差無し)
+///         - 浮動小数点同士、浮動小数点から 8bit への変換は多項式近似で変換します。(絶対誤差 6e-5 程度)
+///         - アルファは変換しません。
+///
+/// \param[in]  Src   : 変換元ピクセル配列
+/// \param[out] Dst   : 変換先ピクセル配列
+/// \param[in]  Count : ピクセル数
+///
+void convertToFloat(const ColorUint* Src, m_lib::Vector4D* Dst, size_t Count) noexcept;
+/// [0, 1]に飽和して 8bit に変換(四捨五入)
+void convertToUint(const m_lib::Vector4D* Src, ColorUint* Dst, size_t Count) noexcept;
+/// 8bit の sRGB を線形の浮動小数点に変換
+void convertSRGBToLinear(const ColorUint* Src, m_lib::Vector4D* Dst, size_t Count) noexcept;
+/// 線形の浮動小数点を 8bit の sRGB に変換
+void convertLinearToSRGB(const m_lib::Vector4D* Src, ColorUint* Dst, size_t Count) noexcept;
+/// sRGB を線形に変換(配列を直接書き換える)
+void srgbToLinear(m_lib::Vector4D* Colors, size_t Count) noexcept;
+/// 線形を sRGB に変換(配列を直接書き換える)
+void linearToSRGB(m_lib::Vector4D* Colors, size_t Count) noexcept;
+/// アルファ乗算済みに変換(配列を直接書き換える)
+void premultiplyAlpha(ColorUint* Colors, size_t Count) noexcept;
+void premultiplyAlpha(m_lib::Vector4D* Colors, size_t Count) noexcept;
+/// アルファ乗算済みから元に戻す(アルファが0のピクセルは0になる 配列を直接書き換える)
+void unpremultiplyAlpha(ColorUint* Colors, size_t Count) noexcept;
+void unpremultiplyAlpha(m_lib::Vector4D* Colors, size_t Count) noexcept;
+/// RとBを入れ替え(BGRA <-> RGBA Src と Dst に同じ配列を渡せる)
+void swapRedBlue(const ColorUint* Src, ColorUint* Dst, size_t Count) noexcept;
+/// 半精度浮動小数点(RGBA16F)に変換(Dst の要素数は Count*4 最近接偶数丸め)
+void convertToHalf(const m_lib::Vector4D* Src, std::uint16_t* Dst, size_t Count) noexcept;
+/// 半精度浮動小数点(RGBA16F)から変換(Src の要素数は Count*4)
+void convertFromHalf(const std::uint16_t* Src, m_lib::Vector4D* Dst, size_t Count) noexcept;
+
 } // namespace g_lib
 } // namespace easy_engine
 #endif // !INCLUDED_EGEG_GLIB_COLOR_HEADER_
@@ -1,14 +1,14 @@
 ///
 /// \file   constant_buffer.hpp
-/// \brief  萔obt@`wb_
+/// \brief  定数バッファ定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/8/28
-///             - wb_ǉ
-///             - ConstantBufferData `
-///             - ConstantBuffer<c> `
+///             - ヘッダ追加
+///             - ConstantBufferData 定義
+///             - ConstantBuffer<…> 定義
 ///
 #ifndef INCLUDED_EGEG_GLIB_CONSTANT_BUFFER_HEADER_
 #define INCLUDED_EGEG_GLIB_CONSTANT_BUFFER_HEADER_
@@ -19,7 +19,7 @@
 namespace easy_engine {
 namespace g_lib {
 
-class DrawContext;  ///< `ReLXgO錾@zQƉ
+class DrawContext;  ///< 描画コンテキスト前方宣言　※循環参照回避
 
 /******************************************************************************
 
@@ -27,27 +27,27 @@ class DrawContext;  ///< 
 
 ******************************************************************************/
 ///
-/// \brief  ConstantBuffer<> ev[go
+/// \brief  ConstantBuffer<> 非テンプレート部抽出
 ///
-///         قȂ^ێConstantBuffer<>vector̃ReiŊǗۂɎgpł܂B
-///         ̃NXCX^X邱Ƃ͂ł܂B
-///         萔obt@\^ConstantBuffer<>łB
+///         異なる型を保持するConstantBuffer<>をvector等のコンテナで管理する際に使用できます。
+///         このクラスをインスタンス化することはできません。
+///         定数バッファを表す型はConstantBuffer<>です。
 ///
 class ConstantBufferData {
 public :
     ///
-    /// \brief  LȒ萔obt@ǂ
+    /// \brief  有効な定数バッファかどうか判定
     ///
-    ///         true  : L
-    ///         false : 
+    ///         true  : 有効
+    ///         false : 無効
     ///
-    /// \return 茋
+    /// \return 判定結果
     ///
     bool isValid() const noexcept { return cbuf_; }
     operator bool() const noexcept { return isValid(); }
 
 
-    /// obt@IuWFNg擾
+    /// バッファオブジェクトを取得
     ID3D11Buffer* buffer() const noexcept { return cbuf_.Get(); }
 protected :
     ConstantBufferData(UINT DataSize, const D3D11_SUBRESOURCE_DATA* InitialData);
@@ -62,41 +62,41 @@ private:
 
 ******************************************************************************/
 ///
-/// \brief  萔obt@
+/// \brief  定数バッファ
 ///
-/// \tparam DataTy : obt@ɕێf[^^
+/// \tparam DataTy : バッファに保持するデータ型
 ///
 template <class DataTy>
 class ConstantBuffer : public ConstantBufferData {
 public :
     ///
-    /// \brief  ftHgRXgN^
+    /// \brief  デフォルトコンストラクタ
     ///
-    ///         f[^Ȃobt@쐬Aێ܂B
+    ///         初期データを持たないバッファを作成し、保持します。
     ///
     ConstantBuffer() : ConstantBufferData{sizeof(DataTy), nullptr} {}
 
     ///
-    /// \brief  f[^^RXgN^
+    /// \brief  初期データを与えるコンストラクタ
     ///
-    ///         ̃f[^obt@쐬Aێ܂B
+    ///         引数のデータを持つバッファを作成し、保持します。
     ///
-    /// \param[in] InitialData : obt@̏f[^
+    /// \param[in] InitialData : バッファの初期データ
     ///
     ConstantBuffer(const DataTy& InitialData) :
       ConstantBufferData{sizeof(DataTy), &D3D11_SUBRESOURCE_DATA{&InitialData, 0U, 0U}} {}
 
     ///
-    /// \brief  obt@̃f[^
+    /// \brief  バッファのデータを書き換える
     ///
-    ///         ߂lɏ̌ʂi[܂B
-    ///         true  : 
-    ///         false : s
+    ///         戻り値に書き換えの結果を格納します。
+    ///         true  : 成功
+    ///         false : 失敗
     ///
-    /// \param[in] Data    : ύX̃f[^
-    /// \param[in] Context : ύXsReLXg
+    /// \param[in] Data    : 変更後のデータ
+    /// \param[in] Context : 変更を行うコンテキスト
     ///
-    /// \return 
+    /// \return 書き換え結果
     ///
     bool setData(const DataTy& Data, const DrawContext& Context) {
         return update(&Data, sizeof(DataTy), Context);
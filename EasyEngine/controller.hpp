@@ -1,16 +1,16 @@
 ///
 /// \file   controller.hpp
-/// \brief  Rg[[`wb_
+/// \brief  コントローラー定義ヘッダ
 ///
-///         Rg[[͑\IuWFNgƓ̓foCẌˑ֌WzړIŐ݌v܂B
-///         TOIɁARg[[͓̓L[Ə̃}bsOs܂B
+///         コントローラーは操作可能オブジェクトと入力デバイスの依存関係を吸収する目的で設計されます。
+///         概念的に、コントローラーは入力キーと処理のマッピングを行います。
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/8/6
-///             - wb_ǉ
-///             - Controller `
+///             - ヘッダ追加
+///             - Controller 定義
 ///
 #ifndef INCLUDED_EGEG_ILIB_CONTROLLER_HEADER_
 #define INCLUDED_EGEG_ILIB_CONTROLLER_HEADER_
@@ -32,14 +32,14 @@ namespace i_lib {
 
 ******************************************************************************/
 ///
-/// \brief  Rg[[
+/// \brief  コントローラー基底
 ///
-///         efoCXɑΉhNXŁA͂ɑΉ֐o^鏈ĂB
-///         Rg[[̓foCXł͂܂B
-///         Ӑ}ȂRs[ɂs邽߁AftHgŃRs[֎~Ă܂B
-///         hNXŁARs[T|[gꍇ́AIɃRs[Z`ĂB
+///         各種デバイスに対応した派生クラスで、入力に対応した関数を登録する処理を実装してください。
+///         コントローラーはデバイスではありません。
+///         意図しないコピーによる不具合を避けるため、デフォルトでコピーを禁止しています。
+///         派生クラスで、コピーをサポートする場合は、明示的にコピー演算を定義してください。
 ///
-/// \tparam TargetTy : Ώۂ̃IuWFNg^
+/// \tparam TargetTy : 操作対象のオブジェクト型
 ///
 template <class TargetTy>
 class Controller : t_lib::Noncopyable<Controller<TargetTy>> {
@@ -50,24 +50,24 @@ public :
     virtual ~Controller() = default;
 
     ///
-    /// \brief  ̊֐Ăяoꂽ_̓͏Ԃŏs
+    /// \brief  この関数が呼び出された時点の入力状態で処理を行う
     ///
     virtual void run() = 0;
 
     ///
-    /// \brief  ΏۂZbg
+    /// \brief  操作対象をセット
     ///
-    ///         ftHgł́AΏۂ܂B
+    ///         デフォルトでは、操作対象を解除します。
     ///
-    /// \param[in] Target : Zbg鑀Ώ
+    /// \param[in] Target : セットする操作対象
     ///
     void resetTarget(TargetType* Target=nullptr) noexcept { target_ = Target; }
     ///
-    /// \brief  Ώۂ̃AhX擾
+    /// \brief  操作対象のアドレスを取得
     ///
-    ///         nullptrԋpꂽꍇAΏۂȂƂ\܂B
+    ///         nullptrが返却された場合、操作対象がいないことを表します。
     ///
-    /// \return Ώۂ̃AhX
+    /// \return 操作対象のアドレス
     ///
     const TargetType* getTarget() const noexcept { return target_; }
 
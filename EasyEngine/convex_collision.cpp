@@ -0,0 +1,494 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include "convex_collision.hpp"
+#include <cmath>
+#include <algorithm>
+#include "egeg_math.hpp"
+#include "parallel_algorithm.hpp"
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace cc_ns = easy_engine::p_lib;
+namespace {
+    using easy_engine::m_lib::Vector3D;
+    using easy_engine::m_lib::Matrix3x4;
+
+    constexpr std::uint32_t kMaxGjkIterations = 64U;
+    constexpr std::uint32_t kMaxEpaIterations = 64U;
+    constexpr size_t kMaxEpaVertices = 64U;
+    constexpr size_t kMaxEpaFaces = 128U;
+    constexpr size_t kMaxEpaEdges = 64U;
+    constexpr float kGjkTolerance = 1.0e-6F;      // 収束判定の相対許容誤差
+    constexpr float kOverlapEpsilon = 1.0e-10F;   // 芯の交差とみなす距離の二乗
+    constexpr float kEpaTolerance = 1.0e-4F;      // EPAの収束判定許容誤差
+    constexpr size_t kPairsPerChunk = 64U;        // 並列判定での分割の最小単位(ペア数)
+
+    // 単体の頂点
+    struct SimplexVertex {
+        Vector3D a;         // 形状A上のサポート点(ワールド)
+        Vector3D b;         // 形状B上のサポート点(ワールド)
+        Vector3D w;         // ミンコフスキー差上の点(a - b)
+        Vector3D local_a;   // aのローカル座標(キャッシュ用)
+        Vector3D local_b;   // bのローカル座標(キャッシュ用)
+    };
+
+    struct Simplex {
+        SimplexVertex v[4];
+        std::uint32_t count;
+    };
+
+    // 判定対象の形状と変換
+    struct Body {
+        const cc_ns::ConvexShape& shape;
+        const Matrix3x4& transform;
+    };
+
+    Vector3D transformPoint(const Matrix3x4&, const Vector3D&) noexcept;
+    Vector3D inverseRotate(const Matrix3x4&, const Vector3D&) noexcept;
+    SimplexVertex makeVertex(const Body&, const Body&, const Vector3D&, const Vector3D&) noexcept;
+    SimplexVertex support(const Body&, const Body&, const Vector3D&, bool) noexcept;
+    bool solveSimplex(Simplex&, Vector3D&, float(&)[4]) noexcept;
+    bool buildTetrahedron(const Body&, const Body&, Simplex&) noexcept;
+    bool epa(const Body&, const Body&, const Simplex&, cc_ns::ContactResult&) noexcept;
+    float lengthSq(const Vector3D& V) noexcept { return easy_engine::m_lib::dot(V, V); }
+} // unnamed namespace
+
+
+/******************************************************************************
+
+    p_lib::
+
+******************************************************************************/
+cc_ns::ContactResult cc_ns::detectContact(const ConvexShape& ShapeA, const m_lib::Matrix3x4& TransformA,
+                                          const ConvexShape& ShapeB, const m_lib::Matrix3x4& TransformB,
+                                          GjkCache* Cache) noexcept {
+    const Body body_a{ShapeA, TransformA};
+    const Body body_b{ShapeB, TransformB};
+
+    ContactResult result{};
+    Simplex simplex{};
+
+  // 単体の初期化
+    if(Cache && Cache->count) { // 前フレームの単体から再開
+        simplex.count = Cache->count;
+        for(std::uint32_t i=0; i<simplex.count; ++i)
+            simplex.v[i] = makeVertex(body_a, body_b, Cache->local_a[i], Cache->local_b[i]);
+    }
+    else {
+        const Vector3D center_diff{TransformA._03-TransformB._03, TransformA._13-TransformB._13, TransformA._23-TransformB._23};
+        simplex.v[0] = support(body_a, body_b,
+            lengthSq(center_diff)>kOverlapEpsilon ? center_diff*-1.0F : Vector3D{1.0F, 0.0F, 0.0F}, false);
+        simplex.count = 1U;
+    }
+
+  // GJK
+    Vector3D v{};
+    float lambda[4]{};
+    bool overlap = false;
+    while(result.gjk_iterations < kMaxGjkIterations) {
+        ++result.gjk_iterations;
+        if(solveSimplex(simplex, v, lambda)) { overlap = true; break; }
+
+        const float vv = lengthSq(v);
+        if(vv < kOverlapEpsilon) { overlap = true; break; }
+
+        const SimplexVertex new_vertex = support(body_a, body_b, v*-1.0F, false);
+        if(vv-m_lib::dot(v, new_vertex.w) <= kGjkTolerance*vv) break; // これ以上近づかない
+
+        bool duplicated = false;
+        for(std::uint32_t i=0; i<simplex.count; ++i)
+            if(lengthSq(simplex.v[i].w-new_vertex.w) < kOverlapEpsilon) duplicated = true;
+        if(duplicated) break;
+
+        simplex.v[simplex.count++] = new_vertex;
+    }
+
+  // キャッシュ更新
+    if(Cache) {
+        Cache->count = simplex.count;
+        for(std::uint32_t i=0; i<simplex.count; ++i) {
+            Cache->local_a[i] = simplex.v[i].local_a;
+            Cache->local_b[i] = simplex.v[i].local_b;
+        }
+    }
+
+    const float margin = ShapeA.margin() + ShapeB.margin();
+    if(!overlap) { // 芯が離れている
+        Vector3D pa{0.0F, 0.0F, 0.0F}, pb{0.0F, 0.0F, 0.0F};
+        for(std::uint32_t i=0; i<simplex.count; ++i) {
+            pa += simplex.v[i].a*lambda[i];
+            pb += simplex.v[i].b*lambda[i];
+        }
+        const float dist = std::sqrt(lengthSq(v));
+        result.normal = v*(-1.0F/dist);
+        result.point_a = pa + result.normal*ShapeA.margin();
+        result.point_b = pb - result.normal*ShapeB.margin();
+        result.distance = dist - margin;
+        result.intersect = result.distance < 0.0F;
+        return result;
+    }
+
+  // 芯が交差している : EPA
+    result.intersect = true;
+    if(!buildTetrahedron(body_a, body_b, simplex) || !epa(body_a, body_b, simplex, result)) {
+        // 退化して侵入方向を決定できない
+        result.normal = Vector3D{0.0F, 1.0F, 0.0F};
+        result.point_a = simplex.v[0].a;
+        result.point_b = simplex.v[0].b;
+        result.distance = -margin;
+    }
+    return result;
+}
+
+cc_ns::NarrowPhaseStats cc_ns::detectContacts(
+  t_lib::JobSystem& Jobs, const std::vector<ConvexPair>& Pairs, std::vector<ContactResult>& Results) {
+    const auto start = ClockUsed::now();
+    Results.resize(Pairs.size());
+
+  // 判定 : 書き込み先が重ならないので排他不要
+    t_lib::parallelFor(Jobs, 0U, Pairs.size(), [&](const size_t Begin, const size_t End) {
+        for(size_t i=Begin; i<End; ++i) {
+            const auto& pair = Pairs[i];
+            Results[i] = detectContact(*pair.shape_a, pair.transform_a, *pair.shape_b, pair.transform_b, pair.cache);
+        }
+    }, t_lib::ParallelOptions{kPairsPerChunk});
+
+  // 統計
+    NarrowPhaseStats stats{};
+    stats.num_pairs = Pairs.size();
+    for(const auto& result : Results) {
+        stats.gjk_iterations += result.gjk_iterations;
+        stats.epa_iterations += result.epa_iterations;
+    }
+    stats.elapsed = ClockUsed::now() - start;
+    return stats;
+}
+
+
+/******************************************************************************
+
+    others
+
+******************************************************************************/
+namespace {
+// 点の変換 p' = R*p + t
+Vector3D transformPoint(const Matrix3x4& M, const Vector3D& P) noexcept {
+    return Vector3D {
+        M._00*P.x + M._01*P.y + M._02*P.z + M._03,
+        M._10*P.x + M._11*P.y + M._12*P.z + M._13,
+        M._20*P.x + M._21*P.y + M._22*P.z + M._23
+    };
+}
+
+// 方向の逆回転 d' = R^T*d (Rは正規直交)
+Vector3D inverseRotate(const Matrix3x4& M, const Vector3D& D) noexcept {
+    return Vector3D {
+        M._00*D.x + M._10*D.y + M._20*D.z,
+        M._01*D.x + M._11*D.y + M._21*D.z,
+        M._02*D.x + M._12*D.y + M._22*D.z
+    };
+}
+
+SimplexVertex makeVertex(const Body& A, const Body& B, const Vector3D& LocalA, const Vector3D& LocalB) noexcept {
+    SimplexVertex vertex;
+    vertex.local_a = LocalA;
+    vertex.local_b = LocalB;
+    vertex.a = transformPoint(A.transform, LocalA);
+    vertex.b = transformPoint(B.transform, LocalB);
+    vertex.w = vertex.a - vertex.b;
+    return vertex;
+}
+
+// ミンコフスキー差 A-B のサポート点
+//  WithMargin : 丸みを含めるか(GJKは芯のみ、EPAは丸みを含めて行う)
+SimplexVertex support(const Body& A, const Body& B, const Vector3D& Direction, const bool WithMargin) noexcept {
+    const Vector3D dir_a = inverseRotate(A.transform, Direction);
+    const Vector3D dir_b = inverseRotate(B.transform, Direction*-1.0F);
+    Vector3D local_a = A.shape.coreSupport(dir_a);
+    Vector3D local_b = B.shape.coreSupport(dir_b);
+    if(WithMargin) {
+        const float len = std::sqrt(lengthSq(Direction));
+        if(len > 0.0F) {
+            local_a += dir_a*(A.shape.margin()/len);
+            local_b += dir_b*(B.shape.margin()/len);
+        }
+    }
+    return makeVertex(A, B, local_a, local_b);
+}
+
+// 線分上の原点への最近接点の重心座標
+void solveSegment(const Vector3D& A, const Vector3D& B, float(&Lambda)[4]) noexcept {
+    const Vector3D ab = B - A;
+    const float denom = lengthSq(ab);
+    const float t = denom>0.0F ? -easy_engine::m_lib::dot(A, ab)/denom : 0.0F;
+    if(t <= 0.0F)      { Lambda[0] = 1.0F; Lambda[1] = 0.0F; }
+    else if(t >= 1.0F) { Lambda[0] = 0.0F; Lambda[1] = 1.0F; }
+    else               { Lambda[0] = 1.0F-t; Lambda[1] = t; }
+}
+
+// 三角形上の原点への最近接点の重心座標
+//  参考 : Christer Ericson, "Real-Time Collision Detection" 5.1.5
+void solveTriangle(const Vector3D& A, const Vector3D& B, const Vector3D& C, float(&Lambda)[4]) noexcept {
+    using easy_engine::m_lib::dot;
+    Lambda[0] = Lambda[1] = Lambda[2] = 0.0F;
+
+    const Vector3D ab = B - A;
+    const Vector3D ac = C - A;
+    const float d1 = -dot(ab, A);
+    const float d2 = -dot(ac, A);
+    if(d1<=0.0F && d2<=0.0F) { Lambda[0] = 1.0F; return; }
+
+    const float d3 = -dot(ab, B);
+    const float d4 = -dot(ac, B);
+    if(d3>=0.0F && d4<=d3) { Lambda[1] = 1.0F; return; }
+
+    const float vc = d1*d4 - d3*d2;
+    if(vc<=0.0F && d1>=0.0F && d3<=0.0F) {
+        const float t = d1/(d1-d3);
+        Lambda[0] = 1.0F-t; Lambda[1] = t;
+        return;
+    }
+
+    const float d5 = -dot(ab, C);
+    const float d6 = -dot(ac, C);
+    if(d6>=0.0F && d5<=d6) { Lambda[2] = 1.0F; return; }
+
+    const float vb = d5*d2 - d1*d6;
+    if(vb<=0.0F && d2>=0.0F && d6<=0.0F) {
+        const float t = d2/(d2-d6);
+        Lambda[0] = 1.0F-t; Lambda[2] = t;
+        return;
+    }
+
+    const float va = d3*d6 - d5*d4;
+    if(va<=0.0F && (d4-d3)>=0.0F && (d5-d6)>=0.0F) {
+        const float t = (d4-d3)/((d4-d3)+(d5-d6));
+        Lambda[1] = 1.0F-t; Lambda[2] = t;
+        return;
+    }
+
+    const float denom = 1.0F/(va+vb+vc);
+    Lambda[1] = vb*denom;
+    Lambda[2] = vc*denom;
+    Lambda[0] = 1.0F-Lambda[1]-Lambda[2];
+}
+
+// 四面体上の原点への最近接点の重心座標
+//  戻り値 : 原点が四面体の内部にあるか
+bool solveTetrahedron(const Simplex& S, float(&Lambda)[4]) noexcept {
+    using easy_engine::m_lib::dot;
+    using easy_engine::m_lib::cross;
+    constexpr std::uint32_t kFaces[4][4] { {0,1,2,3}, {0,2,3,1}, {0,3,1,2}, {1,3,2,0} }; // 面3頂点 + 対頂点
+
+    bool inside = true;
+    float best_dist = 3.402823466e+38F;
+    for(const auto& face : kFaces) {
+        const Vector3D& a = S.v[face[0]].w;
+        const Vector3D& b = S.v[face[1]].w;
+        const Vector3D& c = S.v[face[2]].w;
+        const Vector3D& d = S.v[face[3]].w;
+        const Vector3D n = cross(b-a, c-a);
+        const float sign_origin = -dot(a, n);
+        const float sign_opposite = dot(d-a, n);
+        if(sign_origin*sign_opposite > 0.0F) continue; // 原点は面の内側
+
+        inside = false;
+        float face_lambda[4]{};
+        solveTriangle(a, b, c, face_lambda);
+        const Vector3D p = a*face_lambda[0] + b*face_lambda[1] + c*face_lambda[2];
+        const float dist = lengthSq(p);
+        if(dist < best_dist) {
+            best_dist = dist;
+            Lambda[0] = Lambda[1] = Lambda[2] = Lambda[3] = 0.0F;
+            Lambda[face[0]] = face_lambda[0];
+            Lambda[face[1]] = face_lambda[1];
+            Lambda[face[2]] = face_lambda[2];
+        }
+    }
+    return inside;
+}
+
+// 単体上の原点への最近接点を求め、寄与しない頂点を取り除く
+//  戻り値 : 原点が単体(四面体)の内部にあるか
+bool solveSimplex(Simplex& S, Vector3D& V, float(&Lambda)[4]) noexcept {
+    Lambda[0] = Lambda[1] = Lambda[2] = Lambda[3] = 0.0F;
+    switch(S.count) {
+    case 1U : Lambda[0] = 1.0F; break;
+    case 2U : solveSegment(S.v[0].w, S.v[1].w, Lambda); break;
+    case 3U : solveTriangle(S.v[0].w, S.v[1].w, S.v[2].w, Lambda); break;
+    case 4U : if(solveTetrahedron(S, Lambda)) return true; break;
+    }
+
+    std::uint32_t count = 0U;
+    V = Vector3D{0.0F, 0.0F, 0.0F};
+    for(std::uint32_t i=0; i<S.count; ++i) {
+        if(Lambda[i] <= 0.0F) continue;
+        V += S.v[i].w*Lambda[i];
+        S.v[count] = S.v[i];
+        Lambda[count] = Lambda[i];
+        ++count;
+    }
+    S.count = count;
+    return false;
+}
+
+// 単体を、丸みを含めたサポート点による四面体に拡張する
+bool buildTetrahedron(const Body& A, const Body& B, Simplex& S) noexcept {
+    using easy_engine::m_lib::dot;
+    using easy_engine::m_lib::cross;
+    static const Vector3D kAxes[6] {
+        { 1.0F, 0.0F, 0.0F}, {-1.0F, 0.0F, 0.0F},
+        { 0.0F, 1.0F, 0.0F}, { 0.0F,-1.0F, 0.0F},
+        { 0.0F, 0.0F, 1.0F}, { 0.0F, 0.0F,-1.0F},
+    };
+
+    if(S.count == 1U) {
+        for(const auto& axis : kAxes) {
+            S.v[1] = support(A, B, axis, true);
+            if(lengthSq(S.v[1].w-S.v[0].w) > kOverlapEpsilon) { S.count = 2U; break; }
+        }
+        if(S.count != 2U) return false;
+    }
+    if(S.count == 2U) {
+        const Vector3D d = S.v[1].w - S.v[0].w;
+        for(const auto& axis : kAxes) {
+            const Vector3D perp = cross(d, axis);
+            if(lengthSq(perp) < kOverlapEpsilon) continue;
+            S.v[2] = support(A, B, perp, true);
+            if(lengthSq(cross(d, S.v[2].w-S.v[0].w)) > kOverlapEpsilon) { S.count = 3U; break; }
+        }
+        if(S.count != 3U) return false;
+    }
+    if(S.count == 3U) {
+        const Vector3D n = cross(S.v[1].w-S.v[0].w, S.v[2].w-S.v[0].w);
+        S.v[3] = support(A, B, n, true);
+        if(std::fabs(dot(S.v[3].w-S.v[0].w, n)) < kOverlapEpsilon) {
+            S.v[3] = support(A, B, n*-1.0F, true);
+            if(std::fabs(dot(S.v[3].w-S.v[0].w, n)) < kOverlapEpsilon) return false;
+        }
+        S.count = 4U;
+    }
+    return true;
+}
+
+// 侵入深度計算
+//  参考 : Gino van den Bergen, "Proximity Queries and Penetration Depth Computation on 3D Game Objects"
+bool epa(const Body& A, const Body& B, const Simplex& S, cc_ns::ContactResult& Result) noexcept {
+    using easy_engine::m_lib::dot;
+    using easy_engine::m_lib::cross;
+
+    struct Face {
+        std::uint32_t i[3];
+        Vector3D n;
+        float d;
+        bool alive;
+    };
+    struct Edge { std::uint32_t a, b; };
+
+    SimplexVertex vertices[kMaxEpaVertices];
+    Face faces[kMaxEpaFaces];
+    size_t num_vertices = 0U;
+    size_t num_faces = 0U;
+
+    auto add_face = [&](const std::uint32_t I0, const std::uint32_t I1, const std::uint32_t I2) {
+        if(num_faces >= kMaxEpaFaces) return false;
+        Face& f = faces[num_faces++];
+        f.i[0] = I0; f.i[1] = I1; f.i[2] = I2;
+        f.n = cross(vertices[I1].w-vertices[I0].w, vertices[I2].w-vertices[I0].w);
+        const float len = std::sqrt(lengthSq(f.n));
+        if(len < kOverlapEpsilon) { f.alive = false; return true; } // 退化面は無視
+        f.n /= len;
+        f.d = dot(f.n, vertices[I0].w);
+        f.alive = true;
+        return true;
+    };
+
+  // 初期四面体(法線が外向きになるよう並べる)
+    for(std::uint32_t i=0; i<4U; ++i) vertices[num_vertices++] = S.v[i];
+    if(dot(vertices[3].w-vertices[0].w, cross(vertices[1].w-vertices[0].w, vertices[2].w-vertices[0].w)) > 0.0F)
+        std::swap(vertices[1], vertices[2]);
+    add_face(0, 1, 2);
+    add_face(0, 3, 1);
+    add_face(0, 2, 3);
+    add_face(1, 3, 2);
+
+    Face* closest = nullptr;
+    while(Result.epa_iterations < kMaxEpaIterations) {
+        ++Result.epa_iterations;
+
+      // 原点に最も近い面
+        closest = nullptr;
+        for(size_t i=0; i<num_faces; ++i)
+            if(faces[i].alive && (!closest || faces[i].d<closest->d)) closest = &faces[i];
+        if(!closest) return false;
+
+      // 面の法線方向へ拡張
+        const SimplexVertex new_vertex = support(A, B, closest->n, true);
+        if(dot(new_vertex.w, closest->n)-closest->d < kEpaTolerance || num_vertices >= kMaxEpaVertices) break;
+
+        const std::uint32_t new_idx = static_cast<std::uint32_t>(num_vertices);
+        vertices[num_vertices++] = new_vertex;
+
+      // 新しい点から見える面を削除し、境界辺を収集
+        Edge horizon[kMaxEpaEdges];
+        size_t num_edges = 0U;
+        bool overflow = false;
+        for(size_t i=0; i<num_faces; ++i) {
+            Face& f = faces[i];
+            if(!f.alive || dot(f.n, new_vertex.w-vertices[f.i[0]].w) <= 0.0F) continue;
+            f.alive = false;
+            for(std::uint32_t e=0; e<3U; ++e) {
+                const Edge edge{f.i[e], f.i[(e+1)%3]};
+                auto shared = std::find_if(horizon, horizon+num_edges,
+                    [&](const Edge& E) { return E.a==edge.b && E.b==edge.a; });
+                if(shared != horizon+num_edges) *shared = horizon[--num_edges]; // 隣接面も削除済みなら境界ではない
+                else if(num_edges < kMaxEpaEdges) horizon[num_edges++] = edge;
+                else overflow = true;
+            }
+        }
+        if(overflow) break;
+
+      // 削除済みの面を詰める
+        size_t alive_faces = 0U;
+        for(size_t i=0; i<num_faces; ++i)
+            if(faces[i].alive) faces[alive_faces++] = faces[i];
+        num_faces = alive_faces;
+
+      // 境界辺と新しい点で面を張る
+        for(size_t i=0; i<num_edges; ++i)
+            if(!add_face(horizon[i].a, horizon[i].b, new_idx)) { overflow = true; break; }
+        if(overflow) break;
+    }
+
+    closest = nullptr;
+    for(size_t i=0; i<num_faces; ++i)
+        if(faces[i].alive && (!closest || faces[i].d<closest->d)) closest = &faces[i];
+    if(!closest) return false;
+
+  // 原点の射影点の重心座標から接触点を求める
+    const SimplexVertex& v0 = vertices[closest->i[0]];
+    const SimplexVertex& v1 = vertices[closest->i[1]];
+    const SimplexVertex& v2 = vertices[closest->i[2]];
+    const Vector3D p = closest->n*closest->d;
+    const float area = dot(cross(v1.w-v0.w, v2.w-v0.w), closest->n);
+    if(std::fabs(area) < kOverlapEpsilon) return false;
+    const float l1 = dot(cross(p-v0.w, v2.w-v0.w), closest->n)/area;
+    const float l2 = dot(cross(v1.w-v0.w, p-v0.w), closest->n)/area;
+    const float l0 = 1.0F-l1-l2;
+
+    Result.normal = closest->n;
+    Result.point_a = v0.a*l0 + v1.a*l1 + v2.a*l2;
+    Result.point_b = v0.b*l0 + v1.b*l1 + v2.b*l2;
+    Result.distance = -closest->d;
+    return true;
+}
+} // unnamed namespace
+// EOF
@@ -0,0 +1,164 @@
+///
+/// \file   convex_collision.hpp
+/// \brief  凸形状間の詳細衝突判定定義ヘッダ
+///
+///         GJKによる最近接点(距離)計算と、
+///         EPAによる侵入深度計算を提供します。
+///
+/// \author 板場
+///
+/// \par    履歴
+///         - 2026/10/19
+///             - ヘッダ追加
+///             - GjkCache 定義
+///             - ContactResult 定義
+///             - detectContact(…), detectContacts(…) 定義
+///             - detectContacts(…) をジョブシステムで並列に判定するよう変更
+///
+/// \note   変換行列について\n
+///         Matrix3x4 は列ベクトル形式(p' = M * [p, 1])の剛体変換として扱う。
+///         左3x3が回転、4列目が平行移動。スケールを含む行列は想定していない。
+///
+#ifndef INCLUDED_EGEG_PLIB_CONVEX_COLLISION_HEADER_
+#define INCLUDED_EGEG_PLIB_CONVEX_COLLISION_HEADER_
+
+#include <cstdint>
+#include <vector>
+#include "mvector.hpp"
+#include "mmatrix.hpp"
+#include "time.hpp"
+#include "convex_shape.hpp"
+
+namespace easy_engine {
+namespace t_lib { class JobSystem; }
+namespace p_lib {
+
+/******************************************************************************
+
+    GjkCache
+
+******************************************************************************/
+///
+/// \brief  GJKの単体キャッシュ
+///
+///         前フレームの終了時の単体を、各形状のローカル空間で保持します。
+///         同じペアについて毎フレーム同じキャッシュを渡すことで、
+///         前フレームの単体から探索を再開し、反復回数を削減します。
+///
+struct GjkCache {
+    m_lib::Vector3D local_a[4]; ///< 形状Aのサポート点(Aのローカル空間)
+    m_lib::Vector3D local_b[4]; ///< 形状Bのサポート点(Bのローカル空間)
+    std::uint32_t count = 0U;   ///< 有効な頂点数(0 : キャッシュ無し)
+};
+
+/******************************************************************************
+
+    ContactResult
+
+******************************************************************************/
+///
+/// \brief  衝突判定結果
+///
+///         distance は丸みを含んだ形状表面間の距離です。
+///         負の場合は侵入しており、その絶対値が侵入深度です。
+///
+struct ContactResult {
+    bool intersect;                 ///< 交差しているか
+    float distance;                 ///< 表面間距離(負 : 侵入深度)
+    m_lib::Vector3D normal;         ///< 接触法線(AからBへの向き、ワールド空間)
+    m_lib::Vector3D point_a;        ///< 形状A上の最近接点(ワールド空間)
+    m_lib::Vector3D point_b;        ///< 形状B上の最近接点(ワールド空間)
+    std::uint32_t gjk_iterations;   ///< GJKの反復回数
+    std::uint32_t epa_iterations;   ///< EPAの反復回数
+};
+
+/******************************************************************************
+
+    ConvexPair
+
+******************************************************************************/
+///
+/// \brief  判定ペア
+///
+///         一括判定に渡すペア情報です。
+///         cache は省略可能(nullptr)です。
+///
+struct ConvexPair {
+    const ConvexShape* shape_a;
+    m_lib::Matrix3x4 transform_a;
+    const ConvexShape* shape_b;
+    m_lib::Matrix3x4 transform_b;
+    GjkCache* cache;
+};
+
+/******************************************************************************
+
+    NarrowPhaseStats
+
+******************************************************************************/
+///
+/// \brief  一括判定の統計
+///
+///         反復回数と処理時間を集計します。
+///         ベンチマーク、チューニングの指標として使用してください。
+///
+struct NarrowPhaseStats {
+    size_t num_pairs = 0U;
+    std::uint64_t gjk_iterations = 0U;
+    std::uint64_t epa_iterations = 0U;
+    Time elapsed{};
+
+    /// 1ペア当たりの平均反復回数(GJK+EPA)
+    double averageIterations() const noexcept {
+        return num_pairs ? static_cast<double>(gjk_iterations+epa_iterations)/num_pairs : 0.0;
+    }
+    /// 1ペア当たりの処理時間(ナノ秒)
+    double nanosecondsPerPair() const noexcept {
+        return num_pairs ? static_cast<double>(elapsed.nanoseconds())/num_pairs : 0.0;
+    }
+};
+
+/******************************************************************************
+
+    functions
+
+******************************************************************************/
+///
+/// \brief  凸形状間の衝突判定
+///
+///         離れている場合はGJKにより最近接点と距離を、
+///         芯同士が交差している場合はEPAにより侵入深度と接触点を求めます。
+///
+/// \param[in] ShapeA     : 形状A
+/// \param[in] TransformA : 形状Aのワールド変換
+/// \param[in] ShapeB     : 形状B
+/// \param[in] TransformB : 形状Bのワールド変換
+/// \param[in,out] Cache  : 単体キャッシュ(nullptrの場合はキャッシュを使用しない)
+///
+/// \return 判定結果
+///
+ContactResult detectContact(const ConvexShape& ShapeA, const m_lib::Matrix3x4& TransformA,
+                            const ConvexShape& ShapeB, const m_lib::Matrix3x4& TransformB,
+                            GjkCache* Cache=nullptr) noexcept;
+
+///
+/// \brief  ペアリストの一括衝突判定
+///
+///         ペアリストを分割し、ジョブシステムのスレッドで並列に判定します。
+///         ジョブシステムに属していないスレッドから呼び出した場合は、そのスレッドで逐次判定します。
+///         Results は Pairs と同じ要素数にリサイズされ、同じ添え字に結果が格納されます。
+///         呼び出し例.) detectContacts(EasyEngine::jobs(), pairs, results);
+///
+/// \param[in]  Jobs    : 使用するジョブシステム
+/// \param[in]  Pairs   : 判定ペアリスト
+/// \param[out] Results : 判定結果リスト
+///
+/// \return 統計情報
+///
+NarrowPhaseStats detectContacts(t_lib::JobSystem& Jobs, const std::vector<ConvexPair>& Pairs,
+                                std::vector<ContactResult>& Results);
+
+} // namespace p_lib
+} // namespace easy_engine
+#endif // !INCLUDED_EGEG_PLIB_CONVEX_COLLISION_HEADER_
+// EOF
@@ -0,0 +1,141 @@
+///
+/// \file   convex_shape.hpp
+/// \brief  凸形状定義ヘッダ
+///
+/// \author 板場
+///
+/// \par    履歴
+///         - 2026/10/19
+///             - ヘッダ追加
+///             - ConvexShape 定義
+///
+#ifndef INCLUDED_EGEG_PLIB_CONVEX_SHAPE_HEADER_
+#define INCLUDED_EGEG_PLIB_CONVEX_SHAPE_HEADER_
+
+#include <cstddef>
+#include "mvector.hpp"
+#include "mmatrix.hpp"
+
+namespace easy_engine {
+namespace p_lib {
+
+/******************************************************************************
+
+    ConvexShape
+
+******************************************************************************/
+///
+/// \brief  凸形状
+///
+///         GJK/EPAで使用するサポート写像を持つ形状です。
+///         形状は「芯」と「丸み(マージン)」に分けて表現します。
+///         球は点に半径の丸みを、カプセルは線分に半径の丸みを持たせた形状です。
+///         生成には静的メンバ関数を使用してください。
+///
+/// \attention hull(…)に渡す頂点配列の寿命は呼び出し側で管理してください。
+///
+class ConvexShape {
+public :
+    enum class Type {
+        kSphere,  ///< 球
+        kBox,     ///< 直方体
+        kCapsule, ///< カプセル(ローカルY軸方向)
+        kHull,    ///< 凸包
+    };
+
+    ConvexShape() = default;
+
+    ///
+    /// \brief  球を生成
+    ///
+    /// \param[in] Radius : 半径
+    ///
+    static ConvexShape sphere(const float Radius) noexcept {
+        return ConvexShape{Type::kSphere, m_lib::Vector3D{0.0F, 0.0F, 0.0F}, Radius, nullptr, 0U};
+    }
+    ///
+    /// \brief  直方体を生成
+    ///
+    /// \param[in] HalfExtents : 各軸方向の半分の大きさ
+    ///
+    static ConvexShape box(const m_lib::Vector3D& HalfExtents) noexcept {
+        return ConvexShape{Type::kBox, HalfExtents, 0.0F, nullptr, 0U};
+    }
+    ///
+    /// \brief  カプセルを生成
+    ///
+    /// \param[in] Radius     : 半径
+    /// \param[in] HalfHeight : 芯となる線分の半分の長さ
+    ///
+    static ConvexShape capsule(const float Radius, const float HalfHeight) noexcept {
+        return ConvexShape{Type::kCapsule, m_lib::Vector3D{0.0F, HalfHeight, 0.0F}, Radius, nullptr, 0U};
+    }
+    ///
+    /// \brief  凸包を生成
+    ///
+    ///         頂点配列はコピーされません。
+    ///
+    /// \param[in] Vertices    : ローカル空間の頂点配列
+    /// \param[in] NumVertices : 頂点数
+    /// \param[in] Radius      : 丸みの半径
+    ///
+    static ConvexShape hull(const m_lib::Vector3D* Vertices, const size_t NumVertices, const float Radius=0.0F) noexcept {
+        return ConvexShape{Type::kHull, m_lib::Vector3D{0.0F, 0.0F, 0.0F}, Radius, Vertices, NumVertices};
+    }
+
+    /// 形状の種類を取得
+    Type type() const noexcept { return type_; }
+    /// 丸みの半径を取得
+    float margin() const noexcept { return margin_; }
+
+    ///
+    /// \brief  芯のサポート点を取得
+    ///
+    ///         ローカル空間で、指定方向に最も遠い芯上の点を返却します。
+    ///         丸みは含みません。
+    ///
+    /// \param[in] Direction : ローカル空間での方向(正規化不要)
+    ///
+    /// \return サポート点
+    ///
+    m_lib::Vector3D coreSupport(const m_lib::Vector3D& Direction) const noexcept {
+        switch(type_) {
+        case Type::kSphere :
+            return m_lib::Vector3D{0.0F, 0.0F, 0.0F};
+        case Type::kBox :
+            return m_lib::Vector3D{
+                Direction.x<0.0F ? -extents_.x : extents_.x,
+                Direction.y<0.0F ? -extents_.y : extents_.y,
+                Direction.z<0.0F ? -extents_.z : extents_.z};
+        case Type::kCapsule :
+            return m_lib::Vector3D{0.0F, Direction.y<0.0F ? -extents_.y : extents_.y, 0.0F};
+        case Type::kHull : {
+            size_t max_idx = 0;
+            float max_dot = -3.402823466e+38F;
+            for(size_t i=0; i<num_vertices_; ++i) {
+                const auto& v = vertices_[i];
+                const float d = v.x*Direction.x + v.y*Direction.y + v.z*Direction.z;
+                if(d > max_dot) { max_dot = d; max_idx = i; }
+            }
+            return num_vertices_ ? vertices_[max_idx] : m_lib::Vector3D{0.0F, 0.0F, 0.0F};
+        }
+        }
+        return m_lib::Vector3D{0.0F, 0.0F, 0.0F};
+    }
+
+private :
+    ConvexShape(const Type Ty, const m_lib::Vector3D& Extents, const float Margin,
+                const m_lib::Vector3D* Vertices, const size_t NumVertices) noexcept :
+        type_{Ty}, extents_{Extents}, margin_{Margin}, vertices_{Vertices}, num_vertices_{NumVertices} {}
+
+    Type type_;
+    m_lib::Vector3D extents_;
+    float margin_;
+    const m_lib::Vector3D* vertices_;
+    size_t num_vertices_;
+};
+
+} // namespace p_lib
+} // namespace easy_engine
+#endif // !INCLUDED_EGEG_PLIB_CONVEX_SHAPE_HEADER_
+// EOF
@@ -1,12 +1,12 @@
 ///
 /// \file   depth_stencil_state.hpp
-/// \brief  [xXeVԒ`NX`wb_
+/// \brief  深度ステンシル状態定義クラス定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/9/4
-///             - wb_ǉ
+///             - ヘッダ追加
 ///
 #ifndef INCLUDED_EGEG_GLIB_DEPTH_STENCIL_STATE_HEADER_
 #define INCLUDED_EGEG_GLIB_DEPTH_STENCIL_STATE_HEADER_
@@ -23,8 +23,8 @@ namespace g_lib {
     DepthStencilDesc
 
 ******************************************************************************/
-/// [xXeVeXgɎsXeV
-// ڍ : https://docs.microsoft.com/en-us/windows/win32/api/d3d11/ne-d3d11-d3d11_stencil_op
+/// 深度ステンシルテスト中に実行するステンシル操作
+// 詳細 : https://docs.microsoft.com/en-us/windows/win32/api/d3d11/ne-d3d11-d3d11_stencil_op
 enum class StencilOperation {
     kKeep,
     kZero,
@@ -36,8 +36,8 @@ enum class StencilOperation {
     kDecrement
 };
 
-/// [xf[^Ɗ̐[xf[^̔rIvV
-// ڍ : https://docs.microsoft.com/en-us/windows/win32/api/d3d11/ne-d3d11-d3d11_comparison_func
+/// 深度データと既存の深度データの比較オプション
+// 詳細 : https://docs.microsoft.com/en-us/windows/win32/api/d3d11/ne-d3d11-d3d11_comparison_func
 enum class DepthStencilComparison {
     kNever,
     kLess,
@@ -49,23 +49,23 @@ enum class DepthStencilComparison {
     kAlways
 };
 
-/// XeVeXǧʂɊÂĎsXeV
+/// ステンシルテストの結果に基づいて実行するステンシル操作
 struct StencilOperationDesc {
-    StencilOperation fail;       ///< XeVeXgsꍇɎs鑀
-    StencilOperation depth_fail; ///< XeVeXgʉ߁A[xeXgɎsꍇɎs鑀
-    StencilOperation pass;       ///< XeVeXgA[xeXg̗ʉ߂ꍇɎs鑀
-    DepthStencilComparison func; ///< eXgʂƊɂf[^Ƃ̔r
+    StencilOperation fail;       ///< ステンシルテストが失敗した場合に実行する操作
+    StencilOperation depth_fail; ///< ステンシルテストを通過、深度テストに失敗した場合に実行する操作
+    StencilOperation pass;       ///< ステンシルテスト、深度テストの両方を通過した場合に実行する操作
+    DepthStencilComparison func; ///< テスト結果と既にあるデータとの比較操作
 };
 
 struct DepthStencilDesc {
-    bool depth_enable;                 ///< [xeXg̗L@true:L@false:
-    bool depth_write_enable;           ///< [xl݂̗L@true:L@false:
-    DepthStencilComparison depth_func; ///< [xeXgʂƊɂf[^Ƃ̔r
-    bool stencil_enable;               ///< XeVeXg̗L@true:L@false:
-    std::uint8_t stencil_read_mask;    ///< XeVf[^ǂݍނ߂̃}XN
-    std::uint8_t stencil_write_mask;   ///< XeVf[^ނ߂̃}XN
-    StencilOperationDesc front_face;   ///< \ʖ@J̕ĂsNŹAeXgʂ̎gp@
-    StencilOperationDesc back_face;    ///< \ʖ@J痣ꂽĂsNŹAeXgʂ̎gp@
+    bool depth_enable;                 ///< 深度テストの有無　true:有効　false:無効
+    bool depth_write_enable;           ///< 深度値書き込みの有無　true:有効　false:無効
+    DepthStencilComparison depth_func; ///< 深度テスト結果と既にあるデータとの比較操作
+    bool stencil_enable;               ///< ステンシルテストの有無　true:有効　false:無効
+    std::uint8_t stencil_read_mask;    ///< ステンシルデータを読み込むためのマスク
+    std::uint8_t stencil_write_mask;   ///< ステンシルデータを書き込むためのマスク
+    StencilOperationDesc front_face;   ///< 表面法線がカメラの方向を向いているピクセルの、テスト結果の使用方法
+    StencilOperationDesc back_face;    ///< 表面法線がカメラから離れた方向を向いているピクセルの、テスト結果の使用方法
 };
 
 
@@ -75,36 +75,36 @@ struct DepthStencilDesc {
 
 ******************************************************************************/
 ///
-/// \brief  [xXeVԒ`NX
+/// \brief  深度ステンシル状態定義クラス
 ///
 class DepthStencilState {
 public :
     ///
-    /// \brief  ftHg̃RXgN^
+    /// \brief  デフォルトのコンストラクタ
     ///
-    ///         Ԃ̒`܂B
+    ///         状態の定義を持ちません。
     ///
     DepthStencilState() = default;
 
     ///
-    /// \brief  [xXeVXe[g̍쐬𔺂RXgN^
+    /// \brief  深度ステンシルステートの作成を伴うコンストラクタ
     ///
-    /// \param[in] Desc : [xXeV̏Ԓ`\
+    /// \param[in] Desc : 深度ステンシルの状態定義構造体
     ///
     DepthStencilState(const DepthStencilDesc& Desc);
 
     ///
-    /// \brief  LȐ[xXeVԒ`IuWFNgǂ
+    /// \brief  有効な深度ステンシル状態定義オブジェクトかどうか判定
     ///
-    ///         true  : L
-    ///         false : 
+    ///         true  : 有効
+    ///         false : 無効
     ///
-    /// \return 茋
+    /// \return 判定結果
     ///
     bool isValid() const noexcept { return state_; }
     operator bool() const noexcept { return isValid(); }
 
-    /// [xXeVXe[gIuWFNg擾
+    /// 深度ステンシルステートオブジェクトを取得
     ID3D11DepthStencilState* state() const noexcept { state_.Get(); }
 private :
     Microsoft::WRL::ComPtr<ID3D11DepthStencilState> state_;
@@ -116,7 +116,7 @@ private :
     depth-stencil presets
 
 ******************************************************************************/
-// Ql : https://github.com/microsoft/DirectXTK
+// 参考 : https://github.com/microsoft/DirectXTK
 //        https://github.com/microsoft/DirectXTK/blob/master/Src/CommonStates.cpp
   namespace depth_stencil_impl {
       inline DepthStencilState createDS(const bool E, const bool W) {
@@ -133,11 +133,11 @@ private :
   } // namespace depth_stencil_impl
 
 namespace depth_stencil_preset {
-/// [xeXgAXeVeXg
+/// 深度テスト、ステンシルテスト無し
 inline DepthStencilState none() { return depth_stencil_impl::createDS(false, false); }
-/// [xeXgAXeVeXgB[xl݂Ȃ
+/// 深度テストあり、ステンシルテスト無し。深度値書き込みなし
 inline DepthStencilState read() { return depth_stencil_impl::createDS(true, false); }
-/// [xeXgAXeVeXgB[xl݂
+/// 深度テストあり、ステンシルテスト無し。深度値書き込みあり
 inline DepthStencilState write() { return depth_stencil_impl::createDS(true, true); }
 } // namespace depth_stencil_preset
 
@@ -1,4 +1,4 @@
-// 쐬 : 
+// 作成者 : 板場
 /******************************************************************************
 
     include
@@ -6,6 +6,7 @@
 ******************************************************************************/
 #include "depth_stencil_texture.hpp"
 #include "easy_engine.hpp"
+#include "graphic_manager.hpp"
 #include "utility_function.hpp"
 
 
@@ -46,7 +47,7 @@ dstexture_ns::DepthStencilTexture::DepthStencilTexture(const unsigned Width, con
 } {
     if(!TextureResource::isValid()) return;
 
-    // r[쐬
+    // ビューを作成
     EasyEngine::graphics().d3d11Device().CreateDepthStencilView(resource(), nullptr, &texture_);
 }
 // EOF
@@ -1,13 +1,13 @@
 ///
 /// \file   depth_stencil_texture.hpp
-/// \brief  [xXeVpeNX``wb_
+/// \brief  深度ステンシル用テクスチャ定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/9/2
-///             - wb_ǉ
-///             - DepthStencilTexture `
+///             - ヘッダ追加
+///             - DepthStencilTexture 定義
 ///
 #ifndef INCLUDED_EGEG_GLIB_DEPTH_STENCIL_TEXTURE_HEADER_
 #define INCLUDED_EGEG_GLIB_DEPTH_STENCIL_TEXTURE_HEADER_
@@ -23,15 +23,15 @@ namespace g_lib {
 
 ******************************************************************************/
 ///
-/// \brief  [xXeVpeNX`
+/// \brief  深度ステンシル用テクスチャ
 ///
 class DepthStencilTexture : public TextureResource {
 public :
     ///
     /// \enum   Format
-    /// \brief  eNX`tH[}bg
+    /// \brief  テクスチャフォーマット
     ///
-    ///         ڍׂMicrosoft DXGI_FORMAT enumerationQƂĂB
+    ///         詳細はMicrosoft DXGI_FORMAT enumerationを参照してください。
     ///         https://docs.microsoft.com/en-us/windows/win32/api/dxgiformat/ne-dxgiformat-dxgi_format
     ///
     enum class Format {
@@ -44,27 +44,27 @@ public :
     DepthStencilTexture() = default;
 
     ///
-    /// \brief  eNX`̍쐬𔺂RXgN^
+    /// \brief  テクスチャの作成を伴うコンストラクタ
     ///
-    /// \param[in] Width         : eNX`
-    /// \param[in] Height        : eNX`c
-    /// \param[in] Format        : eNX`tH[}bg
-    /// \param[in] SampleCount   : 1sNZ̃Tv
-    /// \param[in] SampleQuality : }`Tv̉掿x
+    /// \param[in] Width         : テクスチャ横幅
+    /// \param[in] Height        : テクスチャ縦幅
+    /// \param[in] Format        : テクスチャフォーマット
+    /// \param[in] SampleCount   : 1ピクセル当たりのサンプル数
+    /// \param[in] SampleQuality : マルチサンプルの画質レベル
     ///
     DepthStencilTexture(unsigned Width, unsigned Height, Format TextureFormat=Format::kD32Float, UINT SampleCount=1U, UINT SampleQuality=0U);
 
     ///
-    /// \brief  LȐ[xXeVeNX`ǂ
+    /// \brief  有効な深度ステンシルテクスチャかどうか判定
     ///
-    ///         true  : L
-    ///         false : 
+    ///         true  : 有効
+    ///         false : 無効
     ///
     bool isValid() const noexcept { return TextureResource::isValid() && texture_; }
     operator bool() const noexcept { return isValid(); }
 
 
-    /// eNX`擾
+    /// テクスチャを取得
     ID3D11DepthStencilView* texture() const noexcept { return texture_.Get(); }
 private :
     Microsoft::WRL::ComPtr<ID3D11DepthStencilView> texture_;
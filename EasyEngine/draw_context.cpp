@@ -1,4 +1,4 @@
-// 쐬 : 
+// 作成者 : 板場
 /******************************************************************************
 
     include
@@ -6,6 +6,7 @@
 ******************************************************************************/
 #include "draw_context.hpp"
 #include "easy_engine.hpp"
+#include "graphic_manager.hpp"
 
 
 /******************************************************************************
@@ -43,7 +44,7 @@ void dc_ns::DrawContext::setLayer(const Layer& Target, const DepthStencilTexture
 }
 
 void dc_ns::DrawContext::setLayer(const std::vector<Layer>& Targets, const DepthStencilTexture& DST) {
-    std::vector<ID3D11RenderTargetView*> d3d11_targets;
+    std::pmr::vector<ID3D11RenderTargetView*> d3d11_targets(&EasyEngine::frameArena()); // 一時的な配列はフレームアリーナから確保
     d3d11_targets.reserve(Targets.size());
     for(auto& target : Targets) {
         d3d11_targets.push_back(target.layer());
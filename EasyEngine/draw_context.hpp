@@ -1,12 +1,12 @@
 ///
 /// \file   draw_context.hpp
-/// \brief  `ReLXg`wb_
+/// \brief  描画コンテキスト定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/9/10
-///             - wb_ǉ
+///             - ヘッダ追加
 ///
 #ifndef INCLUDED_EGEG_GLIB_DRAW_CONTEXT_HEADER
 #define INCLUDED_EGEG_GLIB_DRAW_CONTEXT_HEADER
@@ -35,151 +35,151 @@ public :
     DrawContext();
 
     ///
-    /// \brief  eNX`Lv`
+    /// \brief  テクスチャをキャプチャ
     ///
-    ///         ̃eNX`Lv`ĕԋp
-    ///         ߂l̃eNX`͉摜t@CƂĕۑ邱Ƃ\
+    ///         引数のテクスチャをキャプチャして返却
+    ///         戻り値のテクスチャは画像ファイルとして保存することが可能
     ///
-    /// \param[in] Texture : Lv`eNX`
+    /// \param[in] Texture : キャプチャするテクスチャ
     ///
-    /// \return Lv`ς݃eNX`
+    /// \return キャプチャ済みテクスチャ
     ///
     TextureResource capture(const TextureResource& Texture);
     
     ///
-    /// \brief  ReLXgNA
+    /// \brief  コンテキストをクリア
     ///
     void clear();
     ///
-    /// \brief  C[NA(hԂ)
+    /// \brief  レイヤーをクリア(塗りつぶす)
     ///
-    /// \param[in] Target : NA郌C[
-    /// \param[in] ClearColor : hԂF
+    /// \param[in] Target : クリアするレイヤー
+    /// \param[in] ClearColor : 塗りつぶす色
     ///
     void clearLayer(const Layer& Target, const float(&ClearColor)[4]);
 
     ///
-    /// \brief  `ΏۂƂȂ郌C[Zbg
+    /// \brief  描画対象となるレイヤーをセット
     ///
-    /// \param[in] Target       : Zbg郌C[
-    /// \param[in] DepthStencil : [xeNX`
+    /// \param[in] Target       : セットするレイヤー
+    /// \param[in] DepthStencil : 深度テクスチャ
     ///
     void setLayer(const Layer& Target, const DepthStencilTexture& DepthStencil=DepthStencilTexture{});
     ///
-    /// \brief  `ΏۂƂȂ郌C[xɕZbg
+    /// \brief  描画対象となるレイヤーを一度に複数セット
     ///
-    /// \param[in] Targets   : Zbg郌C[Xg
-    /// \param[in] DepthStencil : [xeNX`
+    /// \param[in] Targets   : セットするレイヤーリスト
+    /// \param[in] DepthStencil : 深度テクスチャ
     ///
     void setLayer(const std::vector<Layer>& Targets, const DepthStencilTexture& DepthStencil=DepthStencilTexture{});
 
     ///
-    /// \brief  uh̏ԂZbg
+    /// \brief  ブレンドの状態をセット
     ///
-    /// \param[in] BS          : uh̏Ԓ`IuWFNg
-    /// \param[in] BlendFactor : uh萔
-    /// \param[in] SampleMask  : }`Tv`^[QbgɂẮATvp}XN
+    /// \param[in] BS          : ブレンドの状態定義オブジェクト
+    /// \param[in] BlendFactor : ブレンド時定数
+    /// \param[in] SampleMask  : マルチサンプル描画ターゲットにおいての、サンプル用マスク
     ///
-    /// BlendFactor̓uhXe[g̃uhWɁAkBlendFactorkInvBlendFactorIĂƂ̂ݗL
+    /// BlendFactorはブレンドステートのブレンド係数に、kBlendFactorかkInvBlendFactorが選択されているときのみ有効
     //  
     ///
     void setBlendState(const BlendState& BS, const float(&BlendFactor)[4], UINT SampleMask=kMaskRGBA);
     ///
-    /// \brief  [xXeV̏ԂZbg
+    /// \brief  深度ステンシルの状態をセット
     ///
-    /// \param[in] DS         : [xXeV̏Ԓ`IuWFNg
-    /// \param[in] StencilRef : XeVeXgŎgpQƒl
+    /// \param[in] DS         : 深度ステンシルの状態定義オブジェクト
+    /// \param[in] StencilRef : ステンシルテストで使用する参照値
     ///
     void setDepthStencilState(const DepthStencilState& DS, UINT StencilRef=0);
     ///
     ///
-    /// \brief  X^CȔԂZbg
+    /// \brief  ラスタライザの状態をセット
     ///
-    /// \param[in] RS : X^CȔԒ`IuWFNg
+    /// \param[in] RS : ラスタライザの状態定義オブジェクト
     ///
     void setRasterizerState(const RasterizerState& RS);
 
     ///
-    /// \brief  _VF[_\Zbg
+    /// \brief  頂点シェーダ―をセット
     ///
-    /// \param[in] VS : _VF[_\
+    /// \param[in] VS : 頂点シェーダ―
     ///
     void setVertexShader(const VertexShader& VS);
     ///
-    /// \brief  _VF[_\̃VF[_[XbgZbg
+    /// \brief  頂点シェーダ―のシェーダースロットをセット
     ///
-    /// \param[in] Slot : Xbg
+    /// \param[in] Slot : スロット
     ///
     void setVertexShaderSlot(const ShaderSlot& Slot);
     ///
-    /// \brief  WIgVF[_\Zbg
+    /// \brief  ジオメトリシェーダ―をセット
     ///
-    /// \param[in] GS : WIgVF[_\
+    /// \param[in] GS : ジオメトリシェーダ―
     ///
     void setGeometryShader(const GeometryShader& GS);
     ///
-    /// \brief  WIgVF[_[̃VF[_[XbgZbg
+    /// \brief  ジオメトリシェーダーのシェーダースロットをセット
     ///
-    /// \param[in] Slot : Xbg
+    /// \param[in] Slot : スロット
     ///
     void setGeometryShaderSlot(const ShaderSlot& Slot);
     ///
-    /// \brief  sNZVF[_\Zbg
+    /// \brief  ピクセルシェーダ―をセット
     ///
-    /// \param[in] PS : sNZVF[_\
+    /// \param[in] PS : ピクセルシェーダ―
     ///
     void setPixelShader(const PixelShader& PS);
     ///
-    /// \brief  sNZVF[_[̃VF[_[XbgZbg
+    /// \brief  ピクセルシェーダーのシェーダースロットをセット
     ///
-    /// \param[in] Slot : Xbg
+    /// \param[in] Slot : スロット
     ///
     void setPixelShaderSlot(const ShaderSlot& Slot);
 
     ///
-    /// \brief  bV`
+    /// \brief  メッシュを描画
     ///
-    /// \param[in] Mesh : `悷郁bV
-    /// \param[in] IndexCount : `悷钸_
-    /// \param[in] BaseIndexLocation : `Jn钸_CfbNX̊Jn_
-    /// \param[in] BaseVertexLocation : `Jn钸_̊Jn_
+    /// \param[in] Mesh : 描画するメッシュ
+    /// \param[in] IndexCount : 描画する頂点数
+    /// \param[in] BaseIndexLocation : 描画を開始する頂点インデックスの開始点
+    /// \param[in] BaseVertexLocation : 描画を開始する頂点の開始点
     ///
     void draw(const RenderMesh& Mesh, UINT IndexCount, UINT BaseIndexLocation=0, INT BaseVertexLocation=0);
     ///
-    /// \brief  bṼCX^VO`
+    /// \brief  メッシュのインスタンシング描画
     ///
-    /// \param[in] InstanceCount : `悷CX^X
-    /// \param[in] Mesh : `悷郁bV
-    /// \param[in] IndexCountPerMesh : bV̕`悷钸_
-    /// \param[in] BaseIndexLocation : `Jn钸_CfbNX̊Jn_
-    /// \param[in] BaseVertexLocation : `Jn钸_̊Jn_
-    /// \param[in] StartInstanceLocation : `JnCX^X̊Jn_
+    /// \param[in] InstanceCount : 描画するインスタンス数
+    /// \param[in] Mesh : 描画するメッシュ
+    /// \param[in] IndexCountPerMesh : メッシュ毎の描画する頂点数
+    /// \param[in] BaseIndexLocation : 描画を開始する頂点インデックスの開始点
+    /// \param[in] BaseVertexLocation : 描画を開始する頂点の開始点
+    /// \param[in] StartInstanceLocation : 描画を開始するインスタンスの開始点
     ///
     void drawInstanced(UINT InstanceCount, const RenderMesh& Mesh, UINT IndexCountPerMesh, UINT BaseIndexLocation=0, INT BaseVertexLocation=0, UINT StartInstanceLocation=0);
     
     ///
-    /// \brief  ReLXgm
+    /// \brief  コンテキストを確定
     ///
-    ///         ̊֐ĂяoɁAReLXgɕύX邱Ƃ\łB
-    ///         ̏ꍇAēxfinish֐Ăяo܂ŁAÕReLXg͕ێ܂B
+    ///         この関数を呼び出した後に、コンテキストに変更を加えることが可能です。
+    ///         この場合、再度finish関数が呼び出されるまで、前回のコンテキストは保持されます。
     ///
     void finish();
 
     ///
-    /// \brief  Lȕ`ReNXgǂ
+    /// \brief  有効な描画コンテクストかどうか判定
     ///
-    ///         true  : L
-    ///         false : 
+    ///         true  : 有効
+    ///         false : 無効
     ///
-    /// \return 茋
+    /// \return 判定結果
     ///
     bool isValid() const noexcept { return context_; }
     operator bool() const noexcept { return context_; }
 
 
-    ///< fBt@[hReLXg擾
+    ///< ディファードコンテキストを取得
     ID3D11DeviceContext* context() const noexcept { return context_.Get(); }
-    ///< `R}hXg擾
+    ///< 描画コマンドリストを取得
     ID3D11CommandList* commands() const noexcept { return commands_.Get(); }
 protected :
     DrawContext(Microsoft::WRL::ComPtr<ID3D11DeviceContext>& Context) noexcept : context_{Context} {}
@@ -1,4 +1,4 @@
-// 쐬 : 
+// 作成者 : 板場
 /******************************************************************************
 
     include
@@ -6,8 +6,15 @@
 ******************************************************************************/
 #include "easy_engine.hpp"
 #include <cassert>
+#include <cstdio>
+#include <atomic>
 #include <string>
-#include "egeg_state.hpp"
+#include "profiler.hpp"
+#include "input_manager.hpp"
+#ifdef _WIN32
+#include "window_manager.hpp"
+#include "graphic_manager.hpp"
+#endif
 
 /******************************************************************************
 
@@ -23,74 +30,90 @@ std::unique_ptr<egeg_ns::EasyEngine::Impl> egeg_ns::EasyEngine::impl_{};
 
 ******************************************************************************/
 struct egeg_ns::EasyEngine::Impl  {
+#ifdef _WIN32
     void WindowEventProcess(HWND, UINT, WPARAM, LPARAM);
+    void windowLoop(const EngineConfig&);
+#endif
+    void headlessLoop(const EngineConfig&);
+    Time beginFrame(const EngineConfig&, Clock&);
+    Time frame(Time Elapsed);
+    bool finished(const EngineConfig& Config) const noexcept {
+        return exit_requested_.load(std::memory_order_relaxed) || recorder_->finished() ||
+               (Config.max_frames > 0U && frames_ >= Config.max_frames);
+    }
+
+    bool headless_ = false;
+    std::atomic<bool> exit_requested_{false};
+    uint64_t frames_ = 0U;
 
-    // 錾Ɉˑ֌WB
-    //  錾Ƃ͋tɔjs
-    std::unique_ptr<WindowManager> wmanager_;
-    Clock clock_;
+    // 宣言順に依存関係あり。
+    //  宣言とは逆順に破棄が行われる
+#ifdef _WIN32
+    std::unique_ptr<WindowManager> wmanager_;   // ヘッドレスモードでは生成しない
+#endif
+    EngineClocks clocks_;
+    std::unique_ptr<FramePacer> pacer_;
+    std::unique_ptr<FrameArena> arena_;
+    std::unique_ptr<t_lib::JobSystem> jmanager_;
+    std::unique_ptr<t_lib::MpscEventQueue<void()>> equeue_;
+    std::unique_ptr<t_lib::EventBus> ebus_;
     std::unique_ptr<UpdateManager<EasyEngine>> umanager_;
     std::unique_ptr<i_lib::InputManager> imanager_;
-    std::unique_ptr<g_lib::GraphicManager> gmanager_;
+    std::unique_ptr<FrameRecorder> recorder_;
+#ifdef _WIN32
+    std::unique_ptr<g_lib::GraphicManager> gmanager_;  // ヘッドレスモードでは生成しない
+#endif
 };
 
 /******************************************************************************
 
     EasyEngine::
 
-/******************************************************************************/
-void egeg_ns::EasyEngine::run() {
-    auto init_res = startUp();
+******************************************************************************/
+void egeg_ns::EasyEngine::run(const EngineConfig& Config) {
+    auto init_res = startUp(Config);
     if(!init_res) {
-        // Oo : GW̏Ɏs܂B
-        //            ڍ : init_res.what()
+        // ログ出力 : エンジンの初期化に失敗しました。
+        //            詳細 : init_res.what()
         return;
     }
 
-    // Q[[v
+    // ゲームループ
     try {
-        MSG msg{};
-        Clock clock{};
-        while( msg.message != WM_QUIT ) {
-            // bZ[W
-            if( PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE) ) {
-                TranslateMessage( &msg );
-                DispatchMessage( &msg );
-            }
-            // Q[
-            else {
-                clock.update();
-                auto elapsed = clock.elapsed();
-                if(elapsed.microseconds() >= kTPF<std::micro>) {
-                    clock = Clock{};
-                    impl_->umanager_->run(elapsed);
-                    SetWindowText(window().handle(), std::to_wstring(elapsed.nanoseconds()).c_str());
-                }
-            }
+        if(Config.on_start) Config.on_start();
+#ifdef _WIN32
+        if(!impl_->headless_) impl_->windowLoop(Config);
+        else impl_->headlessLoop(Config);
+#else
+        impl_->headlessLoop(Config);
+#endif
+        if(Config.on_exit) Config.on_exit();
+        if(!impl_->recorder_->stop()) {
+            // ログ出力 : フレームの記録の書き出しに失敗しました。
         }
     }
     catch(const std::exception& e) {
         shutDown();
-        // Oo : ⑫ȂOɂI܂B
-        //            ڍ : e.what()
+        // ログ出力 : 補足されない例外により終了しました。
+        //            詳細 : e.what()
     }
     catch(...) {
         shutDown();
-        // Oo : ⑫ȂOɂI܂B
-        //            ڍ : unknown error
+        // ログ出力 : 補足されない例外により終了しました。
+        //            詳細 : unknown error
     }
 
     shutDown();
 
-    // Oo : I
+    // ログ出力 : 正常終了
 
     return;
 }
 
-// GW
-// TuVXȅɂ͈ˑ֌W
-// impl_̃oɐ}l[W[𒼑Ă̂R
-egeg_ns::t_lib::DetailedResult<bool, const char*> egeg_ns::EasyEngine::startUp() {
+// エンジン初期化
+// サブシステムの初期化順には依存関係がある
+// impl_のメンバに生成したマネージャーを直代入しているのもそういった理由
+egeg_ns::t_lib::DetailedResult<bool, const char*> egeg_ns::EasyEngine::startUp(const EngineConfig& Config) {
     using namespace t_lib;
     using namespace i_lib;
 
@@ -101,25 +124,52 @@ egeg_ns::t_lib::DetailedResult<bool, const char*> egeg_ns::EasyEngine::startUp()
         return {Failure{}, Message};
     };
 
-  // TuVXeX^[gAbv
+  // サブシステムスタートアップ
     try {
         impl_ = std::make_unique<Impl>();
-        impl_->wmanager_ = WindowManager::create();
-        if(!impl_->wmanager_) return failure("EasyEngine::startUp : EBhE}l[W[̐Ɏs܂B");
-        impl_->clock_ = Clock{};
+#ifdef _WIN32
+        impl_->headless_ = Config.headless;
+        if(!Config.headless) {
+            impl_->wmanager_ = WindowManager::create();
+            if(!impl_->wmanager_) return failure("EasyEngine::startUp : ウィンドウマネージャーの生成に失敗しました。");
+        }
+#else
+        impl_->headless_ = true; // ウィンドウと描画のサブシステムはビルドされない
+#endif
+        impl_->pacer_ = std::make_unique<FramePacer>(Microseconds{kTPF<std::micro>});
+        impl_->arena_ = std::make_unique<FrameArena>();
+        impl_->jmanager_ = std::make_unique<JobSystem>();
+        impl_->equeue_ = std::make_unique<MpscEventQueue<void()>>();
+        impl_->ebus_ = std::make_unique<EventBus>();
         impl_->umanager_ = UpdateManager<EasyEngine>::create();
-        if(!impl_->umanager_) return failure("EasyEngine::startUp : XV}l[W[̐Ɏs܂B");
+        if(!impl_->umanager_) return failure("EasyEngine::startUp : 更新マネージャーの生成に失敗しました。");
         impl_->imanager_ = i_lib::InputManager::create();
-        if(!impl_->imanager_) return failure("EasyEngine::startUp : ̓}l[W[̐Ɏs܂B");
-        impl_->gmanager_ = g_lib::GraphicManager::create();
-        if(!impl_->gmanager_) return failure("EasyEngine::startUp : `}l[W[̐Ɏs܂B");
+        if(!impl_->imanager_) return failure("EasyEngine::startUp : 入力マネージャーの生成に失敗しました。");
+        impl_->recorder_ = std::make_unique<FrameRecorder>();
+        if(Config.replay_path) {
+            auto res = impl_->recorder_->startReplay(Config.replay_path);
+            if(!res) return failure(res.detail());
+        }
+        else if(Config.record_path) {
+            auto res = impl_->recorder_->startRecording(Config.record_path);
+            if(!res) return failure(res.detail());
+        }
+#ifdef _WIN32
+        if(!Config.headless) {
+            impl_->gmanager_ = g_lib::GraphicManager::create();
+            if(!impl_->gmanager_) return failure("EasyEngine::startUp : 描画マネージャーの生成に失敗しました。");
+        }
+#endif
     } catch(const std::exception& e) {
-        char err_msg[1024] = "EasyEngine::startUP : ";
-        strcat_s(err_msg, e.what());
+        static char err_msg[1024];
+        std::snprintf(err_msg, sizeof(err_msg), "EasyEngine::startUP : %s", e.what());
         return failure(err_msg);
     }
 
-    window().addCallback(impl_.get(), &EasyEngine::Impl::WindowEventProcess);
+#ifdef _WIN32
+    if(!Config.headless)
+        window().addCallback(impl_.get(), &EasyEngine::Impl::WindowEventProcess);
+#endif
 
     return Success{};
 }
@@ -128,36 +178,149 @@ void egeg_ns::EasyEngine::shutDown() noexcept {
     impl_.reset();
 }
 
+void egeg_ns::EasyEngine::exit() noexcept {
+    if(impl_) impl_->exit_requested_.store(true, std::memory_order_relaxed);
+}
+
+bool egeg_ns::EasyEngine::isHeadless() noexcept {
+    assert(impl_ && "エンジンの初期化が正常に終了していません。");
+    return impl_->headless_;
+}
+
+uint64_t egeg_ns::EasyEngine::frameCount() noexcept {
+    assert(impl_ && "エンジンの初期化が正常に終了していません。");
+    return impl_->frames_;
+}
+
+#ifdef _WIN32
 egeg_ns::WindowManager& egeg_ns::EasyEngine::window() noexcept{
-    assert(impl_&&impl_->wmanager_ && "GW̏ɏIĂ܂B");
+    assert(impl_ && "エンジンの初期化が正常に終了していません。");
+    assert(impl_->wmanager_ && "ヘッドレスモードではウィンドウを使用できません。");
     return *impl_->wmanager_;
 }
+#endif
+
+const egeg_ns::ScaledClock& egeg_ns::EasyEngine::clock() noexcept {
+    assert(impl_ && "エンジンの初期化が正常に終了していません。");
+    return impl_->clocks_.real;
+}
+
+egeg_ns::EngineClocks& egeg_ns::EasyEngine::clocks() noexcept {
+    assert(impl_ && "エンジンの初期化が正常に終了していません。");
+    return impl_->clocks_;
+}
+
+egeg_ns::FramePacer& egeg_ns::EasyEngine::pacer() noexcept {
+    assert(impl_&&impl_->pacer_ && "エンジンの初期化が正常に終了していません。");
+    return *impl_->pacer_;
+}
 
-const egeg_ns::Clock& egeg_ns::EasyEngine::clock() noexcept {
-    assert(impl_ && "GW̏ɏIĂ܂B");
-    return impl_->clock_;
+egeg_ns::FrameArena& egeg_ns::EasyEngine::frameArena() noexcept {
+    assert(impl_&&impl_->arena_ && "エンジンの初期化が正常に終了していません。");
+    return *impl_->arena_;
+}
+
+egeg_ns::FrameRecorder& egeg_ns::EasyEngine::recorder() noexcept {
+    assert(impl_&&impl_->recorder_ && "エンジンの初期化が正常に終了していません。");
+    return *impl_->recorder_;
+}
+
+egeg_ns::t_lib::JobSystem& egeg_ns::EasyEngine::jobs() noexcept {
+    assert(impl_&&impl_->jmanager_ && "エンジンの初期化が正常に終了していません。");
+    return *impl_->jmanager_;
+}
+
+egeg_ns::t_lib::MpscEventQueue<void()>& egeg_ns::EasyEngine::mainThreadQueue() noexcept {
+    assert(impl_&&impl_->equeue_ && "エンジンの初期化が正常に終了していません。");
+    return *impl_->equeue_;
+}
+
+egeg_ns::t_lib::EventBus& egeg_ns::EasyEngine::eventBus() noexcept {
+    assert(impl_&&impl_->ebus_ && "エンジンの初期化が正常に終了していません。");
+    return *impl_->ebus_;
 }
 
 egeg_ns::UpdateManager<egeg_ns::EasyEngine>& egeg_ns::EasyEngine::updator() noexcept {
-    assert(impl_&&impl_->umanager_ && "GW̏ɏIĂ܂B");
+    assert(impl_&&impl_->umanager_ && "エンジンの初期化が正常に終了していません。");
     return *impl_->umanager_;
 }
 
 egeg_ns::i_lib::InputManager& egeg_ns::EasyEngine::input() noexcept {
-    assert(impl_&&impl_->imanager_ && "GW̏ɏIĂ܂B");
+    assert(impl_&&impl_->imanager_ && "エンジンの初期化が正常に終了していません。");
     return *impl_->imanager_;
 }
 
+#ifdef _WIN32
 egeg_ns::g_lib::GraphicManager& egeg_ns::EasyEngine::graphics() noexcept {
-    assert(impl_&&impl_->gmanager_ && "GW̏ɏIĂ܂B");
+    assert(impl_ && "エンジンの初期化が正常に終了していません。");
+    assert(impl_->gmanager_ && "ヘッドレスモードでは描画マネージャーを使用できません。");
     return *impl_->gmanager_;
 }
+#endif
 
 /******************************************************************************
 
     EasyEngine::Impl::
 
 ******************************************************************************/
+#ifdef _WIN32
+// ウィンドウメッセージを処理しながら、メッセージが無い間にフレームを進める
+void egeg_ns::EasyEngine::Impl::windowLoop(const EngineConfig& Config) {
+    MSG msg{};
+    Clock clock{};
+    while(msg.message != WM_QUIT && !finished(Config)) {
+        // メッセージ処理
+        if( PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE) ) {
+            TranslateMessage( &msg );
+            DispatchMessage( &msg );
+        }
+        // ゲーム処理
+        else {
+            const Time elapsed = frame(beginFrame(Config, clock));
+            SetWindowText(wmanager_->handle(), std::to_wstring(elapsed.nanoseconds()).c_str());
+        }
+    }
+}
+#endif
+
+// ウィンドウを持たないため、メッセージを処理せずにフレームを進める
+void egeg_ns::EasyEngine::Impl::headlessLoop(const EngineConfig& Config) {
+    Clock clock{};
+    while(!finished(Config))
+        frame(beginFrame(Config, clock));
+}
+
+// フレームの開始を待ち、更新処理に渡す経過時間を求める
+//  実時間で実行する場合は、次のフレームの開始時刻まではスリープして待機する
+//  再生中は待機しない(経過時間は記録から取得する)
+egeg_ns::Time egeg_ns::EasyEngine::Impl::beginFrame(const EngineConfig& Config, Clock& FrameClock) {
+    if(recorder_->mode() == FrameRecorder::Mode::kReplay) return Time{};
+    if(!Config.real_time) return Config.fixed_delta;
+    pacer_->wait();
+    FrameClock.update();
+    const Time elapsed = FrameClock.elapsed();
+    FrameClock = Clock{};
+    return elapsed;
+}
+
+// 1フレーム分の処理
+//  記録、再生中は入力の更新直後に入力状態を記録、復元する
+//  戻り値は更新処理に渡した経過時間(再生中は記録された値)
+egeg_ns::Time egeg_ns::EasyEngine::Impl::frame(Time Elapsed) {
+    arena_->nextFrame();
+    equeue_->drainAll();
+    imanager_->update();
+    recorder_->beginFrame(Elapsed, *imanager_);
+    clocks_.real.advance(Elapsed);
+    umanager_->run(Elapsed);
+    ebus_->dispatch();
+    recorder_->endFrame(umanager_->size());
+    ++frames_;
+    EGEG_PROFILE_FRAME();
+    return Elapsed;
+}
+
+#ifdef _WIN32
 void egeg_ns::EasyEngine::Impl::WindowEventProcess(
   const HWND hWnd, const UINT Msg, const WPARAM wParam, const LPARAM lParam) {
     switch(Msg) {
@@ -171,4 +334,5 @@ void egeg_ns::EasyEngine::Impl::WindowEventProcess(
         break;
     }
 }
+#endif // _WIN32
 // EOF
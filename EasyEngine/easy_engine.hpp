@@ -1,27 +1,124 @@
 ///
 /// \file   easy_engine.hpp
-/// \brief  GWNX`wb_
+/// \brief  エンジンクラス定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/8/19
-///             - wb_ǉ
-///             - EasyEngine `
+///             - ヘッダ追加
+///             - EasyEngine 定義
+///         - 2026/10/19
+///             - ジョブシステムを追加
+///             - フレームペーサーを追加
+///             - メインスレッドのイベントキューを追加
+///             - イベントバスを追加
+///             - フレームアリーナを追加
+///             - EngineConfig 定義
+///             - ヘッドレスモードを追加
+///             - フレームの記録と再生を追加
+///             - 階層クロックを追加
+///             - ウィンドウ、描画、入力のサブシステムを前方宣言に変更
+///             - Windows 以外でのビルドに対応(ヘッドレスモードのみ)
+///             - EngineConfig にゲームループの開始、終了時に呼び出す関数を追加
+///             - clock() が更新されないクロックを返していたため、実時間のクロックを返すよう変更
 ///
 #ifndef INCLUDED_EGEG_EASY_ENGINE_HEADER_
 #define INCLUDED_EGEG_EASY_ENGINE_HEADER_
 
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include "noncopyable.hpp"
 #include "result.hpp"
-#include "window_manager.hpp"
+#include "egeg_state.hpp"
 #include "time.hpp"
+#include "scaled_clock.hpp"
+#include "frame_pacer.hpp"
+#include "frame_arena.hpp"
+#include "frame_recorder.hpp"
+#include "job_system.hpp"
+#include "mpsc_event_queue.hpp"
+#include "event_bus.hpp"
 #include "update_manager.hpp"
-#include "input_manager.hpp"
-#include "graphic_manager.hpp"
 
 namespace easy_engine {
+class WindowManager;
+namespace i_lib { class InputManager; }
+namespace g_lib { class GraphicManager; }
+
+/******************************************************************************
+
+    EngineConfig
+
+******************************************************************************/
+///
+/// \brief  エンジンの実行設定
+///
+///         使用例.) ウィンドウを生成せず、600フレームを最速で実行する(ベンチマーク、CI等)
+///             EngineConfig config;
+///             config.headless = true;
+///             config.real_time = false;
+///             config.max_frames = 600U;
+///             config.on_start = [&]{ task = EasyEngine::updator().registerTask(&game, &Game::update, 0U); };
+///             config.on_exit = [&]{ task.exitFromManager(); };
+///             EasyEngine::run(config);
+///
+struct EngineConfig {
+    ///
+    /// \brief  ヘッドレスモード
+    ///
+    ///         true の場合、ウィンドウと描画のサブシステムを生成せず、ウィンドウメッセージの処理も行いません。
+    ///         EasyEngine::window(), EasyEngine::graphics() は使用できないため、
+    ///         描画に関わる処理は EasyEngine::isHeadless() で確認してから行ってください。
+    ///         Windows 以外では、ウィンドウと描画のサブシステムがビルドされないため、常にヘッドレスモードで実行します。
+    ///
+    bool headless = false;
+
+    ///
+    /// \brief  実時間で実行するか
+    ///
+    ///         true の場合、フレームペーサーでフレームの開始時刻を待ち、実際の経過時間を更新処理に渡します。
+    ///         false の場合は待機せずに次のフレームを開始し、経過時間として常に fixed_delta を渡します。
+    ///         (実行速度に依らず、同じ経過時間の列で更新処理が行われます。)
+    ///
+    bool real_time = true;
+
+    uint64_t max_frames = 0U;   ///< 実行するフレーム数 0 の場合は終了が要求されるまで実行
+    Time fixed_delta = Microseconds{kTPF<std::micro>}; ///< real_time が false の場合の1フレームの経過時間
+
+    ///
+    /// \brief  フレームを記録するファイルのパス
+    ///
+    ///         nullptr 以外の場合、フレーム毎の経過時間と入力状態等を記録し、終了時に書き出します。
+    /// \see    FrameRecorder
+    ///
+    const char* record_path = nullptr;
+
+    ///
+    /// \brief  再生するファイルのパス
+    ///
+    ///         nullptr 以外の場合、記録したフレームを待機せずに再生し、最後のフレームで終了します。
+    ///         real_time, fixed_delta は無視し、記録した経過時間を使用します。record_path より優先します。
+    ///         再生結果と記録の比較は EasyEngine::recorder().stats() で取得できます。
+    ///
+    const char* replay_path = nullptr;
+
+    ///
+    /// \brief  ゲームループの開始前に呼び出す関数
+    ///
+    ///         全てのサブシステムの生成後に呼び出します。更新タスクの登録等に使用してください。
+    ///
+    std::function<void()> on_start;
+
+    ///
+    /// \brief  ゲームループの終了後に呼び出す関数
+    ///
+    ///         サブシステムの破棄前に呼び出します。登録した更新タスクの解除等に使用してください。
+    ///
+    std::function<void()> on_exit;
+};
+
 
 /******************************************************************************
 
@@ -29,23 +126,51 @@ namespace easy_engine {
 
 ******************************************************************************/
 ///
-/// \brief  GW{
+/// \brief  エンジン本体
 ///
-///         TuVXẽ[gł܂B
+///         サブシステムのルートでもあります。
+///         ウィンドウ、入力、描画のマネージャーは前方宣言のみのため、
+///         使用する場合は window_manager.hpp, input_manager.hpp, graphic_manager.hpp をインクルードしてください。
 ///
 class EasyEngine final : t_lib::Noncopyable<EasyEngine> {
 public :
-    static void run();
+    ///
+    /// \brief  エンジンを起動し、終了するまでゲームループを実行
+    ///
+    /// \param[in] Config : 実行設定
+    ///
+    static void run(const EngineConfig& Config=EngineConfig{});
+
+    ///
+    /// \brief  ゲームループの終了を要求
+    ///
+    ///         現在のフレームの処理が終わった後に終了します。
+    ///
+    static void exit() noexcept;
+
+    static bool isHeadless() noexcept;
+    static uint64_t frameCount() noexcept; // 開始してから処理したフレーム数
 
+#ifdef _WIN32
     static WindowManager& window() noexcept;
-    static const Clock& clock() noexcept;
+#endif
+    static const ScaledClock& clock() noexcept; // 実時間のクロック(clocks().real)
+    static EngineClocks& clocks() noexcept; // 毎フレーム、更新処理の前に進める
+    static FramePacer& pacer() noexcept;
+    static FrameArena& frameArena() noexcept; // フレームの先頭で切り替える(確保した領域は次のフレームまで有効)
+    static FrameRecorder& recorder() noexcept;
+    static t_lib::JobSystem& jobs() noexcept;
+    static t_lib::MpscEventQueue<void()>& mainThreadQueue() noexcept; // フレームの先頭でメインスレッドから呼び出す
+    static t_lib::EventBus& eventBus() noexcept; // フレームの終わり(更新処理の後)に配信する
     static UpdateManager<EasyEngine>& updator() noexcept;
     static i_lib::InputManager& input() noexcept;
+#ifdef _WIN32
     static g_lib::GraphicManager& graphics() noexcept;
+#endif
 
 private :
     EasyEngine() = default;
-    static t_lib::DetailedResult<bool, const char*> startUp();
+    static t_lib::DetailedResult<bool, const char*> startUp(const EngineConfig& Config);
     static void shutDown() noexcept;
 
     struct Impl;
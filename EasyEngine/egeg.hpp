@@ -1,18 +1,20 @@
 ///
 /// \file   egeg.hpp
-/// \brief  EasyEngine̋@\SĊ܂ރwb_
+/// \brief  EasyEngineの機能を全て含むヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/7/23
-///             - wb_[ǉ
-///             - OԂ`
+///             - ヘッダー追加
+///             - 名前空間を定義
 ///         - 2020/9/2
-///             - Oԕʖ錾
-///             - EasyEngineCN[hAʖ`
+///             - 名前空間別名宣言
+///             - EasyEngineインクルード、別名定義
 ///         - 2020/9/3
-///             - pOԂ錾
+///             - 物理用名前空間を宣言
+///         - 2026/10/19
+///             - ウィンドウ、入力、描画マネージャーのインクルードを追加
 ///
 #ifndef INCLUDED_EGEG_HEADER_
 #define INCLUDED_EGEG_HEADER_
@@ -22,7 +24,7 @@
     namespace
 
 ******************************************************************************/
-namespace easy_engine { // EasyEnginepO
+namespace easy_engine { // EasyEngine用名前空間
     namespace a_lib{}
     namespace g_lib{}
     namespace i_lib{}
@@ -31,13 +33,13 @@ namespace easy_engine { // EasyEngine
     namespace t_lib{}
 } // namespace easy_engine
 
-namespace egeg          = easy_engine;          // EasyEnginepO
-namespace egeg_audio    = easy_engine::a_lib;   // I[fBIpO
-namespace egeg_graphics = easy_engine::g_lib;   // `pO
-namespace egeg_input    = easy_engine::i_lib;   // ͗pO
-namespace egeg_math     = easy_engine::m_lib;   // wpO
-namespace egeg_physics  = easy_engine::p_lib;   // pO
-namespace egeg_template = easy_engine::t_lib;   // ev[gpO
+namespace egeg          = easy_engine;          // EasyEngine用名前空間
+namespace egeg_audio    = easy_engine::a_lib;   // オーディオ用名前空間
+namespace egeg_graphics = easy_engine::g_lib;   // 描画用名前空間
+namespace egeg_input    = easy_engine::i_lib;   // 入力用名前空間
+namespace egeg_math     = easy_engine::m_lib;   // 数学用名前空間
+namespace egeg_physics  = easy_engine::p_lib;   // 物理用名前空間
+namespace egeg_template = easy_engine::t_lib;   // テンプレート用名前空間
 
 /******************************************************************************
 
@@ -45,6 +47,11 @@ namespace egeg_template = easy_engine::t_lib;   // 
 
 ******************************************************************************/
 #include "easy_engine.hpp"
+#include "input_manager.hpp"
+#ifdef _WIN32
+#include "window_manager.hpp"
+#include "graphic_manager.hpp"
+#endif
 
 /******************************************************************************
 
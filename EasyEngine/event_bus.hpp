@@ -0,0 +1,346 @@
+///
+/// \file   event_bus.hpp
+/// \brief  イベントバス定義ヘッダ
+///
+/// \author 板場
+///
+/// \par    履歴
+///         - 2026/10/19
+///             - ヘッダ追加
+///             - EventSpan<…> 定義
+///             - EventSubscription 定義
+///             - EventBus 定義
+///             - EventBus::pending<…> をチャンネルを作成しない検索に変更
+///
+#ifndef INCLUDED_EGEG_TLIB_EVENT_BUS_HEADER_
+#define INCLUDED_EGEG_TLIB_EVENT_BUS_HEADER_
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "inplace_function.hpp"
+#include "noncopyable.hpp"
+
+namespace easy_engine {
+namespace t_lib {
+
+class EventBus;
+
+/******************************************************************************
+
+    EventSpan
+
+******************************************************************************/
+///
+/// \brief  イベント列の参照
+///
+///         購読者に渡す、同じ型のイベントの連続した列です。
+///         参照先は呼び出しの間のみ有効です。
+///
+/// \tparam EventTy : イベント型
+///
+template <class EventTy>
+class EventSpan {
+public :
+    using value_type = EventTy;
+    using iterator = const EventTy*;
+
+    constexpr EventSpan() noexcept = default;
+    constexpr EventSpan(const EventTy* Data, const size_t Size) noexcept : data_{Data}, size_{Size} {}
+
+    constexpr const EventTy* data() const noexcept { return data_; }
+    constexpr size_t size() const noexcept { return size_; }
+    constexpr bool empty() const noexcept { return size_ == 0U; }
+    constexpr iterator begin() const noexcept { return data_; }
+    constexpr iterator end() const noexcept { return data_+size_; }
+    constexpr const EventTy& operator[](const size_t Index) const noexcept { return data_[Index]; }
+
+private :
+    const EventTy* data_ = nullptr;
+    size_t size_ = 0U;
+};
+
+
+/******************************************************************************
+
+    EventSubscription
+
+******************************************************************************/
+///
+/// \brief  購読の登録情報
+///
+///         EventBus::subscribe の戻り値です。
+///         破棄されると購読を解除します。
+///
+/// \attention 登録したイベントバスより先に破棄してください。
+///
+class EventSubscription final : Noncopyable<EventSubscription> {
+public :
+    friend EventBus;
+
+    EventSubscription() noexcept = default;
+    EventSubscription(EventSubscription&& Right) noexcept :
+        bus_{std::exchange(Right.bus_, nullptr)}, type_{Right.type_}, id_{Right.id_} {}
+    EventSubscription& operator=(EventSubscription&& Right) noexcept {
+        if(this != &Right) {
+            unsubscribe();
+            bus_ = std::exchange(Right.bus_, nullptr);
+            type_ = Right.type_;
+            id_ = Right.id_;
+        }
+        return *this;
+    }
+    ~EventSubscription() { unsubscribe(); }
+
+    /// 購読を解除
+    void unsubscribe() noexcept;
+    /// 購読中かどうか
+    bool isSubscribed() const noexcept { return bus_ != nullptr; }
+
+private :
+    EventSubscription(EventBus* Bus, const size_t Type, const uint32_t ID) noexcept :
+        bus_{Bus}, type_{Type}, id_{ID} {}
+
+    EventBus* bus_ = nullptr;
+    size_t type_ = 0U;
+    uint32_t id_ = 0U;
+};
+
+
+/******************************************************************************
+
+    EventBus
+
+******************************************************************************/
+///
+/// \brief  型毎のイベントバス
+///
+///         イベントを型毎のバッファに溜め、dispatch でまとめて購読者に配信します。
+///         購読者は、溜まったイベントの列(EventSpan<…>)を1回の呼び出しで受け取ります。
+///         イベント1つ毎に全ての購読者を呼び出す方式と比べ、呼び出しの回数がイベントの数に比例しません。
+///         使用例.)
+///             auto sub = bus.subscribe<Damage>([this](EventSpan<Damage> Events) {
+///                 for(auto& damage : Events) hp_[damage.target] -= damage.amount;
+///             });
+///             bus.publish(Damage{target, 10});    // バッファに追加
+///             bus.dispatch();                     // まとめて配信
+///
+///         setImmediate で即時モードにした型は、バッファに溜めずに発行時に配信します。(イベント1つの列)
+///
+///         配信は型毎に、その型を最初に発行、または購読した順に行います。
+///         配信中に発行したイベントは、次回の dispatch で配信します。
+///         配信中の購読の登録と解除(自身を含む)は、その型の配信の終了後に反映します。
+///
+/// \attention スレッドセーフではありません。同じスレッドから操作してください。
+///
+class EventBus final : Noncopyable<EventBus> {
+public :
+    friend EventSubscription;
+
+    template <class EventTy>
+    using Handler = InplaceFunction<void(EventSpan<EventTy>)>;
+
+    ///
+    /// \brief  イベントを発行
+    ///
+    /// \param[in] Event : 発行するイベント
+    ///
+    template <class EventTy>
+    void publish(EventTy&& Event) {
+        channel<std::decay_t<EventTy>>().publish(std::forward<EventTy>(Event));
+    }
+    ///
+    /// \brief  イベントを構築して発行
+    ///
+    /// \tparam EventTy : イベント型
+    /// \param[in] Args : イベントの構築に使用する引数
+    ///
+    template <class EventTy, class ...ArgTypes>
+    void emplace(ArgTypes&& ...Args) {
+        channel<EventTy>().publish(std::forward<ArgTypes>(Args)...);
+    }
+
+    ///
+    /// \brief  購読を登録
+    ///
+    ///         登録例.) auto sub = bus.subscribe<Damage>(&hoge, &HogeClass::onDamage);
+    ///
+    /// \tparam EventTy : 購読するイベント型
+    /// \param[in] Function : イベント列を受け取る関数
+    ///
+    /// \return 購読の登録情報
+    ///
+    template <class EventTy>
+    [[nodiscard]] EventSubscription subscribe(Handler<EventTy> Function) {
+        const uint32_t id = ++last_id_;
+        channel<EventTy>().subscribe(std::move(Function), id);
+        return EventSubscription{this, typeIndex<EventTy>(), id};
+    }
+    template <class EventTy, class OwnerTy>
+    [[nodiscard]] EventSubscription subscribe(OwnerTy* Owner, void(OwnerTy::*Function)(EventSpan<EventTy>)) {
+        return subscribe<EventTy>([Owner, Function](const EventSpan<EventTy> Events) { (Owner->*Function)(Events); });
+    }
+
+    ///
+    /// \brief  即時モードの設定
+    ///
+    ///         有効にすると、発行したイベントをバッファに溜めず、その場で配信します。
+    ///         有効にした時点で溜まっているイベントは、次回の dispatch で配信します。
+    ///
+    template <class EventTy>
+    void setImmediate(const bool Enable) { channel<EventTy>().immediate_ = Enable; }
+
+    ///
+    /// \brief  溜まっているイベントを配信
+    ///
+    ///         全ての型について、溜まっているイベントを配信してバッファを空にします。
+    ///         配信中の型の dispatch は何もしません。
+    ///
+    void dispatch() {
+        for(size_t i = 0U; i < channels_.size(); ++i) channels_[i]->dispatch();
+    }
+    template <class EventTy>
+    void dispatch() {
+        if(auto* found = find<EventTy>()) found->dispatch();
+    }
+
+    /// 溜まっているイベントの数(発行、購読していない型は 0)
+    template <class EventTy>
+    size_t pending() const noexcept {
+        const auto* found = find<EventTy>();
+        return found ? found->pending_.size() : 0U;
+    }
+
+    /// 溜まっているイベントを配信せずに破棄
+    void clear() {
+        for(auto& channel : channels_) channel->clear();
+    }
+
+private :
+    struct ChannelBase {
+        virtual ~ChannelBase() = default;
+        virtual void dispatch() = 0;
+        virtual void clear() = 0;
+        virtual void unsubscribe(uint32_t ID) noexcept = 0;
+    };
+
+    // 型毎のバッファと購読者
+    template <class EventTy>
+    struct Channel final : ChannelBase {
+        struct Subscriber {
+            Handler<EventTy> handler;
+            uint32_t id;
+        };
+
+        template <class ...ArgTypes>
+        void publish(ArgTypes&& ...Args) {
+            if(!immediate_) {
+                if constexpr(std::is_constructible_v<EventTy, ArgTypes...>) pending_.emplace_back(std::forward<ArgTypes>(Args)...);
+                else pending_.push_back(EventTy{std::forward<ArgTypes>(Args)...}); // 集成体
+                return;
+            }
+            const EventTy event{std::forward<ArgTypes>(Args)...};
+            deliver(EventSpan<EventTy>{&event, 1U});
+        }
+        void subscribe(Handler<EventTy>&& Function, const uint32_t ID) {
+            if(depth_ > 0U) added_.push_back(Subscriber{std::move(Function), ID});
+            else            subscribers_.push_back(Subscriber{std::move(Function), ID});
+        }
+        void unsubscribe(const uint32_t ID) noexcept override {
+            for(auto& subscriber : subscribers_) {
+                if(subscriber.id != ID) continue;
+                subscriber.id = 0U; // 呼び出し中である可能性があるため、取り除くのは配信の終了後
+                ++num_removed_;
+                if(depth_ == 0U) apply();
+                return;
+            }
+            for(auto itr = added_.begin(); itr != added_.end(); ++itr) {
+                if(itr->id == ID) { added_.erase(itr); return; }
+            }
+        }
+        void dispatch() override {
+            if(depth_ > 0U || pending_.empty()) return;
+            delivering_.swap(pending_);
+            struct Clear { std::vector<EventTy>& events; ~Clear() { events.clear(); } } clear{delivering_};
+            deliver(EventSpan<EventTy>{delivering_.data(), delivering_.size()});
+        }
+        void clear() override { pending_.clear(); }
+
+        void deliver(const EventSpan<EventTy> Events) {
+            struct Depth { Channel& self; ~Depth() { if(--self.depth_ == 0U) self.apply(); } } depth{*this};
+            ++depth_;
+            const size_t size = subscribers_.size(); // 配信中の追加は added_ に入るため、移動しない
+            for(size_t i = 0U; i < size; ++i) {
+                if(subscribers_[i].id != 0U) subscribers_[i].handler(Events);
+            }
+        }
+        void apply() {
+            if(num_removed_ > 0U) {
+                subscribers_.erase(
+                    std::remove_if(subscribers_.begin(), subscribers_.end(), [](const Subscriber& S) { return S.id == 0U; }),
+                    subscribers_.end());
+                num_removed_ = 0U;
+            }
+            for(auto& subscriber : added_) subscribers_.push_back(std::move(subscriber));
+            added_.clear();
+        }
+
+        std::vector<EventTy> pending_;
+        std::vector<EventTy> delivering_;
+        std::vector<Subscriber> subscribers_;
+        std::vector<Subscriber> added_;     // 配信中に登録された購読者
+        size_t num_removed_ = 0U;
+        uint32_t depth_ = 0U;               // 配信の入れ子の深さ(即時モードの発行による)
+        bool immediate_ = false;
+    };
+
+    // 型毎の連番(全てのバスで共通)
+    //  発行の度に検索するため、TypeIDGenerator<…>の値のハッシュではなく、連番による配列の添え字で検索する
+    static std::atomic<size_t>& typeCount() noexcept {
+        static std::atomic<size_t> count{0U};
+        return count;
+    }
+    template <class EventTy>
+    static size_t typeIndex() noexcept {
+        static const size_t index = typeCount().fetch_add(1U, std::memory_order_relaxed);
+        return index;
+    }
+
+    template <class EventTy>
+    Channel<EventTy>& channel() {
+        static_assert(std::is_same_v<EventTy, std::decay_t<EventTy>>, "'EventTy' must be unqualified type");
+        const size_t type = typeIndex<EventTy>();
+        if(type >= table_.size()) table_.resize(type+1U, nullptr);
+        if(!table_[type]) {
+            channels_.push_back(std::make_unique<Channel<EventTy>>());
+            table_[type] = channels_.back().get();
+        }
+        return static_cast<Channel<EventTy>&>(*table_[type]);
+    }
+    // 作成せずに検索(無ければ nullptr)
+    template <class EventTy>
+    Channel<EventTy>* find() const noexcept {
+        const size_t type = typeIndex<EventTy>();
+        return type < table_.size() ? static_cast<Channel<EventTy>*>(table_[type]) : nullptr;
+    }
+
+    std::vector<std::unique_ptr<ChannelBase>> channels_;    // 配信順
+    std::vector<ChannelBase*> table_;                       // 型の連番 -> チャンネル
+    uint32_t last_id_ = 0U;
+};
+
+inline void EventSubscription::unsubscribe() noexcept {
+    if(!bus_) return;
+    bus_->table_[type_]->unsubscribe(id_);
+    bus_ = nullptr;
+}
+
+} // namespace t_lib
+} // namespace easy_engine
+#endif // !INCLUDED_EGEG_TLIB_EVENT_BUS_HEADER_
+// EOF
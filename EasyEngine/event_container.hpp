@@ -1,31 +1,31 @@
 ///
 /// \file   event_container.hpp
-/// \brief  Cxg(֐IuWFNg)ReiQ`wb_
+/// \brief  イベント(関数オブジェクト)コンテナ群定義ヘッダ
 ///
-///         W̃ReiɊ֐IuWFNgoƂĎꍇ
-///         ȒPɋLqł悤ɂ邽߂̒`QłB
-///         Container<std::function<void()>> ƋLqƂ Container<void()> ̂悤ɋLq邱Ƃł܂B
+///         標準のコンテナに関数オブジェクトをメンバとして持たせたい場合に
+///         少し簡単に記述できるようにするための定義群です。
+///         Container<std::function<void()>> と記述するところを Container<void()> のように記述することができます。
 ///
-/// \author 
+/// \author 板場
 ///
-/// \note   setnReíARpCʂȂߖB\n
-///         std::function<c>KvȉZq`ĂȂƂƗ\zB
+/// \note   set系コンテナは、コンパイルが通らないため無し。\n
+///         std::function<…>が必要な演算子を定義していないことが原因だと予想。
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/7/23
-///             - wb_ǉ
-///             - EventStack<c> `
+///             - ヘッダ追加
+///             - EventStack<…> 定義
 ///         - 2020/7/24
-///             - EventQueue<c> `
-///             - EventStack, EventQueue : CxgĂяo̗OAڍׂȂ̂ɕύX
-///             - ɈȂȂA"ق"SẴReiɂĊȈՋLqpGCAXǉ
+///             - EventQueue<…> 定義
+///             - EventStack, EventQueue : イベント呼び出し時の例外を、より詳細なものに変更
+///             - 引くに引けなくなり、"ほぼ"全てのコンテナについて簡易記述用エイリアスを追加
 ///         - 2020/7/25
-///             - setnReiɊւʖ폜
-///             - Ăяo\IuWFNg^wł EventType<c>`
+///             - set系コンテナに関する別名を削除
+///             - 呼び出し可能オブジェクト型を指定できる EventType<…>を定義
 ///         - 2020/7/27
-///             - OopA񃁃o֐`
+///             - 例外送出用、非メンバ関数定義
 ///         - 2020/8/21
-///             - Event RZvgC(std::is_invocable_vstd::is_member_function_pointer_v)
+///             - Event コンセプト修正(std::is_invocable_vからstd::is_member_function_pointer_vへ)
 ///
 #ifndef INCLUDED_EGEG_TLIB_FACTORY_HEADER_
 #define INCLUDED_EGEG_TLIB_FACTORY_HEADER_
@@ -69,19 +69,19 @@ namespace t_lib {
 
 ******************************************************************************/
 ///
-/// \brief  CxgX^bN
+/// \brief  イベントスタック
 ///
-///         LIFO̓CxgReiłB
-///         std::stack̃bp[NXłBڍׂstd::stack̃t@XQƂĂB
+///         LIFOの動作をするイベントコンテナです。
+///         std::stackのラッパークラスです。詳細はstd::stackのリファレンスを参照してください。
 ///
 /// \see https://cpprefjp.github.io/reference/stack.html
 ///
-/// \tparam FTy : Cxg֐̊֐^
-/// \tparam ContainerTy : std::stack̓ɗpRei^
+/// \tparam FTy : イベント関数の関数型
+/// \tparam ContainerTy : std::stackの内部実装に用いるコンテナ型
 ///
-/// \details ^ ߂l^(^Xg) ̌`Ŏw肵܂B\n
-///          .) ߂l voidŁA1 int󂯎CxgێRei\n
-///          EventStack<void(int)> ƂĐ錾܂B
+/// \details 第一型仮引数は 戻り値型(引数型リスト) の形で指定します。\n
+///          例.) 戻り値が voidで、引数に1つの int受け取るイベントを保持するコンテナは\n
+///          EventStack<void(int)> として宣言します。
 ///
 template <class FTy, template <class> class ContainerTy=std::deque>
 class EventStack : std::stack<event_impl::EventType<FTy>, ContainerTy<event_impl::EventType<FTy>>> {
@@ -102,15 +102,15 @@ public :
 
   // functions
     ///
-    /// \brief  擪̃CxgĂяo
+    /// \brief  先頭のイベントを呼び出す
     ///
-    ///         łVǉꂽCxgĂяo܂B
-    ///         ĂяoCxg̓ReiɎc܂B
+    ///         最も新しく追加されたイベントを呼び出します。
+    ///         呼び出したイベントはコンテナ内に残ります。
     ///
-    /// \tparam ArgTypes_   : Cxgɓn^Xg
-    /// \param[in] Args     : CxgɓnXg
+    /// \tparam ArgTypes_   : イベントに渡す引数型リスト
+    /// \param[in] Args     : イベントに渡す引数リスト
     ///
-    /// \return ĂяoCxgԂl
+    /// \return 呼び出したイベントから返った値
     ///
     template <class ...ArgTypes_>
     ResultType call(ArgTypes_&& ...Args) {
@@ -120,15 +120,15 @@ public :
     }
     
     ///
-    /// \brief  擪̃CxgĂяoĂj
+    /// \brief  先頭のイベントを呼び出してから破棄
     ///
-    ///         łVǉꂽCxgĂяo܂B
-    ///         ĂяoCxg̓Reij܂B
+    ///         最も新しく追加されたイベントを呼び出します。
+    ///         呼び出したイベントはコンテナから破棄されます。
     ///
-    /// \tparam ArgTypes_   : Cxgɓn^Xg
-    /// \param[in] Args     : CxgɓnXg
+    /// \tparam ArgTypes_   : イベントに渡す引数型リスト
+    /// \param[in] Args     : イベントに渡す引数リスト
     ///
-    /// \return ĂяoCxgԂl
+    /// \return 呼び出したイベントから返った値
     ///
     template <class ...ArgTypes_>
     ResultType pop_with_call(ArgTypes_&& ...Args) {
@@ -146,18 +146,18 @@ public :
 
 ******************************************************************************/
 ///
-/// \brief  CxgL[
+/// \brief  イベントキュー
 ///
-///         FIFO̓CxgReiłB
-///         std::queuẽbp[NXłBڍׂstd::queuẽt@XQƂĂB
+///         FIFOの動作をするイベントコンテナです。
+///         std::queueのラッパークラスです。詳細はstd::queueのリファレンスを参照してください。
 ///
 /// \see https://cpprefjp.github.io/reference/queue/queue.html
 ///
-/// \tparam FTy : Cxg֐̊֐^
-/// \param[in] ContainerTy : std::queue̓ɗpRei^
+/// \tparam FTy : イベント関数の関数型
+/// \param[in] ContainerTy : std::queueの内部実装に用いるコンテナ型
 ///
-/// \details ^ ߂l^(^Xg) ̌`Ŏw肵܂B\n
-///          ɂāAEventStack<c>̏ڍׂQƂĂB
+/// \details 第一型仮引数は 戻り値型(引数型リスト) の形で指定します。\n
+///          例について、EventStack<…>の詳細を参照してください。
 ///          
 /// \see EventStack
 ///
@@ -178,31 +178,31 @@ public :
     using ContainerType::swap;
 
     ///
-    /// \brief  擪̃Cxg擾
+    /// \brief  先頭のイベントを取得する
     ///
-    /// \return std::queue<c>::front() ̌Ăяo
+    /// \return std::queue<…>::front() の呼び出し結果
     ///
     [[nodiscard]] typename ContainerType::reference top() noexcept(noexcept(ContainerType::front())) {
         return ContainerType::front();
     }
 
-    /// \brief  擪̃Cxg擾
+    /// \brief  先頭のイベントを取得する
     ///
-    /// \return const std::queue<c>::front() ̌Ăяo
+    /// \return const std::queue<…>::front() の呼び出し結果
     ///
     [[nodiscard]] typename ContainerType::const_reference top() const noexcept(noexcept(ContainerType::front())) {
         return ContainerType::front();
     }
 
-    /// \brief  擪̃CxgĂяo
+    /// \brief  先頭のイベントを呼び出す
     ///
-    ///         ێĂłÂCxgĂяo܂B
-    ///         ĂяoCxg̓ReiɎc܂B
+    ///         保持している最も古いイベントを呼び出します。
+    ///         呼び出したイベントはコンテナ内に残ります。
     ///
-    /// \tparam ArgTypes_   : Cxgɓn^Xg
-    /// \param[in] Args     : CxgɓnXg
+    /// \tparam ArgTypes_   : イベントに渡す引数型リスト
+    /// \param[in] Args     : イベントに渡す引数リスト
     ///
-    /// \return ĂяoCxgԂl
+    /// \return 呼び出したイベントから返った値
     ///
     template <class ...ArgTypes_>
     ResultType call(ArgTypes_&& ...Args) {
@@ -212,15 +212,15 @@ public :
     }
 
     ///
-    /// \brief  擪̃CxgĂяoĂj
+    /// \brief  先頭のイベントを呼び出してから破棄
     ///
-    ///         ێĂłÂCxgĂяo܂B
-    ///         ĂяoCxg̓Reij܂B
+    ///         保持している最も古いイベントを呼び出します。
+    ///         呼び出したイベントはコンテナから破棄されます。
     ///
-    /// \tparam ArgTypes_   : Cxgɓn^Xg
-    /// \param[in] Args     : CxgɓnXg
+    /// \tparam ArgTypes_   : イベントに渡す引数型リスト
+    /// \param[in] Args     : イベントに渡す引数リスト
     ///
-    /// \return ĂяoCxgԂl
+    /// \return 呼び出したイベントから返った値
     ///
     template <class ...ArgTypes_>
     ResultType pop_with_call(ArgTypes_&& ...Args) {
@@ -1,15 +1,15 @@
 ///
 /// \file   field.hpp
-/// \brief  tB[h֌W`wb_
+/// \brief  フィールド関係定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/7/26
-///             - wb_ǉ
-///             - Field<c> `
-///             - FieldTag<c> `
-///             - ⏕`A錾(IsField, TypeIndex, AlwaysTrue)
+///             - ヘッダ追加
+///             - Field<…> 定義
+///             - FieldTag<…> 定義
+///             - 補助定義、宣言(IsField, TypeIndex, AlwaysTrue)
 ///
 #ifndef INCLUDED_EGEG_TLIB_FIELD_HEADER_
 #define INCLUDED_EGEG_TLIB_FIELD_HEADER_
@@ -49,21 +49,21 @@ using FieldTag = Field<ETy, field_impl::TypeIndex<NIndex, TIndex>, PredTy>;
 
 ******************************************************************************/
 ///
-/// \brief  tB[h
+/// \brief  フィールド
 ///
-///         oIIuWFNgłB
-///         3^ɁA`FbNt@N^w肷邱Ƃł܂B
+///         メンバ的オブジェクトです。
+///         第3型引数に、代入条件をチェックするファンクタを指定することができます。
 ///
-/// \tparam ElemTy : tB[hvf^
-/// \tparam IndexTy   : vf^̃tB[hʂCfbNX
-/// \tparam PredTy    : ۔t@N^
+/// \tparam ElemTy : フィールド要素型
+/// \tparam IndexTy   : 同一要素型のフィールドを区別するインデックス
+/// \tparam PredTy    : 代入可否判定ファンクタ
 ///
-/// \details t@N^͑\̒lconstQƂŎ󂯎Aboolԋpoperator()`Kv܂B\n
-///          ̂ƂAtrueősAfalseł͑s܂B\n
-///          Ԃێt@N^ꍇARXgN^ŏKv܂B\n
-///          vf^ł΁AقȂtB[hԂő\łB\n
-///          ̎ɑ̂͗vf݂̂ŁA۔t@N^e󂯂邱Ƃ͂܂B\n
-///          ۔t@N^ύXꍇ́AsetPredicate()gpĉB
+/// \details ファンクタは代入予定の値をconst参照で受け取り、boolを返却するoperator()を定義する必要があります。\n
+///          このとき、trueで代入が行われ、falseでは代入が行われません。\n
+///          状態を保持するファンクタを持たせる場合、コンストラクタで初期化する必要があります。\n
+///          要素型が同一であれば、異なるフィールド間で代入処理が可能です。\n
+///          その時に代入されるのは要素のみで、代入可否判定ファンクタが影響を受けることはありません。\n
+///          代入可否判定ファンクタを変更したい場合は、setPredicate()を使用して下さい。
 /// 
 template <class ElemTy, class IndexTy, class PredTy=field_impl::AlwaysTrue<ElemTy>>
 class Field : private PredTy {
@@ -85,21 +85,21 @@ public :
         : Field{std::forward<Ty>(Right), std::forward<PTy>(Pred), field_impl::IsField<std::decay_t<Ty>>{}} {}
 
     ///
-    /// \brief  lZbg
+    /// \brief  値をセット
     ///
-    ///         tB[h̃ZbgAl̃Zbgǂ\łB
-    ///         ۔t@N^͕ύX܂B
+    ///         フィールドのセット、値のセットどちらも可能です。
+    ///         代入可否判定ファンクタは変更されません。
     ///
-    /// \tparam Ty   : Zbgľ^
-    /// \param Right : Zbgl
+    /// \tparam Ty   : セットする値の型
+    /// \param Right : セットする値
     ///
-    /// \return ZbgtB[hւ̎Q
+    /// \return セット後フィールドへの参照
     ///
     template <class Ty>
     Field& operator=(Ty&& Right) noexcept(noexcept(assign(std::forward<Ty>(Right),field_impl::IsField<std::decay_t<Ty>>{}))){
         return assign(std::forward<Ty>(Right), field_impl::IsField<std::decay_t<Ty>>{});
     }
-    ///< operator=l
+    ///< operator=同様
     template <class Ty>
     void set(Ty&& Right) noexcept(noexcept(*this = std::forward<Ty>(Right))) {
         *this = std::forward<Ty>(Right);
@@ -113,13 +113,13 @@ public :
     }
 
     ///
-    /// \brief  ۃt@N^Zbg
+    /// \brief  代入可否ファンクタをセット
     ///
-    ///         Field<c>::PredTypeɃRs[\A̓[u\ȃt@N^̂ݎ󂯕t܂B
-    ///         ۃt@N^̌^ƕϊ邱Ƃ͂ł܂B
+    ///         Field<…>::PredTypeにコピー可能、もしくはムーブ可能なファンクタのみ受け付けます。
+    ///         代入可否ファンクタの型ごと変換することはできません。
     ///
-    /// \tparam PredTy_ : Zbgt@N^̌^
-    /// \param[in] Pred : Zbgt@N^
+    /// \tparam PredTy_ : セットするファンクタの型
+    /// \param[in] Pred : セットするファンクタ
     ///
     template <class PredTy_>
     void setPredicate(PredTy_&& Pred) noexcept(noexcept(*static_cast<PredType*>(this) = std::forward<PredTy_>(Pred))) {
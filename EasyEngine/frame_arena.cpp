@@ -0,0 +1,149 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include "frame_arena.hpp"
+#include <algorithm>
+#include <new>
+#include <thread>
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace egeg_ns = easy_engine;
+namespace {
+    std::atomic<uint64_t> g_last_id{0U};
+
+    // スレッド毎に、直前に使用したアリーナの領域をキャッシュする
+    struct LocalCache {
+        uint64_t arena_id = 0U;
+        void* arena = nullptr;
+    };
+    thread_local LocalCache t_cache;
+
+    // Ptr を Alignment の倍数に揃えるためのバイト数
+    size_t alignPadding(const std::byte* Ptr, const size_t Alignment) noexcept {
+        return (0U - reinterpret_cast<uintptr_t>(Ptr)) & (Alignment-1U);
+    }
+} // unnamed namespace
+
+// 1スレッド分の領域
+struct egeg_ns::FrameArena::ThreadArena {
+    struct Block {
+        std::unique_ptr<std::byte[]> memory;
+        size_t size;
+    };
+    struct Buffer {
+        std::vector<Block> blocks;
+        std::byte* ptr = nullptr;
+        std::byte* end = nullptr;
+        size_t used = 0U;   // このフレームで確保したバイト数
+
+        size_t capacity() const noexcept {
+            size_t size = 0U;
+            for(auto& block : blocks) size += block.size;
+            return size;
+        }
+        void addBlock(const size_t Size) {
+            blocks.push_back(Block{std::unique_ptr<std::byte[]>{new std::byte[Size]}, Size}); // 初期化しない
+            ptr = blocks.back().memory.get();
+            end = ptr + Size;
+        }
+        // 領域を再利用可能にする
+        //  複数のブロックを使用していた場合は、合計サイズの1つのブロックにまとめる
+        void reset() {
+            used = 0U;
+            if(blocks.size() > 1U) {
+                const size_t size = capacity();
+                blocks.clear();
+                addBlock(size);
+            }
+            else if(!blocks.empty()) {
+                ptr = blocks.front().memory.get();
+                end = ptr + blocks.front().size;
+            }
+        }
+    };
+
+    std::thread::id thread;
+    Buffer buffers[kMaxBuffers];
+};
+
+
+/******************************************************************************
+
+    FrameArena::
+
+******************************************************************************/
+egeg_ns::FrameArena::FrameArena(const uint32_t NumBuffers, const size_t BlockSize) :
+    num_buffers_{std::clamp(NumBuffers, 1U, kMaxBuffers)},
+    block_size_{std::max<size_t>(BlockSize, 1024U)},
+    id_{++g_last_id} {}
+
+egeg_ns::FrameArena::~FrameArena() = default;
+
+void egeg_ns::FrameArena::nextFrame() {
+    std::lock_guard<std::mutex> lock{mutex_};
+    const uint32_t current = current_.load(std::memory_order_relaxed);
+    size_t used = 0U;
+    for(auto& thread : threads_) used += thread->buffers[current].used;
+    last_frame_bytes_ = used;
+    peak_frame_bytes_ = std::max(peak_frame_bytes_, used);
+    ++frames_;
+
+    const uint32_t next = (current+1U) % num_buffers_;
+    for(auto& thread : threads_) thread->buffers[next].reset();
+    current_.store(next, std::memory_order_release);
+}
+
+egeg_ns::FrameArenaStats egeg_ns::FrameArena::stats() const {
+    std::lock_guard<std::mutex> lock{mutex_};
+    FrameArenaStats stats;
+    stats.frames = frames_;
+    stats.last_frame_bytes = last_frame_bytes_;
+    stats.peak_frame_bytes = peak_frame_bytes_;
+    stats.threads = threads_.size();
+    stats.reserved_bytes = reserved_bytes_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+// 呼び出したスレッドの領域を検索してキャッシュする
+//  初めて使用するスレッドの場合は追加する
+egeg_ns::FrameArena::ThreadArena& egeg_ns::FrameArena::findThread() {
+    std::lock_guard<std::mutex> lock{mutex_};
+    const auto id = std::this_thread::get_id();
+    auto found = std::find_if(threads_.begin(), threads_.end(),
+                              [id](const std::unique_ptr<ThreadArena>& T) { return T->thread == id; });
+    if(found == threads_.end()) {
+        threads_.push_back(std::make_unique<ThreadArena>());
+        threads_.back()->thread = id;
+        found = threads_.end()-1;
+    }
+    t_cache = LocalCache{id_, found->get()};
+    return **found;
+}
+
+// 0 バイトの確保も1バイト進め、他の確保と重ならない有効なポインタを返す
+void* egeg_ns::FrameArena::do_allocate(size_t Bytes, const size_t Alignment) {
+    Bytes = std::max<size_t>(Bytes, 1U);
+    ThreadArena& arena = t_cache.arena_id == id_ ? *static_cast<ThreadArena*>(t_cache.arena) : findThread();
+    ThreadArena::Buffer& buffer = arena.buffers[current_.load(std::memory_order_acquire)];
+    size_t padding = alignPadding(buffer.ptr, Alignment);
+    if(static_cast<size_t>(buffer.end-buffer.ptr) < Bytes+padding) { // 足りなければブロックを追加
+        const size_t size = std::max(block_size_, Bytes+Alignment);
+        buffer.addBlock(size);
+        reserved_bytes_.fetch_add(size, std::memory_order_relaxed); // まとめる際は合計サイズが変わらない
+        padding = alignPadding(buffer.ptr, Alignment);
+    }
+    std::byte* const ptr = buffer.ptr + padding;
+    buffer.ptr = ptr + Bytes;
+    buffer.used += Bytes;
+    return ptr;
+}
+
+// EOF
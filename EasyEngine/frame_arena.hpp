@@ -0,0 +1,128 @@
+///
+/// \file   frame_arena.hpp
+/// \brief  フレームアリーナ定義ヘッダ
+///
+/// \author 板場
+///
+/// \par    履歴
+///         - 2026/10/19
+///             - ヘッダ追加
+///             - FrameArenaStats 定義
+///             - FrameArena 定義
+///             - 0 バイトの確保で、有効なポインタを返すよう修正
+///             - 統計の取得を、確保中の他のスレッドと同期するよう修正
+///
+#ifndef INCLUDED_EGEG_FRAME_ARENA_HEADER_
+#define INCLUDED_EGEG_FRAME_ARENA_HEADER_
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+#include "noncopyable.hpp"
+
+namespace easy_engine {
+
+/******************************************************************************
+
+    FrameArenaStats
+
+******************************************************************************/
+///
+/// \brief  フレームアリーナの統計
+///
+///         使用量は全スレッドの合計です。
+///
+struct FrameArenaStats {
+    uint64_t frames = 0U;           ///< 経過したフレーム数(nextFrame の呼び出し回数)
+    size_t last_frame_bytes = 0U;   ///< 直前のフレームで確保したバイト数
+    size_t peak_frame_bytes = 0U;   ///< 1フレームで確保したバイト数の最大
+    size_t reserved_bytes = 0U;     ///< アリーナが保持しているブロックの合計サイズ
+    size_t threads = 0U;            ///< アリーナを使用したスレッド数
+};
+
+
+/******************************************************************************
+
+    FrameArena
+
+******************************************************************************/
+///
+/// \brief  フレーム単位の線形アロケータ
+///
+///         1フレームの間だけ必要なデータ(一時的な配列等)の確保に使用します。
+///         確保はポインタを進めるだけで、解放は何もしません。領域はフレーム単位でまとめて再利用します。
+///         std::pmr::memory_resource を実装しているため、std::pmr のコンテナにそのまま渡せます。
+///         使用例.)
+///             std::pmr::vector<Hoge*> visible(&EasyEngine::frameArena()); // {}では初期化子リストと解釈される場合がある
+///
+///         スレッド毎に別の領域から確保するため、複数のスレッドから同時に確保しても排他を行いません。
+///
+///         バッファを複数(既定 2)持ち、フレーム毎に切り替えます。
+///         確保した領域は、確保したフレームを含めて バッファ数 フレームの間有効です。
+///         (2 で次のフレームまで、3 で次の次のフレームまで。描画スレッドに渡すデータ等に使用できます。)
+///         同じバッファの領域が足りなくなった場合はブロックを追加し、次に再利用する際に1つのブロックにまとめます。
+///
+/// \attention nextFrame は、他のスレッドがこのアリーナから確保していない時に呼び出してください。
+///            有効期間を超えて領域を参照しないでください。(デストラクタも呼び出されません。)
+///
+class FrameArena final : public std::pmr::memory_resource, t_lib::Noncopyable<FrameArena> {
+public :
+    static constexpr uint32_t kMaxBuffers = 3U;
+
+    ///
+    /// \brief  コンストラクタ
+    ///
+    /// \param[in] NumBuffers : バッファ数 [1, kMaxBuffers]
+    /// \param[in] BlockSize  : スレッド毎に確保するブロックの最小サイズ
+    ///
+    explicit FrameArena(uint32_t NumBuffers=2U, size_t BlockSize=256U*1024U);
+    ~FrameArena() override;
+
+    ///
+    /// \brief  次のフレームに進む
+    ///
+    ///         使用するバッファを切り替え、最も古いバッファの領域を全スレッド分再利用します。
+    ///         メインループがフレームの先頭で呼び出します。
+    ///
+    void nextFrame();
+
+    /// バッファ数
+    uint32_t numBuffers() const noexcept { return num_buffers_; }
+    ///
+    /// \brief  統計
+    ///
+    ///         どのスレッドからでも、確保と同時に呼び出せます。
+    ///         使用量はフレームの区切り(nextFrame)で集計するため、直前のフレームまでの値です。
+    ///
+    FrameArenaStats stats() const;
+
+    /// このアリーナから確保するアロケータ
+    template <class Ty>
+    std::pmr::polymorphic_allocator<Ty> allocator() noexcept { return std::pmr::polymorphic_allocator<Ty>{this}; }
+
+private :
+    struct ThreadArena;
+    ThreadArena& findThread();
+    void* do_allocate(size_t Bytes, size_t Alignment) override;
+    void do_deallocate(void*, size_t, size_t) noexcept override {} // フレーム単位で再利用する
+    bool do_is_equal(const std::pmr::memory_resource& Other) const noexcept override { return this == &Other; }
+
+    const uint32_t num_buffers_;
+    const size_t block_size_;
+    const uint64_t id_;                         // スレッド毎のキャッシュの識別用(アドレスの再利用対策)
+    std::atomic<uint32_t> current_{0U};         // 使用中のバッファ
+    mutable std::mutex mutex_;                  // threads_ の追加と、統計の取得
+    std::vector<std::unique_ptr<ThreadArena>> threads_;
+    std::atomic<size_t> reserved_bytes_{0U};    // 全スレッドのブロックの合計サイズ(確保中のスレッドが加算する)
+    uint64_t frames_ = 0U;
+    size_t last_frame_bytes_ = 0U;
+    size_t peak_frame_bytes_ = 0U;
+};
+
+} // namespace easy_engine
+#endif // !INCLUDED_EGEG_FRAME_ARENA_HEADER_
+// EOF
@@ -0,0 +1,132 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include "frame_pacer.hpp"
+#ifdef _WIN32
+#include <Windows.h>
+#include <timeapi.h>
+#else
+#include <thread>
+#endif
+
+/******************************************************************************
+
+    Library
+
+******************************************************************************/
+#ifdef _WIN32
+#pragma comment(lib, "winmm.lib")
+#endif
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace fp_ns = easy_engine;
+namespace {
+#if defined(_WIN32) && !defined(CREATE_WAITABLE_TIMER_HIGH_RESOLUTION)
+    constexpr DWORD CREATE_WAITABLE_TIMER_HIGH_RESOLUTION = 0x00000002;
+#endif
+    const fp_ns::Time kHighResolutionSpin = fp_ns::Microseconds{250};   // 高分解能タイマーの起床誤差 + 余裕
+    const fp_ns::Time kLowResolutionSpin = fp_ns::Microseconds{1500};   // timeBeginPeriod(1)時の起床誤差 + 余裕
+
+    fp_ns::ClockUsed::duration toDuration(const fp_ns::Time& Value) noexcept {
+        return std::chrono::duration_cast<fp_ns::ClockUsed::duration>(fp_ns::Nanoseconds{Value.nanoseconds()});
+    }
+
+    // スピン中にプロセッサを譲る
+    void spinPause() noexcept {
+#ifdef _WIN32
+        YieldProcessor();
+#else
+        std::this_thread::yield();
+#endif
+    }
+} // unnamed namespace
+
+/******************************************************************************
+
+    FramePacer::
+
+******************************************************************************/
+fp_ns::FramePacer::FramePacer(const Time Period) :
+    period_{Period},
+    next_{ClockUsed::now() + toDuration(Period)} {
+#ifdef _WIN32
+    timer_ = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+    high_resolution_ = timer_ != nullptr;
+    if(!timer_) {
+        timeBeginPeriod(1U);
+        timer_ = CreateWaitableTimerW(nullptr, TRUE, nullptr);
+    }
+#else
+    high_resolution_ = true; // std::this_thread::sleep_for はナノ秒単位で指定できる
+#endif
+    spin_threshold_ = high_resolution_ ? kHighResolutionSpin : kLowResolutionSpin;
+}
+
+fp_ns::FramePacer::~FramePacer() {
+#ifdef _WIN32
+    if(timer_) CloseHandle(timer_);
+    if(!high_resolution_) timeEndPeriod(1U);
+#endif
+}
+
+void fp_ns::FramePacer::wait() {
+    const auto period = toDuration(period_);
+    const auto begin = ClockUsed::now();
+    ++stats_.frames;
+
+  // 遅れている場合は待機しない
+    if(begin >= next_) {
+        ++stats_.late_frames;
+        next_ = begin-next_ >= period ? begin+period : next_+period;
+        return;
+    }
+
+  // スリープ
+    const auto wake_point = next_ - toDuration(spin_threshold_);
+    auto now = begin;
+    if(now < wake_point) {
+        sleepFor(Time{wake_point - now});
+        now = ClockUsed::now();
+
+        const Time error = now > wake_point ? Time{now - wake_point} : Time{};
+        ++stats_.sleeps;
+        wake_error_sum_ += error;
+        stats_.mean_wake_error = wake_error_sum_ / static_cast<Time::RepType>(stats_.sleeps);
+        if(error > stats_.max_wake_error) stats_.max_wake_error = error;
+        stats_.sleep_time += Time{now - begin};
+    }
+
+  // スピン
+    const auto spin_begin = now;
+    if(now >= next_) ++stats_.late_frames;
+    while(now < next_) {
+        spinPause();
+        now = ClockUsed::now();
+    }
+    stats_.spin_time += Time{now - spin_begin};
+
+    next_ += period;
+}
+
+void fp_ns::FramePacer::sleepFor(const Time Duration) noexcept {
+#ifdef _WIN32
+    if(!timer_) {
+        Sleep(static_cast<DWORD>(Duration.milliseconds()));
+        return;
+    }
+    LARGE_INTEGER due;
+    due.QuadPart = -static_cast<LONGLONG>(Duration.nanoseconds() / 100); // 相対時間(100ns単位)
+    if(SetWaitableTimer(timer_, &due, 0, nullptr, nullptr, FALSE))
+        WaitForSingleObject(timer_, INFINITE);
+#else
+    std::this_thread::sleep_for(toDuration(Duration));
+#endif
+}
+// EOF
@@ -0,0 +1,111 @@
+///
+/// \file   frame_pacer.hpp
+/// \brief  フレームペーサー定義ヘッダ
+///
+/// \author 板場
+///
+/// \par    履歴
+///         - 2026/10/19
+///             - ヘッダ追加
+///             - FramePacerStats 定義
+///             - FramePacer 定義
+///             - Windows 以外でのビルドに対応
+///
+#ifndef INCLUDED_EGEG_FRAME_PACER_HEADER_
+#define INCLUDED_EGEG_FRAME_PACER_HEADER_
+
+#include <cstdint>
+#include "noncopyable.hpp"
+#include "time.hpp"
+
+namespace easy_engine {
+
+/******************************************************************************
+
+    FramePacerStats
+
+******************************************************************************/
+///
+/// \brief  フレームペーサーの統計
+///
+///         起床誤差は、スリープの終了予定時刻から実際に起床した時刻までの遅れです。
+///
+struct FramePacerStats {
+    uint64_t frames = 0U;           ///< 待機した回数
+    uint64_t sleeps = 0U;           ///< スリープした回数
+    uint64_t late_frames = 0U;      ///< フレームの開始予定時刻に間に合わなかった回数
+    Time mean_wake_error;           ///< 起床誤差の平均
+    Time max_wake_error;            ///< 起床誤差の最大
+    Time sleep_time;                ///< スリープした時間の合計
+    Time spin_time;                 ///< スピンした時間の合計
+};
+
+/******************************************************************************
+
+    FramePacer
+
+******************************************************************************/
+///
+/// \brief  フレームペーサー
+///
+///         一定の周期でフレームを開始するための待機を行います。
+///         残り時間の大部分を高分解能タイマーでスリープし、
+///         開始予定時刻の直前(スピン閾値)からのみスピンして待機します。
+///
+///         高分解能タイマー(Windows 10 1803 以降)が使用できない場合は、
+///         タイマー分解能を1msに設定した通常のタイマーを使用し、スピン閾値を大きめに取ります。
+///         Windows 以外では std::this_thread::sleep_for でスリープします。
+///
+class FramePacer final : t_lib::Noncopyable<FramePacer> {
+public :
+    ///
+    /// \brief  コンストラクタ
+    ///
+    /// \param[in] Period : フレームの周期
+    ///
+    explicit FramePacer(Time Period);
+    ~FramePacer();
+
+    ///
+    /// \brief  次のフレームの開始予定時刻まで待機
+    ///
+    ///         既に開始予定時刻を過ぎている場合は待機しません。
+    ///         1周期以上遅れた場合は、遅れを取り戻さずに現在時刻から周期を数え直します。
+    ///
+    void wait();
+
+    /// フレームの周期を設定
+    void setPeriod(Time Period) noexcept { period_ = Period; }
+    Time period() const noexcept { return period_; }
+
+    ///
+    /// \brief  スピン閾値の設定
+    ///
+    ///         開始予定時刻のこの時間前に起床し、以降はスピンで待機します。
+    ///         起床誤差の最大値より大きい値にすると、開始時刻の精度が保たれます。
+    ///
+    void setSpinThreshold(Time Threshold) noexcept { spin_threshold_ = Threshold; }
+    Time spinThreshold() const noexcept { return spin_threshold_; }
+
+    /// 高分解能タイマーを使用しているか
+    bool isHighResolution() const noexcept { return high_resolution_; }
+
+    /// 統計
+    const FramePacerStats& stats() const noexcept { return stats_; }
+    void resetStats() noexcept { stats_ = FramePacerStats{}; wake_error_sum_ = Time{}; }
+
+private :
+    void sleepFor(Time Duration) noexcept;
+
+    void* timer_ = nullptr;         // HANDLE(Windows のみ)
+    bool high_resolution_ = false;
+    Time period_;
+    Time spin_threshold_;
+    ClockUsed::time_point next_;    // 次のフレームの開始予定時刻
+    FramePacerStats stats_;
+    Time wake_error_sum_;
+};
+
+} // namespace easy_engine
+#endif // !INCLUDED_EGEG_FRAME_PACER_HEADER_
+// EOF
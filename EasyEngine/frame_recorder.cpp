@@ -0,0 +1,256 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include "frame_recorder.hpp"
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <typeinfo>
+#include "input_manager.hpp"
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace egeg_ns = easy_engine;
+namespace {
+    // ログの形式
+    //  ヘッダ : "EGRP", バージョン, フレーム数
+    //  フレーム : 経過時間(ns), 変化したデバイス数, { デバイスID, サイズ, 入力状態 }...,
+    //             更新タスク数, イベント数, { 種類, サイズ, データ }...
+    //  数値は全て可変長(7bit毎、上位ビットが継続フラグ)
+    constexpr char kMagic[4] = {'E', 'G', 'R', 'P'};
+    constexpr uint64_t kVersion = 1U;
+
+    void write(std::vector<std::byte>& Out, uint64_t Value) {
+        while(Value >= 0x80U) {
+            Out.push_back(static_cast<std::byte>(Value | 0x80U));
+            Value >>= 7;
+        }
+        Out.push_back(static_cast<std::byte>(Value));
+    }
+
+    void writeBytes(std::vector<std::byte>& Out, const void* Data, const size_t Size) {
+        const auto* bytes = static_cast<const std::byte*>(Data);
+        Out.insert(Out.end(), bytes, bytes+Size);
+    }
+
+    // FNV-1a
+    uint64_t hash(const void* Data, const size_t Size, uint64_t Seed=14695981039346656037ULL) noexcept {
+        const auto* bytes = static_cast<const unsigned char*>(Data);
+        for(size_t i=0; i<Size; ++i) {
+            Seed ^= bytes[i];
+            Seed *= 1099511628211ULL;
+        }
+        return Seed;
+    }
+
+    uint64_t eventHash(const uint32_t Tag, const void* Data, const size_t Size) noexcept {
+        return hash(Data, Size, hash(&Tag, sizeof(Tag)));
+    }
+
+    // デバイスの識別子
+    //  ビルド間で比較できるよう、アドレスではなく型名から求める
+    uint32_t deviceID(const easy_engine::i_lib::InputDevice& Device) noexcept {
+        const char* name = typeid(Device).name();
+        return static_cast<uint32_t>(hash(name, std::strlen(name)));
+    }
+
+    [[noreturn]] void corrupted() {
+        throw std::runtime_error("FrameRecorder : ログが壊れています。");
+    }
+} // unnamed namespace
+
+
+/******************************************************************************
+
+    FrameRecorder::
+
+******************************************************************************/
+egeg_ns::FrameRecorder::~FrameRecorder() {
+    stop();
+}
+
+egeg_ns::t_lib::DetailedResult<bool, const char*> egeg_ns::FrameRecorder::startRecording(const char* Path) {
+    stop();
+    // 書き出せるかを先に確認する
+    if(!std::ofstream{Path, std::ios::binary}) return {t_lib::Failure{}, "FrameRecorder::startRecording : ファイルを開けませんでした。"};
+
+    mode_ = Mode::kRecord;
+    path_ = Path;
+    log_.clear();
+    frames_ = 0U;
+    last_states_.clear();
+    return t_lib::Success{};
+}
+
+egeg_ns::t_lib::DetailedResult<bool, const char*> egeg_ns::FrameRecorder::startReplay(const char* Path) {
+    stop();
+    std::ifstream file{Path, std::ios::binary};
+    if(!file) return {t_lib::Failure{}, "FrameRecorder::startReplay : ファイルを開けませんでした。"};
+    std::vector<char> data{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    log_.resize(data.size());
+    std::memcpy(log_.data(), data.data(), data.size());
+
+    cursor_ = 0U;
+    const std::byte* magic = nullptr;
+    uint64_t version = 0U;
+    uint64_t frames = 0U;
+    if(!readBytes(magic, sizeof(kMagic)) || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 ||
+       !read(version) || version != kVersion || !read(frames)) {
+        log_.clear();
+        return {t_lib::Failure{}, "FrameRecorder::startReplay : ログの形式が異なります。"};
+    }
+
+    mode_ = Mode::kReplay;
+    path_ = Path;
+    frames_ = 0U;
+    last_states_.clear();
+    stats_ = ReplayStats{};
+    stats_.total_frames = frames;
+    return t_lib::Success{};
+}
+
+bool egeg_ns::FrameRecorder::stop() noexcept {
+    const Mode mode = mode_;
+    mode_ = Mode::kNone;
+    events_.clear();
+    if(mode != Mode::kRecord) return true;
+
+    try {
+        std::vector<std::byte> header;
+        writeBytes(header, kMagic, sizeof(kMagic));
+        write(header, kVersion);
+        write(header, frames_);
+        std::ofstream file{path_, std::ios::binary};
+        file.write(reinterpret_cast<const char*>(header.data()), header.size());
+        file.write(reinterpret_cast<const char*>(log_.data()), log_.size());
+        return static_cast<bool>(file);
+    }
+    catch(...) {
+        return false;
+    }
+}
+
+void egeg_ns::FrameRecorder::recordEvent(const uint32_t Tag, const void* Data, const size_t Size) {
+    if(mode_ == Mode::kNone) return;
+
+    std::lock_guard<std::mutex> lock{mutex_};
+    event_hash_ += eventHash(Tag, Data, Size); // 加算で順序に依らないハッシュにする
+    if(mode_ == Mode::kRecord) {
+        write(pending_, Tag);
+        write(pending_, Size);
+        writeBytes(pending_, Data, Size);
+        ++num_pending_;
+    }
+}
+
+// フレームの開始
+//  記録中 : 経過時間と、前回から変化した入力状態を記録する
+//  再生中 : 記録された経過時間で Delta を上書きし、記録された入力状態を復元する
+void egeg_ns::FrameRecorder::beginFrame(Time& Delta, i_lib::InputManager& Input) {
+    if(mode_ == Mode::kRecord) {
+        write(log_, static_cast<uint64_t>(Delta.nanoseconds()));
+
+        state_buffer_.clear(); // 変化したデバイスの記録
+        uint64_t changed = 0U;
+        std::vector<std::byte>& state = device_state_;
+        for(auto& device : Input.devices_) {
+            const size_t size = device.second->stateSize();
+            if(size == 0U) continue;
+            state.resize(size);
+            device.second->saveState(state.data());
+            const uint32_t id = deviceID(*device.second);
+            auto& last = last_states_[id];
+            if(last == state) continue;
+            last = state;
+            write(state_buffer_, id);
+            write(state_buffer_, size);
+            writeBytes(state_buffer_, state.data(), size);
+            ++changed;
+        }
+        write(log_, changed);
+        log_.insert(log_.end(), state_buffer_.begin(), state_buffer_.end());
+    }
+    else if(mode_ == Mode::kReplay) {
+        uint64_t delta = 0U;
+        uint64_t changed = 0U;
+        if(!read(delta) || !read(changed)) corrupted();
+        Delta = Nanoseconds{static_cast<Nanoseconds::rep>(delta)};
+
+        for(uint64_t i=0; i<changed; ++i) {
+            uint64_t id = 0U;
+            uint64_t size = 0U;
+            const std::byte* data = nullptr;
+            if(!read(id) || !read(size) || !readBytes(data, size)) corrupted();
+            last_states_[static_cast<uint32_t>(id)].assign(data, data+size);
+        }
+        // 変化していないデバイスも、update() で取得した状態を上書きする
+        for(auto& device : Input.devices_) {
+            auto found = last_states_.find(deviceID(*device.second));
+            if(found != last_states_.end() && found->second.size() == device.second->stateSize())
+                device.second->loadState(found->second.data());
+        }
+
+        uint64_t num_events = 0U;
+        if(!read(recorded_tasks_) || !read(num_events)) corrupted();
+        events_.clear();
+        recorded_hash_ = 0U;
+        for(uint64_t i=0; i<num_events; ++i) {
+            uint64_t tag = 0U;
+            uint64_t size = 0U;
+            const std::byte* data = nullptr;
+            if(!read(tag) || !read(size) || !readBytes(data, size)) corrupted();
+            events_.push_back(Event{static_cast<uint32_t>(tag), data, static_cast<size_t>(size)});
+            recorded_hash_ += eventHash(static_cast<uint32_t>(tag), data, static_cast<size_t>(size));
+        }
+    }
+}
+
+// フレームの終了
+//  記録中 : 更新タスク数と、フレーム中のイベントを記録する
+//  再生中 : 更新タスク数とイベントを記録と比較する
+void egeg_ns::FrameRecorder::endFrame(const size_t NumTasks) {
+    if(mode_ == Mode::kNone) return;
+
+    std::lock_guard<std::mutex> lock{mutex_};
+    if(mode_ == Mode::kRecord) {
+        write(log_, NumTasks);
+        write(log_, num_pending_);
+        log_.insert(log_.end(), pending_.begin(), pending_.end());
+        pending_.clear();
+        num_pending_ = 0U;
+    }
+    else {
+        if(NumTasks != recorded_tasks_ || event_hash_ != recorded_hash_) {
+            if(stats_.mismatched_frames++ == 0U) stats_.first_mismatch = frames_;
+        }
+        stats_.frames = frames_+1U;
+    }
+    event_hash_ = 0U;
+    ++frames_;
+}
+
+bool egeg_ns::FrameRecorder::read(uint64_t& Value) noexcept {
+    Value = 0U;
+    for(uint32_t shift=0U; shift<64U && cursor_<log_.size(); shift+=7U) {
+        const auto byte = static_cast<uint64_t>(log_[cursor_++]);
+        Value |= (byte & 0x7FU) << shift;
+        if(!(byte & 0x80U)) return true;
+    }
+    return false;
+}
+
+bool egeg_ns::FrameRecorder::readBytes(const std::byte*& Data, const size_t Size) noexcept {
+    if(log_.size()-cursor_ < Size) return false;
+    Data = log_.data() + cursor_;
+    cursor_ += Size;
+    return true;
+}
+// EOF
@@ -0,0 +1,180 @@
+///
+/// \file   frame_recorder.hpp
+/// \brief  フレームの記録と再生定義ヘッダ
+///
+/// \author 板場
+///
+/// \par    履歴
+///         - 2026/10/19
+///             - ヘッダ追加
+///             - ReplayStats 定義
+///             - FrameRecorder 定義
+///
+#ifndef INCLUDED_EGEG_FRAME_RECORDER_HEADER_
+#define INCLUDED_EGEG_FRAME_RECORDER_HEADER_
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "noncopyable.hpp"
+#include "result.hpp"
+#include "time.hpp"
+
+namespace easy_engine {
+class EasyEngine;
+namespace i_lib { class InputManager; }
+
+/******************************************************************************
+
+    ReplayStats
+
+******************************************************************************/
+///
+/// \brief  再生の統計
+///
+///         記録時と再生時の、フレーム毎の更新タスク数とイベントの比較結果です。
+///         一致しないフレームがある場合、再生の結果が記録時と異なっています。
+///         (ビルド間の動作の違いや、記録されていない入力への依存等。)
+///
+struct ReplayStats {
+    uint64_t frames = 0U;                   ///< 再生したフレーム数
+    uint64_t total_frames = 0U;             ///< 記録されているフレーム数
+    uint64_t mismatched_frames = 0U;        ///< 記録と一致しなかったフレーム数
+    uint64_t first_mismatch = UINT64_MAX;   ///< 最初に一致しなかったフレーム(UINT64_MAX : 無し)
+};
+
+
+/******************************************************************************
+
+    FrameRecorder
+
+******************************************************************************/
+///
+/// \brief  フレームの記録と再生
+///
+///         フレーム毎に、更新処理に渡した経過時間、入力デバイスの状態、更新タスク数、
+///         及び recordEvent(…) で記録したイベントをバイナリ形式のログに記録します。
+///         再生時は、記録した経過時間と入力状態をそのまま更新処理に渡し、実時間の待機をせずに実行します。
+///         本番のセッションと同じ処理をベンチマーク環境で再現し、ビルド間でフレーム毎に比較する用途を想定しています。
+///
+///         記録は EngineConfig::record_path、再生は EngineConfig::replay_path を指定して EasyEngine::run(…) を呼び出します。
+///         入力状態は、InputDevice::stateSize() 等をオーバーライドしたデバイスのみ記録します。
+///         ログは前のフレームから変化した入力状態のみを持ち、数値は可変長で格納します。
+///
+///         更新タスクは、フレームの終わりに登録されている数のみを記録します。
+///         個々のタスクの登録、解除は記録しないため、タスクの比較は数による近似です。
+///         (同じフレームで別のタスクに入れ替わった場合等は、不一致として検出されません。)
+///
+///         記録されていない非決定的な値(乱数の種、ネットワークからの受信等)は、
+///         記録時に recordEvent(…) で記録し、再生時は replayedEvents() から取得して使用してください。
+///
+class FrameRecorder final : t_lib::Noncopyable<FrameRecorder> {
+public :
+    friend EasyEngine;
+
+    enum class Mode {
+        kNone,      ///< 記録も再生もしていない
+        kRecord,    ///< 記録中
+        kReplay,    ///< 再生中
+    };
+
+    ///
+    /// \brief  再生中のフレームのイベント
+    ///
+    ///         data はフレームの終わりまで有効です。
+    ///
+    struct Event {
+        uint32_t tag;
+        const std::byte* data;
+        size_t size;
+    };
+
+    FrameRecorder() = default;
+    ~FrameRecorder();
+
+    ///
+    /// \brief  記録を開始
+    ///
+    ///         ログはメモリ上に保持し、stop() の呼び出し時にファイルへ書き出します。
+    ///
+    /// \param[in] Path : 書き出すファイルのパス
+    ///
+    t_lib::DetailedResult<bool, const char*> startRecording(const char* Path);
+
+    ///
+    /// \brief  再生を開始
+    ///
+    ///         ログを全て読み込みます。
+    ///
+    /// \param[in] Path : 読み込むファイルのパス
+    ///
+    t_lib::DetailedResult<bool, const char*> startReplay(const char* Path);
+
+    ///
+    /// \brief  記録、再生を終了
+    ///
+    ///         記録中の場合はログをファイルへ書き出します。
+    ///
+    /// \return 書き出しに失敗した場合 false
+    ///
+    bool stop() noexcept;
+
+    ///
+    /// \brief  イベントを記録
+    ///
+    ///         記録中は、現在のフレームのイベントとして記録します。
+    ///         再生中は記録せず、記録されたイベントとの比較にのみ使用します。
+    ///         複数のスレッドから呼び出すことができます。(同じフレームのイベントの順序は比較に影響しません。)
+    ///
+    /// \param[in] Tag  : イベントの種類
+    /// \param[in] Data : イベントのデータ
+    /// \param[in] Size : データのバイト数
+    ///
+    void recordEvent(uint32_t Tag, const void* Data=nullptr, size_t Size=0U);
+
+    ///
+    /// \brief  再生中のフレームに記録されているイベント
+    ///
+    ///         記録時の recordEvent(…) の呼び出し順です。
+    ///         メインスレッドから、更新処理の間に参照してください。
+    ///
+    const std::vector<Event>& replayedEvents() const noexcept { return events_; }
+
+    Mode mode() const noexcept { return mode_; }
+    uint64_t frames() const noexcept { return frames_; } ///< 記録、再生したフレーム数
+    ReplayStats stats() const noexcept { return stats_; }
+
+private :
+    void beginFrame(Time& Delta, i_lib::InputManager& Input); // EasyEngineクラスにより呼び出される関数
+    void endFrame(size_t NumTasks);                           // 上同
+    bool finished() const noexcept { return mode_ == Mode::kReplay && cursor_ >= log_.size(); } // 上同 再生が終了したか
+
+    bool read(uint64_t& Value) noexcept;
+    bool readBytes(const std::byte*& Data, size_t Size) noexcept;
+
+    Mode mode_ = Mode::kNone;
+    std::string path_;
+    std::vector<std::byte> log_;                // 記録中のログ、または読み込んだログ
+    size_t cursor_ = 0U;                        // 再生中の読み込み位置
+    uint64_t frames_ = 0U;
+    std::unordered_map<uint32_t, std::vector<std::byte>> last_states_; // デバイス毎の前回記録した入力状態
+    std::vector<std::byte> state_buffer_;       // フレーム中に変化した入力状態の記録
+    std::vector<std::byte> device_state_;
+
+    std::mutex mutex_;                          // フレーム中のイベント
+    std::vector<std::byte> pending_;            // 記録中のフレームのイベント
+    uint32_t num_pending_ = 0U;
+    uint64_t event_hash_ = 0U;                  // フレーム中のイベントのハッシュ(順序に依らない)
+
+    std::vector<Event> events_;                 // 再生中のフレームのイベント
+    uint64_t recorded_tasks_ = 0U;
+    uint64_t recorded_hash_ = 0U;
+    ReplayStats stats_;
+};
+
+} // namespace easy_engine
+#endif // !INCLUDED_EGEG_FRAME_RECORDER_HEADER_
+// EOF
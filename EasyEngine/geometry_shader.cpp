@@ -1,4 +1,4 @@
-// 쐬 : 
+// 作成者 : 板場
 /******************************************************************************
 
     include
@@ -6,6 +6,7 @@
 ******************************************************************************/
 #include "geometry_shader.hpp"
 #include "easy_engine.hpp"
+#include "graphic_manager.hpp"
 
 
 /******************************************************************************
@@ -1,13 +1,13 @@
 ///
 /// \file   geometry_shader.hpp
-/// \brief  WIgVF[_[`wb_
+/// \brief  ジオメトリシェーダー定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/9/2
-///             - wb_ǉ
-///             - GeometryShader `
+///             - ヘッダ追加
+///             - GeometryShader 定義
 ///
 #ifndef INCLUDED_EGEG_GLIB_GEOMETRY_SHADER_HEADER_
 #define INCLUDED_EGEG_GLIB_GEOMETRY_SHADER_HEADER_
@@ -23,41 +23,41 @@ namespace g_lib {
 
 ******************************************************************************/
 ///
-/// \brief  WIgVF[_[
+/// \brief  ジオメトリシェーダー
 ///
-/// \par    ǂݍ݂xꍇ
-///         - ftHgRXgN^ō\zVF[_[ɑ
+/// \par    読み込みを遅延させたい場合
+///         - デフォルトコンストラクタで構築したシェーダーに代入
 ///           GeometryShader gs{};
-///             c
-///           gs = GeometryShader{"hogehoge.xxx", c};
+///             …
+///           gs = GeometryShader{"hogehoge.xxx", …};
 ///
-/// \attention  ̃NXP̂łgpł܂AVF[_[Ƃɂ̃NXƂڍ׃NX`\n
-///             ǐオ܂AオƎv̂ł߂܂B\n
+/// \attention  このクラス単体でも使用できますが、シェーダーごとにこのクラスを基底とした詳細クラスを定義した方が\n
+///             可読性が上がりますし、可搬性も上がると思うのでお勧めします。\n
 ///
 class GeometryShader {
 public :
     GeometryShader() = default;
 
     ///
-    /// \brief  ǂݍ݂𔺂RXgN^
+    /// \brief  読み込みを伴うコンストラクタ
     ///
-    /// \param[in] ShaderFilePath : ǂݍރVF[_[t@C̃pX
+    /// \param[in] ShaderFilePath : 読み込むシェーダーファイルのパス
     ///
     GeometryShader(const char* ShaderFilePath);
 
     ///
-    /// \brief  LȃWIgVF[_[ǂ
+    /// \brief  有効なジオメトリシェーダーかどうか判定
     ///
-    ///         true  : L
-    ///         false : 
+    ///         true  : 有効
+    ///         false : 無効
     ///
-    /// \return 茋
+    /// \return 判定結果
     ///
     bool isValid() const noexcept { return shader_; }
     operator bool() const noexcept { return isValid(); }
 
 
-    /// VF[_[IuWFNg擾
+    /// シェーダーオブジェクトを取得
     ID3D11GeometryShader* shader() const noexcept { return shader_.Get(); }
 private :
     Microsoft::WRL::ComPtr<ID3D11GeometryShader> shader_;
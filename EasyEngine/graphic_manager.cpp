@@ -1,4 +1,4 @@
-// 쐬 : 
+// 作成者 : 板場
 /******************************************************************************
 
     include
@@ -7,6 +7,7 @@
 #include "graphic_manager.hpp"
 #include "egeg_state.hpp"
 #include "easy_engine.hpp"
+#include "window_manager.hpp"
 #include "utility_function.hpp"
 #include "update_order.hpp"
 
@@ -27,7 +28,7 @@ namespace {
     class BaseLayer : public gm_ns::Layer {
     public :
         BaseLayer(ID3D11Device* D3DDevice, ID3D11Texture2D* BackBuffer) {
-            // Xbv`FC̃obNobt@QƂer[쐬
+            // スワップチェインのバックバッファを参照する各種ビューを作成
             Microsoft::WRL::ComPtr<ID3D11RenderTargetView> rtv;
             if(FAILED(D3DDevice->CreateRenderTargetView(BackBuffer, nullptr, &rtv)))
                 return;
@@ -66,7 +67,7 @@ gm_ns::GraphicManager::~GraphicManager() = default;
 std::unique_ptr<gm_ns::GraphicManager> gm_ns::GraphicManager::create() {
     std::unique_ptr<GraphicManager> ptr{new GraphicManager{}};
     
-    // DirectX
+    // DirectXを初期化
     Microsoft::WRL::ComPtr<ID3D11DeviceContext> context;
     if(FAILED(D3D11CreateDeviceAndSwapChain(
                 nullptr,
@@ -99,14 +100,15 @@ std::unique_ptr<gm_ns::GraphicManager> gm_ns::GraphicManager::create() {
     }
     ptr->context_ = ImmediateContext{context};
     
-    // x[XC[
+    // ベースレイヤーを初期化
     Microsoft::WRL::ComPtr<ID3D11Texture2D> back_buffer;
     if(FAILED(ptr->swap_chain_->GetBuffer(0, __uuidof(ID3D11Texture2D), &back_buffer)))
         return nullptr;
     ptr->base_layer_ = BaseLayer{ptr->device_.Get(), back_buffer.Get()};
 
-    // `揈o^
-    ptr->task_ = EasyEngine::updator().registerTask(ptr.get(), &GraphicManager::render, UpdateOrder::kRenderScreen);
+    // 描画処理を登録
+    ptr->task_ = EasyEngine::updator().registerTask(ptr.get(), &GraphicManager::render, UpdateOrder::kRenderScreen,
+                                                   t_lib::TaskAffinity::kMainThread);
 
     return ptr;
 }
@@ -1,13 +1,13 @@
 ///
 /// \fiel   graphic_manager.hpp
-/// \brief  OtBbN}l[W[`wb_
+/// \brief  グラフィックマネージャー定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/8/21
-///             - wb_ǉ
-///             - GraphicManager `
+///             - ヘッダ追加
+///             - GraphicManager 定義
 ///
 #ifndef INCLUDED_EGEG_GLIB_GRAPHIC_MANAGER_HEADER_
 #define INCLUDED_EGEG_GLIB_GRAPHIC_MANAGER_HEADER_
@@ -32,9 +32,9 @@ namespace g_lib {
 
 ******************************************************************************/
 ///
-/// \brief  `}l[W[
+/// \brief  描画マネージャー
 ///
-///         ̃NXւ̃ANZX́AEasyEngine::graphics()gpĂB
+///         このクラスへのアクセスは、EasyEngine::graphics()を使用してください。
 ///
 class GraphicManager final : t_lib::Noncopyable<GraphicManager> {
 public :
@@ -50,16 +50,16 @@ public :
 
 
 
-    // note : XbhZ[tɎ
+    // note : スレッドセーフに実装
     void executeContext(const DrawContext& Context);
 
 
-    /// gpĂD3D@\x擾
+    /// 使用しているD3D機能レベルを取得
     D3D_FEATURE_LEVEL d3dFeatureLevel() const noexcept { return feature_level_; }
-    /// D3DfoCX擾
+    /// D3Dデバイスを取得
     ID3D11Device& d3d11Device() const noexcept { return *device_.Get(); }
 private :
-    static std::unique_ptr<GraphicManager> create(); // EasyEngineNXɂĂяo֐
+    static std::unique_ptr<GraphicManager> create(); // EasyEngineクラスにより呼び出される関数
     GraphicManager() = default;
     void render(Time);
 
@@ -1,13 +1,13 @@
 ///
 /// \file   id.hpp
-/// \brief  ID֘ANX`wb_
+/// \brief  ID関連クラス定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/7/23
-///             - wb_ǉ
-///             - ConstantGenerator, TypeIDGenerator, StringGeneratoryсAɕtNXƊ֐`
+///             - ヘッダ追加
+///             - ConstantGenerator, TypeIDGenerator, StringGenerator及び、それに付随するクラスと関数を定義
 ///
 #ifndef INCLUDED_EGEG_TLIB_ID_HEADER_
 #define INCLUDED_EGEG_TLIB_ID_HEADER_
@@ -34,10 +34,10 @@ namespace t_lib {
 
 ******************************************************************************/
 ///
-/// \brief  CX^XɈقȂID𐶐
+/// \brief  インスタンス毎に異なるIDを生成する
 ///
-/// \tparam Ty          : CX^X^
-/// \param[in] Instance : CX^X
+/// \tparam Ty          : インスタンス型
+/// \param[in] Instance : インスタンス
 ///
 template <class Ty>
 std::uintptr_t uniqueID(const Ty& Instance) noexcept {
@@ -45,36 +45,36 @@ std::uintptr_t uniqueID(const Ty& Instance) noexcept {
 }
 
 ///
-/// \brief  萔WFl[^[
+/// \brief  定数ジェネレーター
 ///
-/// Đ^萔AXR[v񋓌^萔AyуXR[vt񋓌^萔ɑΉĂ܂B\n
-/// ̑̌^ɂĂ͑ΉĂ܂B(. float, char* etc...)
+/// 汎整数型定数、スコープ無し列挙型定数、及びスコープ付き列挙型定数に対応しています。\n
+/// その他の型については対応していません。(例. float, char* etc...)
 ///
-/// \tparam Value : 萔l
+/// \tparam Value : 生成する定数値
 ///
 template <auto Value>
 using ConstantGenerator = id_impl::Generator<id_impl::Constant<Value>>;
 
 ///
-/// \brief  ^IDWFl[^[
+/// \brief  型IDジェネレーター
 ///
-/// ^ɈӂID𐶐܂B
+/// 型毎に一意なIDを生成します。
 ///
-/// \tparam Ty      : IDɕϊ^
+/// \tparam Ty      : IDに変換する型
 ///
 template <class Ty>
 using TypeIDGenerator = id_impl::Generator<id_impl::TypeID<Ty>>;
 
 ///
-/// \brief  WFl[^[
+/// \brief  文字列ジェネレーター
 ///
-/// gp)\n
-///         static const chat kName[] = "hogehoge";               <- \n
-///         static const StringGenerator<kName> kNameGenerator{}; <- ̐
+/// 使用例)\n
+///         static const chat kName[] = "hogehoge";               <- 文字列\n
+///         static const StringGenerator<kName> kNameGenerator{}; <- 文字列の生成者
 ///
-/// \tparam Str : 镶
+/// \tparam Str : 生成する文字列
 ///
-/// \attention w肷镶(̗ł'kName')  constŏCĕύXȂ悤ɂĂB
+/// \attention 指定する文字列(上の例でいう'kName') は constで修飾して変更されないようにしてください。
 ///
 template <const char Str[]>
 using StringGenerator = id_impl::Generator<id_impl::String<Str>>;
@@ -87,7 +87,7 @@ using StringGenerator = id_impl::Generator<id_impl::String<Str>>;
   namespace id_impl {
     template <class Ty>
     struct Generator {
-      // 
+      // 生成者
         using Value = Ty;
         using ValueType = typename Ty::ValueType;
 
@@ -101,14 +101,14 @@ using StringGenerator = id_impl::Generator<id_impl::String<Str>>;
 
     template <auto Value>
     struct Constant<Value, true> {
-      // 񋓌^萔
+      // 列挙型定数
         using ValueType = std::underlying_type_t<decltype(Value)>;
 
         static constexpr ValueType value = static_cast<ValueType>(Value);
     };
     template <auto Value>
     struct Constant<Value, false> {
-      // 񋓌^萔
+      // 非列挙型定数
         using ValueType = decltype(Value);
 
         static_assert(std::is_arithmetic_v<ValueType>, "'Value' must be integral value");
@@ -117,7 +117,7 @@ using StringGenerator = id_impl::Generator<id_impl::String<Str>>;
 
     template <class Ty>
     struct TypeID {
-      // ^ɈӂID
+      // 型毎に一意なID
         using InstanceType = Ty;
         using ValueType = std::uintptr_t;
 
@@ -128,7 +128,7 @@ using StringGenerator = id_impl::Generator<id_impl::String<Str>>;
 
     template <const char Str[]>
     struct String {
-      // 
+      // 文字列
         using ValueType = const char*;
         static const ValueType value;
     };
@@ -1,13 +1,13 @@
 ///
 /// \file   index_buffer.hpp
-/// \brief  _CfbNXobt@`wb_
+/// \brief  頂点インデックスバッファ定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/9/1
-///             - wb_ǉ
-///             - IndexBuffer `
+///             - ヘッダ追加
+///             - IndexBuffer 定義
 ///
 #ifndef INCLUDED_EGEG_GLIB_INDEX_BUFFER_HEADER_
 #define INCLUDED_EGEG_GLIB_INDEX_BUFFER_HEADER_
@@ -26,48 +26,48 @@ namespace g_lib {
 
 ******************************************************************************/
 ///
-/// \brief  _CfbNXobt@
+/// \brief  頂点インデックスバッファ
 ///
 class IndexBuffer {
 public :
     ///
-    /// \brief  ftHg̃RXgN^
+    /// \brief  デフォルトのコンストラクタ
     ///
-    ///         obt@͐܂B
+    ///         バッファは生成しません。
     ///
     IndexBuffer() = default;
 
     ///
-    /// \brief  obt@𐶐RXgN^
+    /// \brief  バッファを生成するコンストラクタ
     ///
-    ///         ̃f[^obt@𐶐܂B
-    ///         CfbNX\^̃TCY16bitłB
+    ///         引数のデータを持つバッファを生成します。
+    ///         インデックスを表す型のサイズは16bitです。
     ///
     IndexBuffer(const std::vector<std::uint16_t>& Data) : 
       IndexBuffer{16U*Data.size(), D3D11_SUBRESOURCE_DATA{Data.data(), 0, 0}, DXGI_FORMAT::DXGI_FORMAT_R16_UINT} {}
     ///
-    /// \brief  obt@𐶐RXgN^
+    /// \brief  バッファを生成するコンストラクタ
     ///
-    ///         ̃f[^obt@𐶐܂B
-    ///         CfbNX\^̃TCY32bitłB
+    ///         引数のデータを持つバッファを生成します。
+    ///         インデックスを表す型のサイズは32bitです。
     ///
     IndexBuffer(const std::vector<std::uint32_t>& Data) :
       IndexBuffer{32U*Data.size(), D3D11_SUBRESOURCE_DATA{Data.data(), 0, 0}, DXGI_FORMAT::DXGI_FORMAT_R32_UINT} {}
 
     ///
-    /// \brief  LȒ_CfbNXobt@ǂ
+    /// \brief  有効な頂点インデックスバッファかどうか判定
     ///
-    ///         true  : L
-    ///         false : 
+    ///         true  : 有効
+    ///         false : 無効
     ///
-    /// \return 茋
+    /// \return 判定結果
     ///
     bool isValid() const noexcept { return ibuf_; }
     operator bool() const noexcept { return isValid(); }
 
-    /// obt@IuWFNg擾
+    /// バッファオブジェクトを取得
     ID3D11Buffer* buffer() const noexcept { return ibuf_.Get(); } 
-    /// CfbNXtH[}bg擾
+    /// インデックスフォーマットを取得
     DXGI_FORMAT format() const noexcept { return format_; }
 protected :
     IndexBuffer(UINT, const D3D11_SUBRESOURCE_DATA&, DXGI_FORMAT);
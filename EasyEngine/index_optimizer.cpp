@@ -0,0 +1,347 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include "index_optimizer.hpp"
+#include <cmath>
+#include <array>
+#include <algorithm>
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace io_ns = easy_engine::g_lib;
+namespace {
+    using easy_engine::m_lib::Vector3D;
+
+    // Forsyth の頂点スコア用パラメータ
+    constexpr int kForsythCacheSize = 32;
+    constexpr float kCacheDecayPower = 1.5F;
+    constexpr float kLastTriangleScore = 0.75F;
+    constexpr float kValenceBoostScale = 2.0F;
+    constexpr float kValenceBoostPower = 0.5F;
+    constexpr size_t kValenceTableSize = 32U;
+
+    // オーバードロー最適化でクラスタ分割に使用するキャッシュサイズ
+    constexpr size_t kClusterCacheSize = 16U;
+
+    constexpr std::uint32_t kInvalid = 0xFFFFFFFFU;
+
+    // 頂点スコアの参照表
+    struct ScoreTable {
+        ScoreTable() noexcept;
+        float cache[kForsythCacheSize];
+        float valence[kValenceTableSize];
+    };
+    const ScoreTable& scoreTable() noexcept;
+    float vertexScore(int, std::uint32_t) noexcept;
+
+    template <class IndexTy>
+    io_ns::VertexCacheStats analyze(const std::vector<IndexTy>&, size_t, size_t);
+    template <class IndexTy>
+    void reorderForsyth(std::vector<IndexTy>&, size_t);
+    template <class IndexTy>
+    void sortClusters(std::vector<IndexTy>&, const std::vector<Vector3D>&);
+    template <class IndexTy>
+    std::vector<std::uint32_t> remapFetch(std::vector<IndexTy>&, size_t);
+} // unnamed namespace
+
+
+/******************************************************************************
+
+    g_lib::
+
+******************************************************************************/
+io_ns::VertexCacheStats io_ns::analyzeVertexCache(const std::vector<std::uint16_t>& Indices, const size_t NumVertices, const size_t CacheSize) {
+    return analyze(Indices, NumVertices, CacheSize);
+}
+io_ns::VertexCacheStats io_ns::analyzeVertexCache(const std::vector<std::uint32_t>& Indices, const size_t NumVertices, const size_t CacheSize) {
+    return analyze(Indices, NumVertices, CacheSize);
+}
+
+void io_ns::optimizeVertexCache(std::vector<std::uint16_t>& Indices, const size_t NumVertices) {
+    reorderForsyth(Indices, NumVertices);
+}
+void io_ns::optimizeVertexCache(std::vector<std::uint32_t>& Indices, const size_t NumVertices) {
+    reorderForsyth(Indices, NumVertices);
+}
+
+void io_ns::optimizeOverdraw(std::vector<std::uint16_t>& Indices, const std::vector<m_lib::Vector3D>& Positions) {
+    sortClusters(Indices, Positions);
+}
+void io_ns::optimizeOverdraw(std::vector<std::uint32_t>& Indices, const std::vector<m_lib::Vector3D>& Positions) {
+    sortClusters(Indices, Positions);
+}
+
+std::vector<std::uint32_t> io_ns::optimizeVertexFetch(std::vector<std::uint16_t>& Indices, const size_t NumVertices) {
+    return remapFetch(Indices, NumVertices);
+}
+std::vector<std::uint32_t> io_ns::optimizeVertexFetch(std::vector<std::uint32_t>& Indices, const size_t NumVertices) {
+    return remapFetch(Indices, NumVertices);
+}
+
+
+/******************************************************************************
+
+    others
+
+******************************************************************************/
+namespace {
+ScoreTable::ScoreTable() noexcept {
+    for(int i=0; i<kForsythCacheSize; ++i) {
+        if(i < 3) { cache[i] = kLastTriangleScore; continue; }
+        const float scaler = 1.0F / (kForsythCacheSize-3);
+        cache[i] = std::pow(1.0F - (i-3)*scaler, kCacheDecayPower);
+    }
+    valence[0] = 0.0F;
+    for(size_t i=1U; i<kValenceTableSize; ++i)
+        valence[i] = kValenceBoostScale * std::pow(static_cast<float>(i), -kValenceBoostPower);
+}
+
+const ScoreTable& scoreTable() noexcept {
+    static const ScoreTable table;
+    return table;
+}
+
+// 頂点スコアを算出
+//  CachePosition : キャッシュ内の位置(キャッシュ外は負)
+//  Remaining     : 未出力の隣接三角形数
+float vertexScore(const int CachePosition, const std::uint32_t Remaining) noexcept {
+    if(Remaining == 0U) return -1.0F;
+    const auto& table = scoreTable();
+    float score = CachePosition >= 0 ? table.cache[CachePosition] : 0.0F;
+    score += Remaining < kValenceTableSize ?
+        table.valence[Remaining] :
+        kValenceBoostScale * std::pow(static_cast<float>(Remaining), -kValenceBoostPower);
+    return score;
+}
+
+// FIFOキャッシュをシミュレートして統計を算出
+template <class IndexTy>
+io_ns::VertexCacheStats analyze(const std::vector<IndexTy>& Indices, const size_t NumVertices, const size_t CacheSize) {
+    io_ns::VertexCacheStats stats{0.0F, 0.0F};
+    const size_t num_triangles = Indices.size()/3U;
+    if(num_triangles == 0U || NumVertices == 0U) return stats;
+
+    // 書き込み時刻との差がキャッシュサイズ以下ならキャッシュ内
+    std::vector<size_t> stamps(NumVertices, 0U);
+    std::vector<bool> referenced(NumVertices, false);
+    size_t timestamp = CacheSize + 1U;
+    size_t misses = 0U;
+    size_t num_referenced = 0U;
+    for(size_t i=0; i<num_triangles*3U; ++i) {
+        const size_t v = Indices[i];
+        if(!referenced[v]) { referenced[v] = true; ++num_referenced; }
+        if(timestamp - stamps[v] > CacheSize) {
+            stamps[v] = timestamp++;
+            ++misses;
+        }
+    }
+
+    stats.acmr = static_cast<float>(misses) / num_triangles;
+    stats.atvr = static_cast<float>(misses) / num_referenced;
+    return stats;
+}
+
+// Forsyth の線形速度頂点キャッシュ最適化
+template <class IndexTy>
+void reorderForsyth(std::vector<IndexTy>& Indices, const size_t NumVertices) {
+    const size_t num_triangles = Indices.size()/3U;
+    if(num_triangles == 0U || NumVertices == 0U) return;
+
+  // 頂点に隣接する三角形リスト(CSR)
+    std::vector<std::uint32_t> remaining(NumVertices, 0U);
+    for(size_t i=0; i<num_triangles*3U; ++i)
+        ++remaining[Indices[i]];
+    std::vector<std::uint32_t> offsets(NumVertices+1U, 0U);
+    for(size_t v=0; v<NumVertices; ++v)
+        offsets[v+1U] = offsets[v] + remaining[v];
+    std::vector<std::uint32_t> adjacency(offsets.back());
+    {
+        std::vector<std::uint32_t> cursor{offsets.begin(), offsets.end()-1};
+        for(size_t i=0; i<num_triangles*3U; ++i)
+            adjacency[cursor[Indices[i]]++] = static_cast<std::uint32_t>(i/3U);
+    }
+
+  // 初期スコア
+    std::vector<int> cache_position(NumVertices, -1);
+    std::vector<float> vertex_score(NumVertices);
+    for(size_t v=0; v<NumVertices; ++v)
+        vertex_score[v] = vertexScore(-1, remaining[v]);
+    std::vector<float> triangle_score(num_triangles);
+    std::vector<bool> emitted(num_triangles, false);
+    std::uint32_t best = 0U;
+    for(size_t t=0; t<num_triangles; ++t) {
+        triangle_score[t] = vertex_score[Indices[t*3U]] + vertex_score[Indices[t*3U+1U]] + vertex_score[Indices[t*3U+2U]];
+        if(triangle_score[t] > triangle_score[best]) best = static_cast<std::uint32_t>(t);
+    }
+
+  // 出力
+    std::vector<IndexTy> output;
+    output.reserve(num_triangles*3U);
+    std::array<std::uint32_t, kForsythCacheSize+3> cache;
+    std::array<std::uint32_t, kForsythCacheSize+3> new_cache;
+    size_t cache_count = 0U;
+    size_t scan_cursor = 0U;
+    for(size_t out=0; out<num_triangles; ++out) {
+        // キャッシュ内に候補が無い場合は、未出力の三角形を入力順に探す
+        if(best == kInvalid) {
+            while(emitted[scan_cursor]) ++scan_cursor;
+            best = static_cast<std::uint32_t>(scan_cursor);
+        }
+
+        const std::uint32_t tri[3] = {Indices[best*3U], Indices[best*3U+1U], Indices[best*3U+2U]};
+        output.insert(output.end(), {static_cast<IndexTy>(tri[0]), static_cast<IndexTy>(tri[1]), static_cast<IndexTy>(tri[2])});
+        emitted[best] = true;
+
+        // 隣接リストから出力した三角形を取り除く
+        for(auto v : tri) {
+            auto* first = adjacency.data() + offsets[v];
+            auto* last = first + remaining[v];
+            auto* it = std::find(first, last, best);
+            if(it == last) continue; // 縮退三角形で同じ頂点が複数回現れた場合
+            *it = *(last-1);
+            --remaining[v];
+        }
+
+        // 出力した三角形の頂点をキャッシュの先頭へ
+        size_t new_count = 0U;
+        for(auto v : tri) {
+            if(std::find(new_cache.begin(), new_cache.begin()+new_count, v) == new_cache.begin()+new_count)
+                new_cache[new_count++] = v;
+        }
+        for(size_t i=0; i<cache_count; ++i) {
+            const auto v = cache[i];
+            if(v != tri[0] && v != tri[1] && v != tri[2])
+                new_cache[new_count++] = v;
+        }
+
+        // キャッシュから溢れた頂点も含めてスコアを更新
+        for(size_t i=0; i<new_count; ++i) {
+            const auto v = new_cache[i];
+            cache_position[v] = i<kForsythCacheSize ? static_cast<int>(i) : -1;
+            vertex_score[v] = vertexScore(cache_position[v], remaining[v]);
+        }
+
+        best = kInvalid;
+        float best_score = -1.0F;
+        for(size_t i=0; i<new_count; ++i) {
+            const auto v = new_cache[i];
+            for(std::uint32_t a=offsets[v]; a<offsets[v]+remaining[v]; ++a) {
+                const auto t = adjacency[a];
+                const float score = vertex_score[Indices[t*3U]] + vertex_score[Indices[t*3U+1U]] + vertex_score[Indices[t*3U+2U]];
+                triangle_score[t] = score;
+                if(score > best_score) { best_score = score; best = t; }
+            }
+        }
+
+        cache_count = std::min(new_count, static_cast<size_t>(kForsythCacheSize));
+        std::copy(new_cache.begin(), new_cache.begin()+cache_count, cache.begin());
+    }
+
+    std::copy(output.begin(), output.end(), Indices.begin());
+}
+
+// キャッシュの切れ目でクラスタに分割し、外側を向いたクラスタから順に並べ替える
+template <class IndexTy>
+void sortClusters(std::vector<IndexTy>& Indices, const std::vector<Vector3D>& Positions) {
+    const size_t num_triangles = Indices.size()/3U;
+    if(num_triangles == 0U || Positions.empty()) return;
+
+  // クラスタ分割
+  //  三角形の3頂点全てがキャッシュミスとなる位置を切れ目とする
+    std::vector<std::uint32_t> cluster_begin;
+    {
+        std::vector<size_t> stamps(Positions.size(), 0U);
+        size_t timestamp = kClusterCacheSize + 1U;
+        for(size_t t=0; t<num_triangles; ++t) {
+            size_t misses = 0U;
+            for(size_t k=0; k<3U; ++k) {
+                const size_t v = Indices[t*3U+k];
+                if(timestamp - stamps[v] > kClusterCacheSize) { stamps[v] = timestamp++; ++misses; }
+            }
+            if(t == 0U || misses == 3U) cluster_begin.push_back(static_cast<std::uint32_t>(t));
+        }
+        cluster_begin.push_back(static_cast<std::uint32_t>(num_triangles));
+    }
+    const size_t num_clusters = cluster_begin.size()-1U;
+    if(num_clusters <= 1U) return;
+
+  // クラスタ毎の重心(面積加重)と平均法線
+    std::vector<Vector3D> centroids(num_clusters);
+    std::vector<Vector3D> normals(num_clusters);
+    Vector3D mesh_centroid{0.0F, 0.0F, 0.0F};
+    float mesh_area = 0.0F;
+    for(size_t c=0; c<num_clusters; ++c) {
+        Vector3D centroid{0.0F, 0.0F, 0.0F};
+        Vector3D normal{0.0F, 0.0F, 0.0F};
+        float area = 0.0F;
+        for(std::uint32_t t=cluster_begin[c]; t<cluster_begin[c+1U]; ++t) {
+            const auto& p0 = Positions[Indices[t*3U]];
+            const auto& p1 = Positions[Indices[t*3U+1U]];
+            const auto& p2 = Positions[Indices[t*3U+2U]];
+            const float e1x = p1.x-p0.x, e1y = p1.y-p0.y, e1z = p1.z-p0.z;
+            const float e2x = p2.x-p0.x, e2y = p2.y-p0.y, e2z = p2.z-p0.z;
+            const float nx = e1y*e2z - e1z*e2y;
+            const float ny = e1z*e2x - e1x*e2z;
+            const float nz = e1x*e2y - e1y*e2x;
+            const float a = std::sqrt(nx*nx + ny*ny + nz*nz);
+            centroid.x += (p0.x+p1.x+p2.x) * a;
+            centroid.y += (p0.y+p1.y+p2.y) * a;
+            centroid.z += (p0.z+p1.z+p2.z) * a;
+            normal.x += nx; normal.y += ny; normal.z += nz;
+            area += a;
+        }
+        mesh_centroid.x += centroid.x; mesh_centroid.y += centroid.y; mesh_centroid.z += centroid.z;
+        mesh_area += area;
+
+        const float inv_area = area > 0.0F ? 1.0F / (area*3.0F) : 0.0F;
+        centroids[c] = Vector3D{centroid.x*inv_area, centroid.y*inv_area, centroid.z*inv_area};
+        const float len = std::sqrt(normal.x*normal.x + normal.y*normal.y + normal.z*normal.z);
+        const float inv_len = len > 0.0F ? 1.0F / len : 0.0F;
+        normals[c] = Vector3D{normal.x*inv_len, normal.y*inv_len, normal.z*inv_len};
+    }
+    if(mesh_area <= 0.0F) return;
+    const float inv_mesh_area = 1.0F / (mesh_area*3.0F);
+    mesh_centroid = Vector3D{mesh_centroid.x*inv_mesh_area, mesh_centroid.y*inv_mesh_area, mesh_centroid.z*inv_mesh_area};
+
+  // 外側を向いているほど先に描画する
+    std::vector<float> keys(num_clusters);
+    std::vector<std::uint32_t> order(num_clusters);
+    for(size_t c=0; c<num_clusters; ++c) {
+        keys[c] = (centroids[c].x-mesh_centroid.x)*normals[c].x
+                + (centroids[c].y-mesh_centroid.y)*normals[c].y
+                + (centroids[c].z-mesh_centroid.z)*normals[c].z;
+        order[c] = static_cast<std::uint32_t>(c);
+    }
+    std::stable_sort(order.begin(), order.end(), [&](const std::uint32_t L, const std::uint32_t R) {
+        return keys[L] > keys[R];
+    });
+
+    std::vector<IndexTy> output;
+    output.reserve(Indices.size());
+    for(auto c : order)
+        output.insert(output.end(), Indices.begin()+cluster_begin[c]*3U, Indices.begin()+cluster_begin[c+1U]*3U);
+    std::copy(output.begin(), output.end(), Indices.begin());
+}
+
+// 初めて参照された順に頂点番号を振り直す
+template <class IndexTy>
+std::vector<std::uint32_t> remapFetch(std::vector<IndexTy>& Indices, const size_t NumVertices) {
+    std::vector<std::uint32_t> remap(NumVertices, kInvalid);
+    std::uint32_t next = 0U;
+    for(auto& index : Indices) {
+        if(remap[index] == kInvalid) remap[index] = next++;
+        index = static_cast<IndexTy>(remap[index]);
+    }
+    for(auto& r : remap)
+        if(r == kInvalid) r = next++;
+    return remap;
+}
+} // unnamed namespace
+// EOF
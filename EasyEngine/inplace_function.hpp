@@ -0,0 +1,228 @@
+///
+/// \file   inplace_function.hpp
+/// \brief  動的確保を行わない関数オブジェクト定義ヘッダ
+///
+/// \author 板場
+///
+/// \par    履歴
+///         - 2026/10/19
+///             - ヘッダ追加
+///             - InplaceFunction<…> 定義
+///             - Delegate<…> 定義
+///             - result_type を追加(イベントコンテナ用)
+///
+#ifndef INCLUDED_EGEG_TLIB_INPLACE_FUNCTION_HEADER_
+#define INCLUDED_EGEG_TLIB_INPLACE_FUNCTION_HEADER_
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace easy_engine {
+namespace t_lib {
+
+/// InplaceFunction<…>の既定の容量(バイト)
+inline constexpr size_t kInplaceFunctionCapacity = 32U;
+
+template <class FTy>
+class Delegate;
+template <class FTy, size_t Capacity=kInplaceFunctionCapacity>
+class InplaceFunction;
+
+/******************************************************************************
+
+    Delegate
+
+******************************************************************************/
+///
+/// \brief  メンバ関数デリゲート
+///
+///         オブジェクトへのポインタと、呼び出す関数をテンプレート引数で受け取った中継関数のみを保持します。
+///         呼び出しは関数ポインタ経由の1回の間接呼び出しで、中継関数内では対象の関数がインライン展開されます。
+///         コピー可能で、動的確保は行いません。
+///
+///         生成例.) auto d = Delegate<void(Time)>::bind<&Hoge::update>(&hoge);
+///
+/// \tparam RetTy    : 戻り値型
+/// \tparam ArgTypes : 引数型リスト
+///
+template <class RetTy, class ...ArgTypes>
+class Delegate<RetTy(ArgTypes...)> {
+public :
+    template <class, size_t> friend class InplaceFunction;
+    using result_type = RetTy;
+
+    Delegate() noexcept = default;
+    Delegate(std::nullptr_t) noexcept {}
+
+    ///
+    /// \brief  メンバ関数を束縛したデリゲートを生成
+    ///
+    /// \tparam Function : 呼び出すメンバ関数へのポインタ
+    /// \tparam OwnerTy  : 関数のオーナークラス型
+    /// \param[in] Owner : 関数のオーナー
+    ///
+    template <auto Function, class OwnerTy>
+    static Delegate bind(OwnerTy* Owner) noexcept {
+        static_assert(std::is_member_function_pointer_v<decltype(Function)>, "'Function' must be member function pointer");
+        Delegate delegate;
+        delegate.owner_ = const_cast<void*>(static_cast<const void*>(Owner));
+        delegate.stub_ = [](const void* Self, ArgTypes... Args) -> RetTy {
+            OwnerTy* owner = static_cast<OwnerTy*>(static_cast<const Delegate*>(Self)->owner_);
+            return (owner->*Function)(std::forward<ArgTypes>(Args)...);
+        };
+        return delegate;
+    }
+
+    ///
+    /// \brief  非メンバ関数を束縛したデリゲートを生成
+    ///
+    /// \tparam Function : 呼び出す関数へのポインタ
+    ///
+    template <auto Function>
+    static Delegate bind() noexcept {
+        Delegate delegate;
+        delegate.stub_ = [](const void*, ArgTypes... Args) -> RetTy {
+            return Function(std::forward<ArgTypes>(Args)...);
+        };
+        return delegate;
+    }
+
+    RetTy operator()(ArgTypes... Args) const {
+        if(!stub_) throw std::bad_function_call{};
+        return stub_(this, std::forward<ArgTypes>(Args)...);
+    }
+
+    explicit operator bool() const noexcept { return stub_ != nullptr; }
+
+private :
+    using StubType = RetTy(*)(const void*, ArgTypes...);
+
+    void* owner_ = nullptr; // 中継関数は this をこのメンバへのポインタとして受け取る
+    StubType stub_ = nullptr;
+};
+
+/******************************************************************************
+
+    InplaceFunction
+
+******************************************************************************/
+///
+/// \brief  動的確保を行わない関数オブジェクト
+///
+///         std::function<…>と同様に任意の呼び出し可能オブジェクトを保持しますが、
+///         オブジェクト内の固定長の領域にのみ格納し、動的確保を行いません。
+///         容量を超える呼び出し可能オブジェクトはコンパイルエラーになります。
+///         ムーブのみ可能で、型情報(RTTI)は保持しません。
+///         Delegate<…>から構築した場合は、デリゲートの中継関数を直接呼び出します。
+///
+///         TaskManager<…>や各イベントコンテナの関数型として、そのまま指定できます。
+///         指定例.) EventVector<InplaceFunction<void()>>
+///
+/// \tparam RetTy    : 戻り値型
+/// \tparam ArgTypes : 引数型リスト
+/// \tparam Capacity : 呼び出し可能オブジェクトを格納する領域のサイズ(バイト)
+///
+template <class RetTy, class ...ArgTypes, size_t Capacity>
+class InplaceFunction<RetTy(ArgTypes...), Capacity> {
+public :
+    using result_type = RetTy;
+
+    InplaceFunction() noexcept = default;
+    InplaceFunction(std::nullptr_t) noexcept {}
+
+    ///
+    /// \brief  呼び出し可能オブジェクトを格納するコンストラクタ
+    ///
+    /// \tparam FTy : 格納する呼び出し可能オブジェクト型
+    /// \param[in] Function : 格納する呼び出し可能オブジェクト
+    ///
+    template <class FTy, class FuncTy=std::decay_t<FTy>,
+              class=std::enable_if_t<!std::is_same_v<FuncTy, InplaceFunction> &&
+                                     std::is_invocable_r_v<RetTy, FuncTy&, ArgTypes...>>>
+    InplaceFunction(FTy&& Function) {
+        static_assert(sizeof(FuncTy) <= Capacity, "'FTy' exceeds the capacity of InplaceFunction");
+        static_assert(alignof(FuncTy) <= alignof(std::max_align_t), "'FTy' is over-aligned");
+        static_assert(std::is_nothrow_move_constructible_v<FuncTy>, "'FTy' must be nothrow move constructible");
+
+        if constexpr(std::is_pointer_v<FuncTy> || std::is_member_pointer_v<FuncTy>) {
+            if(!Function) return;
+        }
+        if constexpr(std::is_same_v<FuncTy, Delegate<RetTy(ArgTypes...)>>) {
+            if(!Function) return;
+            invoke_ = Function.stub_;
+        }
+        else {
+            invoke_ = [](const void* Storage, ArgTypes... Args) -> RetTy {
+                return std::invoke(*static_cast<FuncTy*>(const_cast<void*>(Storage)), std::forward<ArgTypes>(Args)...);
+            };
+        }
+        ::new(static_cast<void*>(storage_)) FuncTy(std::forward<FTy>(Function));
+        if constexpr(!std::is_trivially_copyable_v<FuncTy> || !std::is_trivially_destructible_v<FuncTy>) {
+            manage_ = [](void* Dest, void* Src) noexcept {
+                FuncTy* src = static_cast<FuncTy*>(Src);
+                if(Dest) ::new(Dest) FuncTy(std::move(*src));
+                src->~FuncTy();
+            };
+        }
+    }
+
+    InplaceFunction(InplaceFunction&& Right) noexcept { moveFrom(Right); }
+    InplaceFunction& operator=(InplaceFunction&& Right) noexcept {
+        if(this != &Right) {
+            reset();
+            moveFrom(Right);
+        }
+        return *this;
+    }
+    InplaceFunction& operator=(std::nullptr_t) noexcept {
+        reset();
+        return *this;
+    }
+    ~InplaceFunction() { reset(); }
+
+    InplaceFunction(const InplaceFunction&) = delete;
+    InplaceFunction& operator=(const InplaceFunction&) = delete;
+
+    ///
+    /// \brief  格納している関数の呼び出し
+    ///
+    /// \throw  std::bad_function_call : 関数を格納していない場合
+    ///
+    RetTy operator()(ArgTypes... Args) const {
+        if(!invoke_) throw std::bad_function_call{};
+        return invoke_(storage_, std::forward<ArgTypes>(Args)...);
+    }
+
+    explicit operator bool() const noexcept { return invoke_ != nullptr; }
+
+private :
+    // 自明にコピー可能な関数オブジェクトは manage_ を持たず、領域をそのままコピーする
+    void moveFrom(InplaceFunction& Right) noexcept {
+        if(!Right.invoke_) return;
+        if(Right.manage_) Right.manage_(storage_, Right.storage_);
+        else              std::memcpy(storage_, Right.storage_, Capacity);
+        invoke_ = std::exchange(Right.invoke_, nullptr);
+        manage_ = std::exchange(Right.manage_, nullptr);
+    }
+    void reset() noexcept {
+        if(manage_) manage_(nullptr, storage_);
+        invoke_ = nullptr;
+        manage_ = nullptr;
+    }
+
+    using InvokeType = RetTy(*)(const void*, ArgTypes...);
+    using ManageType = void(*)(void*, void*) noexcept; // Dest が nullptr の場合は破棄のみ
+
+    alignas(std::max_align_t) unsigned char storage_[Capacity];
+    InvokeType invoke_ = nullptr;
+    ManageType manage_ = nullptr;
+};
+
+} // namespace t_lib
+} // namespace easy_engine
+#endif // !INCLUDED_EGEG_TLIB_INPLACE_FUNCTION_HEADER_
+// EOF
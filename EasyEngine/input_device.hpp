@@ -1,17 +1,20 @@
 ///
 /// \file   input_device.hpp
-/// \brief  ̓foCX`wb_
+/// \brief  入力デバイス基底定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/8/5
-///             - wb_ǉ
-///             - InputDevice `
+///             - ヘッダ追加
+///             - InputDevice 定義
+///         - 2026/10/19
+///             - 入力状態の保存、復元(stateSize, saveState, loadState)を追加
 ///
 #ifndef INCLUDED_EGEG_ILIB_INPUT_DEVICE_HEADER_
 #define INCLUDED_EGEG_ILIB_INPUT_DEVICE_HEADER_
 
+#include <cstddef>
 #include "noncopyable.hpp"
 #include "input_state.hpp"
 
@@ -24,23 +27,48 @@ namespace i_lib {
 
 ******************************************************************************/
 ///
-/// \brief  ̓foCX
+/// \brief  入力デバイス基底
 ///
-///         ͂ɊւNX͂̃NXƂĂB
-///         Rs[̓ftHgŋ֎~Ă܂B
-///         hNXŁARs[T|[gꍇ́AIɃRs[Z`ĂB
+///         入力に関するクラスはこのクラスを基底としてください。
+///         コピーはデフォルトで禁止しています。
+///         派生クラスで、コピーをサポートする場合は、明示的にコピー演算を定義してください。
 ///         
 class InputDevice : t_lib::Noncopyable<InputDevice> {
 public :
     virtual ~InputDevice() = default;
 
     ///
-    /// \brief  XV
+    /// \brief  更新処理
     ///
-    ///         hNX͂̊֐I[o[ChA
-    ///         ͏Ԃ̍XVsĂB
+    ///         派生クラスはこの関数をオーバーライドし、
+    ///         入力状態の更新を行ってください。
     ///
     virtual void update() = 0;
+
+    ///
+    /// \brief  保存する入力状態のサイズ
+    ///
+    ///         フレームの記録と再生(FrameRecorder)に対応するデバイスは、
+    ///         saveState(…), loadState(…) と合わせてオーバーライドしてください。
+    ///         0 のデバイスは記録されません。
+    ///
+    virtual size_t stateSize() const noexcept { return 0U; }
+
+    ///
+    /// \brief  入力状態を保存
+    ///
+    /// \param[out] Dest : 保存先(stateSize() バイト)
+    ///
+    virtual void saveState(void* Dest) const noexcept { (void)Dest; }
+
+    ///
+    /// \brief  保存した入力状態を復元
+    ///
+    ///         update() の後に呼び出され、update() で取得した状態を上書きします。
+    ///
+    /// \param[in] Src : saveState(…) で保存した入力状態
+    ///
+    virtual void loadState(const void* Src) noexcept { (void)Src; }
 };
 
 } // namespace i_lib
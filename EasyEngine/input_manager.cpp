@@ -1,11 +1,13 @@
-// 쐬 : 
+// 作成者 : 板場
 /******************************************************************************
 
     include
 
 ******************************************************************************/
 #include "input_manager.hpp"
+#ifdef _WIN32
 #include "keyboard.hpp"
+#endif
 
 
 /******************************************************************************
@@ -30,10 +32,12 @@ void imanager_ns::InputManager::update() {
         device.second->update();
 }
 
+#ifdef _WIN32
 void imanager_ns::InputManager::keyEvent(const UINT Msg, const WPARAM wPrm, const LPARAM lPrm) const noexcept {
     auto device_itr = devices_.find(t_lib::TypeIDGenerator<Keyboard>{});
     if(device_itr != devices_.end()) {
         static_cast<Keyboard*>(device_itr->second.get())->eventProcessing(Msg, wPrm, lPrm);
     }
 }
+#endif // _WIN32
 // EOF
@@ -1,26 +1,32 @@
 ///
 /// \file   input_manager.hpp
-/// \brief  ̓}l[W[`wb_
+/// \brief  入力マネージャー定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/8/19
-///             - wb_ǉ
-///             - InputManager `
+///             - ヘッダ追加
+///             - InputManager 定義
+///         - 2026/10/19
+///             - FrameRecorder からの入力状態の記録と再生に対応
+///             - Windows 以外でのビルドに対応(キーボードのメッセージ処理は Windows のみ)
 ///
 #ifndef INCLUDED_EGEG_ILIB_INPUT_MANAGER_HEADER_
 #define INCLUDED_EGEG_ILIB_INPUT_MANAGER_HEADER_
 
 #include <memory>
 #include <unordered_map>
+#ifdef _WIN32
 #include <Windows.h>
+#endif
 #include "noncopyable.hpp"
 #include "input_device.hpp"
 #include "id.hpp"
 
 namespace easy_engine {
 class EasyEngine;
+class FrameRecorder;
 
 namespace i_lib {
 
@@ -30,26 +36,27 @@ namespace i_lib {
 
 ******************************************************************************/
 ///
-/// \brief  ̓}l[W[
+/// \brief  入力マネージャー
 ///
-///         ̃NXւ̃ANZX́AEasyEngine::input()gpĂB
+///         このクラスへのアクセスは、EasyEngine::input()を使用してください。
 ///
 class InputManager final : t_lib::Noncopyable<InputManager> {
 public :
     friend EasyEngine;
+    friend FrameRecorder; // 入力状態の記録と再生
 
     ~InputManager() = default;
 
     ///
-    /// \brief  ̓foCXƐڑ
+    /// \brief  入力デバイスと接続
     ///
-    ///         ɐڑĂꍇ́AVǉɊɂfoCXԋp܂B
+    ///         既に接続されている場合は、新しく追加せずに既にあるデバイスを返却します。
     ///
-    /// \tparam DeviceTy : ڑ̓foCX
-    /// \tparam ArgTypes : ̓foCX̃RXgN^ɓ]^Xg
-    /// \param[in] Args : ̓foCX̃RXgN^ɓ]Xg
+    /// \tparam DeviceTy : 接続する入力デバイス
+    /// \tparam ArgTypes : 入力デバイスのコンストラクタに転送する引数型リスト
+    /// \param[in] Args : 入力デバイスのコンストラクタに転送する引数リスト
     ///
-    /// \return ڑ̓foCXւ̃|C^
+    /// \return 接続した入力デバイスへのポインタ
     ///
     template <class DeviceTy, class ...ArgTypes>
     const DeviceTy* connect(ArgTypes&& ...Args) {
@@ -62,9 +69,9 @@ public :
     }
 
     ///
-    /// \brief  ̓foCX̐ڑ
+    /// \brief  入力デバイスの接続を解除
     ///
-    /// \tparam DeviceTy : ڑfoCX
+    /// \tparam DeviceTy : 接続を解除するデバイス
     ///
     template <class DeviceTy>
     void disconnect() noexcept(noexcept(devices_.erase(t_lib::TypeIDGenerator<DeviceTy>{}))) {
@@ -72,13 +79,13 @@ public :
     }
 
     ///
-    /// \brief  ڑĂfoCX擾
+    /// \brief  接続されているデバイスを取得
     ///
-    ///         w肳ꂽfoCXڑĂȂꍇnullptrԋp܂B
+    ///         指定されたデバイスが接続されていない場合はnullptrを返却します。
     ///
-    /// \tparam DeviceTy : 擾foCX
+    /// \tparam DeviceTy : 取得するデバイス
     ///
-    /// \return foCXւ̃|C^
+    /// \return デバイスへのポインタ
     ///
     template <class DeviceTy>
     const DeviceTy* device() const {
@@ -89,9 +96,11 @@ public :
     }
 
 private :
-    static std::unique_ptr<InputManager> create();      // EasyEngineNXɂĂяo֐
-    void update();                                      // 㓯 ێfoCXׂčXV
-    void keyEvent(UINT, WPARAM, LPARAM) const noexcept; // 㓯 L[{[h̃CxgbZ[W
+    static std::unique_ptr<InputManager> create();      // EasyEngineクラスにより呼び出される関数
+    void update();                                      // 上同 保持するデバイスをすべて更新する
+#ifdef _WIN32
+    void keyEvent(UINT, WPARAM, LPARAM) const noexcept; // 上同 キーボードのイベントメッセージ処理
+#endif
 
     InputManager() = default;
 
@@ -1,14 +1,14 @@
 ///
 /// \file   input_state.hpp
-/// \brief  ͏ԂɊւ`Qwb_
+/// \brief  入力状態に関する定義群ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/8/5
-///             - wb_ǉ
-///             - InputFlagType `
-///             - ͏Ԕ֐`
+///             - ヘッダ追加
+///             - InputFlagType 定義
+///             - 入力状態判定関数定義
 ///
 #ifndef INCLUDED_EGEG_ILIB_INPUT_STATE_HEADER_
 #define INCLUDED_EGEG_ILIB_INPUT_STATE_HEADER_
@@ -20,52 +20,52 @@ namespace i_lib {
 
 using InputFlagType = uint8_t;
 
-constexpr InputFlagType kNoInput = 0b000U; ///< ͂Ȃ
-constexpr InputFlagType kInput   = 0b001U; ///< ͂tO
-constexpr InputFlagType kDown    = 0b010U; ///< tO
-constexpr InputFlagType kUp      = 0b100U; ///< 㒼tO
+constexpr InputFlagType kNoInput = 0b000U; ///< 入力なし
+constexpr InputFlagType kInput   = 0b001U; ///< 入力ありフラグ
+constexpr InputFlagType kDown    = 0b010U; ///< 押下直後フラグ
+constexpr InputFlagType kUp      = 0b100U; ///< 離上直後フラグ
 
 ///
-/// \brief  ͂肩ǂ
+/// \brief  入力ありかどうか判定
 ///
-/// \param[in] State : 肷͂̏
+/// \param[in] State : 判定する入力の状態
 ///
-/// \return ͂true@Ȃfalse
+/// \return 入力があればtrue　なければfalse
 ///
 inline constexpr bool isInput(const InputFlagType State) noexcept {
     return State & kInput;
 }
 
 ///
-/// \brief  ͂pԂɂ邩ǂ
+/// \brief  入力が継続状態にあるかどうか判定
 ///
-///         ͒̏ԂfalseƂ݂Ȃ܂B
+///         入力直後の状態はfalseとみなします。
 ///
-/// \param[in] State : 肷͂̏
+/// \param[in] State : 判定する入力の状態
 ///
-/// \return pԂłtrue@łȂfalse
+/// \return 継続状態であればtrue　でなければfalse
 ///
 inline constexpr bool isHold(const InputFlagType State) noexcept {
     return State == kInput;
 }
 
 ///
-/// \brief  ͒̏Ԃǂ
+/// \brief  入力直後の状態かどうか判定
 ///
-/// \param[in] State : 肷͂̏
+/// \param[in] State : 判定する入力の状態
 ///
-/// \return ͒łtrue@łȂfalse
+/// \return 入力直後であればtrue　そうでなければfalse
 ///
 inline constexpr bool isDown(const InputFlagType State) noexcept {
     return State & kDown;
 }
 
 ///
-/// \brief  ͉̏Ԃǂ
+/// \brief  入力解除直後の状態かどうか判定
 ///
-/// \param[in] State : 肷͂̏
+/// \param[in] State : 判定する入力の状態
 ///
-/// \ return łtrue@łȂfalse
+/// \ return 解除直後であればtrue　そうでなければfalse
 ///
 inline constexpr bool isUp(const InputFlagType State) noexcept {
     return State & kUp;
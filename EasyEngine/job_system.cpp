@@ -0,0 +1,296 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include "job_system.hpp"
+#include <cassert>
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace js_ns = easy_engine::t_lib;
+namespace {
+    using easy_engine::t_lib::job_impl::Job;
+
+    constexpr size_t kPoolSize = 4096U;     // スレッド毎のジョブ数(2の累乗)
+    constexpr size_t kDequeSize = kPoolSize; // デックの容量 プール以上にしておけば溢れない
+    constexpr int kSpinCount = 64;          // 休眠するまでにジョブを探す回数
+
+    // 現在のスレッドが属するジョブシステムと、その中での番号
+    thread_local const js_ns::JobSystem* tls_system = nullptr;
+    thread_local size_t tls_index = 0U;
+} // unnamed namespace
+
+// ワーカー毎のデータ
+//  デックは Chase-Lev(Le et al. 2013 の固定長版)
+//  bottom は所有スレッドのみが操作し、top は盗む側と取り合う
+struct js_ns::JobSystem::Worker {
+    bool push(Job*) noexcept;
+    Job* pop() noexcept;
+    Job* steal() noexcept;
+
+    alignas(64) std::atomic<std::int64_t> top{0};
+    alignas(64) std::atomic<std::int64_t> bottom{0};
+    alignas(64) std::unique_ptr<std::atomic<Job*>[]> buffer{new std::atomic<Job*>[kDequeSize]};
+    std::unique_ptr<Job[]> pool{new Job[kPoolSize]};
+    size_t next_job = 0U;
+    std::uint32_t random = 0U;
+    std::thread thread;
+};
+
+// 全スレッドで共有するデータ
+struct js_ns::JobSystem::Shared {
+    std::atomic<bool> running{true};
+    std::atomic<std::int64_t> queued{0};    // デックに積まれているジョブ数(起床判定用の目安)
+    std::atomic<int> sleeping{0};
+    std::mutex mutex;
+    std::condition_variable condition;
+
+  // ジョブシステムに属していないスレッドから登録されたジョブ
+  //  デックは所有スレッドしか積めないため、ロック付きのキューを経由してワーカーに渡す
+  //  キューに積まれているジョブは全てプールの使用中のジョブなので、キューは溢れない
+    std::mutex inject_mutex;
+    std::unique_ptr<Job[]> inject_pool{new Job[kPoolSize]};
+    std::unique_ptr<Job*[]> injected{new Job*[kPoolSize]};
+    size_t inject_next = 0U;                // プールの次に確認する位置
+    size_t inject_head = 0U;                // キューの先頭
+    size_t inject_size = 0U;
+    std::atomic<size_t> num_injected{0U};   // ロックせずに空かを確認する用
+};
+
+
+/******************************************************************************
+
+    JobSystem::
+
+******************************************************************************/
+js_ns::JobSystem::JobSystem(size_t NumWorkers) :
+    shared_{std::make_unique<Shared>()} {
+    if(NumWorkers == 0U) NumWorkers = std::max(1U, std::thread::hardware_concurrency()) - 1U;
+    num_threads_ = NumWorkers + 1U;
+    workers_ = std::make_unique<Worker[]>(num_threads_);
+
+    tls_system = this;
+    tls_index = 0U;
+    for(size_t i=0; i<num_threads_; ++i)
+        workers_[i].random = static_cast<std::uint32_t>(i*2654435761U + 1U);
+    for(size_t i=1U; i<num_threads_; ++i)
+        workers_[i].thread = std::thread{&JobSystem::workerMain, this, i};
+}
+
+js_ns::JobSystem::~JobSystem() {
+    // 残っているジョブを全て実行してから停止
+    while(executeOne()) {}
+
+    {
+        std::lock_guard<std::mutex> lock{shared_->mutex};
+        shared_->running.store(false);
+    }
+    shared_->condition.notify_all();
+    for(size_t i=1U; i<num_threads_; ++i)
+        workers_[i].thread.join();
+
+    if(tls_system == this) tls_system = nullptr;
+}
+
+void js_ns::JobSystem::wait(const JobCounter& Counter) {
+    // ジョブシステムに属していないスレッドは、ジョブを実行せずに待つ
+    while(!Counter.done()) {
+        if(!executeOne()) std::this_thread::yield();
+    }
+}
+
+void js_ns::JobSystem::inject(Job* Target) {
+    {
+        std::lock_guard<std::mutex> lock{shared_->inject_mutex};
+        shared_->injected[(shared_->inject_head+shared_->inject_size) & (kPoolSize-1U)] = Target;
+        ++shared_->inject_size;
+        shared_->num_injected.fetch_add(1U, std::memory_order_release);
+    }
+    shared_->queued.fetch_add(1);
+    if(shared_->sleeping.load() > 0) {
+        std::lock_guard<std::mutex> lock{shared_->mutex};
+        shared_->condition.notify_one();
+    }
+}
+
+bool js_ns::JobSystem::executeOne() {
+    if(!isJobThread()) return false;
+    Job* job = acquire(threadIndex());
+    if(!job) return false;
+    execute(*job);
+    return true;
+}
+
+size_t js_ns::JobSystem::threadIndex() const noexcept {
+    assert(tls_system == this && "ジョブシステムに属していないスレッドから呼び出されました。");
+    return tls_index;
+}
+
+bool js_ns::JobSystem::isJobThread() const noexcept {
+    return tls_system == this;
+}
+
+// ジョブを確保
+//  使用中のジョブに当たった場合は、他のジョブを実行しながら空きを待つ
+//  ジョブシステムに属していないスレッドは、共有のプールから確保する(空きが無ければ完了を待つ)
+js_ns::job_impl::Job* js_ns::JobSystem::allocate() {
+    if(!isJobThread()) {
+        for(;;) {
+            {
+                std::lock_guard<std::mutex> lock{shared_->inject_mutex};
+                for(size_t i=0; i<kPoolSize; ++i) {
+                    Job& job = shared_->inject_pool[shared_->inject_next++ & (kPoolSize-1U)];
+                    if(!job.busy.load(std::memory_order_acquire)) {
+                        job.busy.store(true, std::memory_order_relaxed);
+                        return &job;
+                    }
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    Worker& worker = workers_[threadIndex()];
+    for(;;) {
+        Job& job = worker.pool[worker.next_job++ & (kPoolSize-1U)];
+        if(!job.busy.load(std::memory_order_acquire)) {
+            job.busy.store(true, std::memory_order_relaxed);
+            return &job;
+        }
+        if(!executeOne()) std::this_thread::yield();
+    }
+}
+
+// ジョブを自スレッドのデックへ積み、休眠中のワーカーを起こす
+//  ジョブシステムに属していないスレッドからは、共有のキューへ積む
+void js_ns::JobSystem::submit(Job* Target) {
+    if(!isJobThread()) {
+        inject(Target);
+        return;
+    }
+    if(!workers_[threadIndex()].push(Target)) {
+        execute(*Target);
+        return;
+    }
+    shared_->queued.fetch_add(1);
+    if(shared_->sleeping.load() > 0) {
+        std::lock_guard<std::mutex> lock{shared_->mutex};
+        shared_->condition.notify_one();
+    }
+}
+
+// 自スレッドのデックから取り出し、無ければ共有のキュー、他のスレッドの順に探す
+js_ns::job_impl::Job* js_ns::JobSystem::acquire(const size_t Index) {
+    Worker& self = workers_[Index];
+    Job* job = self.pop();
+    if(!job && shared_->num_injected.load(std::memory_order_acquire) > 0U) {
+        std::lock_guard<std::mutex> lock{shared_->inject_mutex};
+        if(shared_->inject_size > 0U) {
+            job = shared_->injected[shared_->inject_head];
+            shared_->inject_head = (shared_->inject_head+1U) & (kPoolSize-1U);
+            --shared_->inject_size;
+            shared_->num_injected.fetch_sub(1U, std::memory_order_relaxed);
+        }
+    }
+    if(!job) {
+        // xorshift で盗み始める位置をずらし、特定のスレッドへの集中を避ける
+        self.random ^= self.random << 13;
+        self.random ^= self.random >> 17;
+        self.random ^= self.random << 5;
+        const size_t offset = self.random % num_threads_;
+        for(size_t i=0; i<num_threads_ && !job; ++i) {
+            const size_t victim = (offset+i) % num_threads_;
+            if(victim != Index) job = workers_[victim].steal();
+        }
+    }
+    if(job) shared_->queued.fetch_sub(1, std::memory_order_relaxed);
+    return job;
+}
+
+void js_ns::JobSystem::execute(Job& Target) {
+    Target.invoke(Target);
+    Target.destroy(Target);
+    if(Target.counter) Target.counter->fetch_sub(1U, std::memory_order_release);
+    Target.busy.store(false, std::memory_order_release);
+}
+
+void js_ns::JobSystem::workerMain(const size_t Index) {
+    tls_system = this;
+    tls_index = Index;
+
+    while(shared_->running.load(std::memory_order_relaxed)) {
+        if(executeOne()) continue;
+
+        // しばらく探しても無ければ休眠
+        bool found = false;
+        for(int spin=0; spin<kSpinCount && !found; ++spin) {
+            std::this_thread::yield();
+            found = executeOne();
+        }
+        if(found) continue;
+
+        std::unique_lock<std::mutex> lock{shared_->mutex};
+        shared_->sleeping.fetch_add(1);
+        shared_->condition.wait(lock, [this]() {
+            return shared_->queued.load() > 0 || !shared_->running.load();
+        });
+        shared_->sleeping.fetch_sub(1);
+    }
+}
+
+
+/******************************************************************************
+
+    JobSystem::Worker::
+
+******************************************************************************/
+bool js_ns::JobSystem::Worker::push(Job* Target) noexcept {
+    const std::int64_t b = bottom.load(std::memory_order_relaxed);
+    const std::int64_t t = top.load(std::memory_order_acquire);
+    if(b-t >= static_cast<std::int64_t>(kDequeSize)) return false;
+    buffer[b & (kDequeSize-1U)].store(Target, std::memory_order_relaxed);
+    bottom.store(b+1, std::memory_order_release);
+    return true;
+}
+
+js_ns::job_impl::Job* js_ns::JobSystem::Worker::pop() noexcept {
+    const std::int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+    bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t t = top.load(std::memory_order_relaxed);
+    if(t > b) {
+        // 空
+        bottom.store(b+1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    Job* job = buffer[b & (kDequeSize-1U)].load(std::memory_order_relaxed);
+    if(t == b) {
+        // 最後の1つは盗む側と取り合う
+        if(!top.compare_exchange_strong(t, t+1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            job = nullptr;
+        bottom.store(b+1, std::memory_order_relaxed);
+    }
+    return job;
+}
+
+js_ns::job_impl::Job* js_ns::JobSystem::Worker::steal() noexcept {
+    std::int64_t t = top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const std::int64_t b = bottom.load(std::memory_order_acquire);
+    if(t >= b) return nullptr;
+    Job* job = buffer[t & (kDequeSize-1U)].load(std::memory_order_relaxed);
+    if(!top.compare_exchange_strong(t, t+1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        return nullptr;
+    return job;
+}
+// EOF
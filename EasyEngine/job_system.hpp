@@ -0,0 +1,191 @@
+///
+/// \file   job_system.hpp
+/// \brief  ジョブシステム定義ヘッダ
+///
+///         ワーカースレッド毎の Chase-Lev デックと、ワークスティーリングによるジョブシステムです。
+///         エンジンからは EasyEngine::jobs() で取得できます。
+///
+/// \author 板場
+///
+/// \par    履歴
+///         - 2026/10/19
+///             - ヘッダ追加
+///             - JobCounter 定義
+///             - JobSystem 定義
+///             - isJobThread() 追加
+///             - ジョブシステムに属していないスレッドからの登録を、共有のキュー経由に変更
+///
+#ifndef INCLUDED_EGEG_TLIB_JOB_SYSTEM_HEADER_
+#define INCLUDED_EGEG_TLIB_JOB_SYSTEM_HEADER_
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "noncopyable.hpp"
+
+namespace easy_engine {
+namespace t_lib {
+
+class JobSystem;
+
+namespace job_impl {
+    constexpr size_t kJobStorageSize = 48U; ///< ジョブに格納できる関数オブジェクトの最大サイズ
+
+    ///< ジョブ
+    struct Job {
+        void (*invoke)(Job&);
+        void (*destroy)(Job&);
+        std::atomic<std::uint32_t>* counter;
+        std::atomic<bool> busy{false};
+        alignas(std::max_align_t) unsigned char storage[kJobStorageSize];
+    };
+} // namespace job_impl
+
+/******************************************************************************
+
+    JobCounter
+
+******************************************************************************/
+///
+/// \brief  ジョブカウンター
+///
+///         ジョブの登録時に渡すと、完了していないジョブの数を数えます。
+///         JobSystem::wait(…)に渡すことで、ジョブの完了を待機できます。
+///         同じカウンターを複数のジョブで共有できます。
+///
+class JobCounter final : Noncopyable<JobCounter> {
+public :
+    friend JobSystem;
+
+    JobCounter() = default;
+
+    /// 全てのジョブが完了しているか
+    bool done() const noexcept { return count_.load(std::memory_order_acquire) == 0U; }
+    /// 完了していないジョブの数
+    std::uint32_t pending() const noexcept { return count_.load(std::memory_order_acquire); }
+
+private :
+    std::atomic<std::uint32_t> count_{0U};
+};
+
+/******************************************************************************
+
+    JobSystem
+
+******************************************************************************/
+///
+/// \brief  ジョブシステム
+///
+///         ジョブは登録したスレッドのデックに積まれ、空いているスレッドに盗まれて実行されます。
+///         wait(…)で待機している間は、待機しているスレッドもジョブを実行します。
+///
+///         ジョブシステムに属していないスレッドからも登録、待機ができます。
+///         その場合、ジョブはロック付きの共有のキューを経由してワーカーに渡され、待機中はジョブを実行しません。
+///         (デックへの登録より遅いため、多数のジョブを登録する場合はジョブの中から登録してください。)
+///         ワーカースレッドが無い場合、共有のキューのジョブは生成したスレッドの待機中に実行されます。
+///
+/// \par    使用例
+///         \code
+///         JobCounter counter;
+///         for(auto& chunk : chunks)
+///             jobs.run([&chunk]{ chunk.update(); }, &counter);
+///         jobs.wait(counter);
+///         \endcode
+///
+class JobSystem final : Noncopyable<JobSystem> {
+public :
+    ///
+    /// \brief  コンストラクタ
+    ///
+    ///         ワーカースレッドを生成します。
+    ///
+    /// \param[in] NumWorkers : ワーカースレッドの数(0 : ハードウェアの並列数-1)
+    ///
+    explicit JobSystem(size_t NumWorkers=0U);
+    ~JobSystem();
+
+    ///
+    /// \brief  ジョブを登録
+    ///
+    ///         関数オブジェクトはジョブ内の領域に構築され、ヒープ確保は行いません。
+    ///         登録先のデックが満杯の場合は、その場で実行します。
+    ///
+    /// \tparam FTy : 関数オブジェクト型(void() で呼び出し可能)
+    /// \param[in] Func    : 実行する関数オブジェクト
+    /// \param[in] Counter : ジョブカウンター(nullptr : 完了を待機しない)
+    ///
+    template <class FTy>
+    void run(FTy&& Func, JobCounter* Counter=nullptr) {
+        using FuncType = std::decay_t<FTy>;
+        static_assert(sizeof(FuncType) <= job_impl::kJobStorageSize, "'FTy' is too large for the job storage");
+        static_assert(alignof(FuncType) <= alignof(std::max_align_t), "'FTy' is over-aligned");
+
+        job_impl::Job* job = allocate();
+        ::new(job->storage) FuncType(std::forward<FTy>(Func));
+        job->invoke = [](job_impl::Job& J) { (*std::launder(reinterpret_cast<FuncType*>(J.storage)))(); };
+        job->destroy = [](job_impl::Job& J) { std::launder(reinterpret_cast<FuncType*>(J.storage))->~FuncType(); };
+        job->counter = Counter ? &Counter->count_ : nullptr;
+        if(Counter) Counter->count_.fetch_add(1U, std::memory_order_relaxed);
+        submit(job);
+    }
+
+    ///
+    /// \brief  ジョブの完了を待機
+    ///
+    ///         待機中は、このスレッドもジョブを実行します。
+    ///
+    /// \param[in] Counter : 待機するジョブカウンター
+    ///
+    void wait(const JobCounter& Counter);
+
+    ///
+    /// \brief  溜まっているジョブを1つ実行
+    ///
+    ///         ジョブシステムに属していないスレッドからの呼び出しでは、何もしません。
+    ///
+    /// \return ジョブを実行したか
+    ///
+    bool executeOne();
+
+    /// ジョブを実行するスレッドの数(ワーカー + 生成したスレッド)
+    size_t numThreads() const noexcept { return num_threads_; }
+
+    ///
+    /// \brief  現在のスレッドの番号を取得
+    ///
+    ///         0 はジョブシステムを生成したスレッド、1～ はワーカースレッドです。
+    ///         スレッド毎のデータの添え字に使用できます。
+    ///
+    size_t threadIndex() const noexcept;
+
+    ///
+    /// \brief  現在のスレッドがジョブシステムに属しているか
+    ///
+    ///         false の場合、ジョブの登録は共有のキューを経由し、待機中にジョブを実行しません。
+    ///
+    bool isJobThread() const noexcept;
+
+private :
+    struct Worker;
+
+    job_impl::Job* allocate();
+    void submit(job_impl::Job*);
+    void inject(job_impl::Job*);
+    job_impl::Job* acquire(size_t);
+    void execute(job_impl::Job&);
+    void workerMain(size_t);
+
+    size_t num_threads_;
+    std::unique_ptr<Worker[]> workers_;
+    struct Shared;
+    std::unique_ptr<Shared> shared_;
+};
+
+} // namespace t_lib
+} // namespace easy_engine
+#endif // !INCLUDED_EGEG_TLIB_JOB_SYSTEM_HEADER_
+// EOF
@@ -1,4 +1,4 @@
-// 쐬 : 
+// 作成者 : 板場
 /******************************************************************************
 
     include
@@ -13,8 +13,8 @@
 ******************************************************************************/
 namespace keyboard_ns = easy_engine::i_lib;
 namespace {
-    constexpr size_t kBlockSize = sizeof(uint8_t)*8U;        // Rei1ubNbit
-    constexpr size_t kNumContainerBlock = 256U / kBlockSize; // 256bit ۑ邽߂ɕKvȗvf
+    constexpr size_t kBlockSize = sizeof(uint8_t)*8U;        // コンテナの1ブロックのbit数
+    constexpr size_t kNumContainerBlock = 256U / kBlockSize; // 256bit を保存するために必要な要素数
     constexpr size_t blockIdx(const uint8_t VK) noexcept { return static_cast<uint8_t>(VK * (1.0F/8.0F)); }
     constexpr uint8_t keyMask(const uint8_t VK) noexcept { return VK % 8; }
 } // unnamed namespace
@@ -27,7 +27,7 @@ namespace {
 keyboard_ns::Keyboard::Keyboard() : raw_(kNumContainerBlock), last_(kNumContainerBlock) {}
 
 void keyboard_ns::Keyboard::eventProcessing(const UINT Mes, const WPARAM wPrm, const LPARAM lPrm) noexcept {
-    auto getDetailedVK = [wPrm]()->uint8_t { // CL[̏ꍇEʂzL[R[hԋp
+    auto getDetailedVK = [wPrm]()->uint8_t { // 修飾キーの場合左右を区別した仮想キーコードを返却
         if(wPrm==VK_SHIFT)
             return GetKeyState(VK_LSHIFT) ? VK_LSHIFT : VK_RSHIFT;
         if(wPrm==VK_CONTROL)
@@ -49,8 +49,8 @@ void keyboard_ns::Keyboard::eventProcessing(const UINT Mes, const WPARAM wPrm, c
     }
 }
 
-// Ԃi[\̂̐擪ԂύXĂB
-// |C^ɂ葖Ă邽߁AgpĂȂpadding̈ɂĂԂ̕ύXs
+// 状態を格納する構造体の先頭から状態を変更していく。
+// ポインタにより走査しているため、使用していないpadding領域についても状態の変更が行われる
 void keyboard_ns::Keyboard::update() {
     for(size_t i=0; i<kNumContainerBlock; ++i)
       for(size_t j=0; j<kBlockSize; ++j) {
@@ -59,12 +59,12 @@ void keyboard_ns::Keyboard::update() {
           *ptr = newState(vk);
       }
 
-    std::swap(raw_, last_); // ݂̏ԂȌԂցAraw_͐VKCxgɂ㏑悤ɂȂ
+    std::swap(raw_, last_); // 現在の状態を前回の状態へ、raw_は新規イベントにより上書きされるようになる
 }
 
-// zANZXɂ
-// blockIdxɂԂĺAuint8_t ̍ől255nĂ؂̂Ă31ɂȂBc 255 * (1.0F/8.0F) = 31.875F;
-// L[̏Ԋi[pRei̗vf32(Y31)Ȃ̂ŁA͈͊OANZX̗O͔Ȃ
+// 配列アクセスについて
+// blockIdxにより返される値は、uint8_t の最大値255を渡しても切り捨てが発生して31になる。… 255 * (1.0F/8.0F) = 31.875F;
+// キーの状態格納用コンテナの要素数は32(添え字31)なので、範囲外アクセスの例外は発生しない
 void keyboard_ns::Keyboard::keyDown(const uint8_t VK) noexcept {
     raw_[blockIdx(VK)] |= keyMask(VK);
 }
@@ -1,16 +1,19 @@
 ///
 /// \file   keyboard.hpp
-/// \brief  ̓foCXuL[{[hv
+/// \brief  入力デバイス「キーボード」
 ///
-/// \authro 
+/// \authro 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/8/6
-///             - wb_ǉ
+///             - ヘッダ追加
+///         - 2026/10/19
+///             - 入力状態の保存、復元に対応
 ///
 #ifndef INCLUDED_EGEG_ILIB_KEYBOARD_HEADER_
 #define INCLUDED_EGEG_ILIB_KEYBOARD_HEADER_
 
+#include <cstring>
 #include <vector>
 #include <Windows.h>
 #include "input_device.hpp"
@@ -24,18 +27,18 @@ namespace i_lib {
 
 ******************************************************************************/
 ///
-/// \brief  L[{[h
+/// \brief  キーボード
 ///
-///         update()݂̂ł͓͏Ԃ̍XV͍s܂B
-///         evnentProcessing(c)ɂCxgƑgݍ킹Kv܂B
+///         update()のみでは入力状態の更新は行われません。
+///         evnentProcessing(…)によるイベント処理と組み合わせる必要があります。
 ///
 class Keyboard : public InputDevice {
 public :
     ///
-    /// \struct ͏Ԋi[p\
+    /// \struct 入力状態格納用構造体
     ///
-    /// \details ꂼ̃oA̖OL[̏Ԃi[Ă܂B\n
-    ///          egeg::i_lib OԂɂis~~ ֐gp邱ƂŊȒPɏԂ𒲂ׂ邱Ƃł܂B
+    /// \details それぞれのメンバが、その名前が示すキーの状態を格納しています。\n
+    ///          egeg::i_lib 名前空間にあるis~~ 関数を使用することで簡単に状態を調べることができます。
     ///
     struct State {
         InputFlagType padding0[8];           // 0x00 ~ 0x07
@@ -146,27 +149,30 @@ public :
     Keyboard();
 
     ///
-    /// \brief  Cxg
+    /// \brief  イベント処理
     ///
-    ///         Windows̃R[obN֐ɂ̊֐LqĂB
-    ///         ͏Ԃ擾܂B
-    ///         ͏Ԃ̍XV͂̊֐ł͍s܂Bupdate֐gpĂB
+    ///         Windowsのコールバック関数にこの関数を記述してください。
+    ///         入力状態を取得します。
+    ///         入力状態の更新はこの関数では行われません。update関数を使用してください。
     ///
-    /// \param[in] Msg : CxgbZ[W
-    /// \param[in] wParam : Cxgڍ
-    /// \param[in] lParam : Cxgڍ
+    /// \param[in] Msg : イベントメッセージ
+    /// \param[in] wParam : イベント詳細
+    /// \param[in] lParam : イベント詳細
     ///
     void eventProcessing(UINT Msg, WPARAM wParam, LPARAM lParam) noexcept;
 
     ///
-    /// \brief  ͏Ԃ擾
+    /// \brief  入力状態を取得
     ///
-    /// \return ͏Ԃi[\
+    /// \return 入力状態を格納した構造体
     ///
     const State& getState() const noexcept { return state_; }
 
 // override
     void update() override;
+    size_t stateSize() const noexcept override { return sizeof(State); }
+    void saveState(void* Dest) const noexcept override { std::memcpy(Dest, &state_, sizeof(State)); }
+    void loadState(const void* Src) noexcept override { std::memcpy(&state_, Src, sizeof(State)); }
 private :
     void keyDown(uint8_t) noexcept;
     void keyUp(uint8_t) noexcept;
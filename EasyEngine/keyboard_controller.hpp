@@ -1,15 +1,15 @@
 ///
 /// \file   keyboard_controller.hpp
-/// \brief  L[{[hpRg[[
+/// \brief  キーボード用コントローラー
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/8/7
-///             - wb_ǉ
-///             - Keys `
-///             - KeyboardCtrlerImpl `
-///             - KeyboardController `
+///             - ヘッダ追加
+///             - Keys 定義
+///             - KeyboardCtrlerImpl 定義
+///             - KeyboardController 定義
 ///
 #ifndef INCLUDED_EGEG_ILIB_KEYBOARD_CONTROLLER_HEADER_
 #define INCLUDED_EGEG_ILIB_KEYBOARD_CONTROLLER_HEADER_
@@ -110,7 +110,7 @@ namespace i_lib {
         kCapsLock = 0xF0
     };
 
-    class KeyboardCtrlerImpl { // ev[go
+    class KeyboardCtrlerImpl { // 非テンプレート部抽出
     public :
         KeyboardCtrlerImpl(const Keyboard* Device) noexcept : keyboard_{Device} {}
         void resetKeyboard(const Keyboard* Device=nullptr) noexcept { keyboard_ = Device; }
@@ -127,14 +127,14 @@ namespace i_lib {
 
 ******************************************************************************/
 ///
-/// \brief  L[{[hpRg[[
+/// \brief  キーボード用コントローラー
 ///
-///         o^֐́A͂̏ԂŎ󂯎Kv܂B
-///         ֐map(c)ɂo^ۂɎw肵L[̏ԂÅ֐̈ɓn悤ɂȂ܂B
+///         登録する関数は、入力の状態を引数で受け取れる必要があります。
+///         関数をmap(…)により登録する際に指定したキーの状態が、その関数の引数に渡されるようになります。
 ///
-/// \tparam TargetTy : Ώۂ̃IuWFNg^
+/// \tparam TargetTy : 操作対象のオブジェクト型
 ///
-/// \attention consto֐ ͓o^ł܂B
+/// \attention constメンバ関数 は登録できません。
 ///
 template <class TargetTy>
 class KeyboardController : public Controller<TargetTy>, private keyboard_ctrler_impl::KeyboardCtrlerImpl {
@@ -144,10 +144,10 @@ public :
     using KeyboardCtrlerImpl::getKeyboard;
 
     ///
-    /// \brief  RXgN^
+    /// \brief  コンストラクタ
     ///
-    /// \param[in] Device : ͂L[{[h
-    /// \param[in] Target : Ώ
+    /// \param[in] Device : 入力を見るキーボード
+    /// \param[in] Target : 操作対象
     ///
     KeyboardController(const Keyboard* Device=nullptr, TargetTy* Target=nullptr) :
         Controller<TargetTy>{Target},
@@ -156,19 +156,19 @@ public :
     }
 
     ///
-    /// \brief  L[Ɗ֐̃}bsO
+    /// \brief  キーと関数のマッピング
     ///
-    ///         xɕ̃yA}bsO邱Ƃł܂B
-    ///         ̏ꍇ́AuL[, ֐|C^ṽyA𑱂ē͂ĂB
-    ///         )  cmap(ckUp   , &Hoge::jump,
-    ///                    ckSpace, &Hoge::shot, c );
+    ///         一度に複数のペアをマッピングすることができます。
+    ///         その場合は、「キー, 関数ポインタ」のペアを続けて入力してください。
+    ///         例)  …map(…kUp   , &Hoge::jump,
+    ///                    …kSpace, &Hoge::shot, … );
     ///
-    /// \tparam KeyTy     : L[̌^
-    /// \tparam FTy       : }bv֐|C^̌^
-    /// \tparam RestTypes : c̃}bvyAXg
-    /// \param[in] Key      : ֐}bvL[
-    /// \param[in] Function : }bv֐
-    /// \param[in] Rests    : ̃yA
+    /// \tparam KeyTy     : キーの型
+    /// \tparam FTy       : マップする関数ポインタの型
+    /// \tparam RestTypes : 残りのマップペアリスト
+    /// \param[in] Key      : 関数をマップするキー
+    /// \param[in] Function : マップする関数
+    /// \param[in] Rests    : 他のペア
     ///
     template <class KeyTy, class FTy, class ...RestTypes>
     void map(const KeyTy Key, const FTy Function, RestTypes ...Rests) noexcept {
@@ -177,16 +177,16 @@ public :
     }
 
     ///
-    /// \brief  L[Ɗ֐̃}bv
+    /// \brief  キーと関数のマップを解除
     ///
-    ///         xɕ̃}bv邱Ƃł܂B
-    ///         ̏ꍇ́AL[𑱂ē͂ĂB
-    ///         ) cunmap(ckDpadUp, ckA);   // łȂ悤}bv
+    ///         一度に複数のマップを解除することができます。
+    ///         その場合は、解除したいキーを続けて入力してください。
+    ///         例) …unmap(…kDpadUp, …kA);   // 操作できないようマップを解除
     ///
-    /// \tparam KeyTy        : L[̌^(Buttons, Triggers, Stickŝꂩ)
-    /// \tparam RestKeyTypes : c̃L[̌^
-    /// \param[in] Key   : ֐Ƃ̃}bvL[
-    /// \param[in] Rests : ǉŉL[
+    /// \tparam KeyTy        : キーの型(Buttons, Triggers, Sticksのいずれか)
+    /// \tparam RestKeyTypes : 残りのキーの型
+    /// \param[in] Key   : 関数とのマップを解除するキー
+    /// \param[in] Rests : 追加で解除するキー
     ///
     template <class KeyTy, class ...RestKeyTypes>
     void unmap(const KeyTy Key, const RestKeyTypes ...Rests) noexcept {
@@ -206,7 +206,7 @@ public :
 private :
     void map() const noexcept {}
     template <class InvalidKTy, class InvalidFTy, class=std::enable_if_t<!std::is_same_v<InvalidKTy, Keys> ||
-      !std::is_convertible_v<InvalidFTy, void(TargetTy::*)(InputFlagType)>>> // OẅႢ͋
+      !std::is_convertible_v<InvalidFTy, void(TargetTy::*)(InputFlagType)>>> // 例外指定の違いは許可
     void mapImpl(const InvalidKTy, const InvalidFTy) const noexcept {
         static_assert(false, "such key or such function is not supported");
     }
@@ -1,4 +1,4 @@
-// 쐬 : 
+// 作成者 : 板場
 /******************************************************************************
 
     include
@@ -6,6 +6,7 @@
 ******************************************************************************/
 #include "layer.hpp"
 #include "easy_engine.hpp"
+#include "graphic_manager.hpp"
 #include "utility_function.hpp"
 
 
@@ -139,7 +140,7 @@ layer_ns::Layer::Layer(const unsigned Width, const unsigned Height, const Layer:
 } {
     if(!TextureResource::isValid()) return;
 
-    // er[쐬
+    // 各種ビューを作成
     Microsoft::WRL::ComPtr<ID3D11RenderTargetView> rtv;
     if(FAILED(EasyEngine::graphics().d3d11Device().CreateRenderTargetView(resource(), nullptr, &rtv)))
         return;
@@ -1,13 +1,13 @@
 ///
 /// \file   layer.hpp
-/// \brief  C[`wb_
+/// \brief  レイヤー定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/8/27
-///             - wb_ǉ
-///             - Layer `
+///             - ヘッダ追加
+///             - Layer 定義
 ///
 #ifndef INCLUDED_EGEG_GLIB_LAYER_HEADER_
 #define INCLUDED_EGEG_GLIB_LAYER_HEADER_
@@ -23,15 +23,15 @@ namespace g_lib {
 
 ******************************************************************************/
 ///
-/// \brief  C[(VF[_[\[X & _[^[Qbg)
+/// \brief  レイヤー(シェーダーリソース & レンダーターゲット)
 ///
 class Layer : public TextureResource {
 public :
     ///
     /// \enum   Format
-    /// \brief  eNX`tH[}bg
+    /// \brief  テクスチャフォーマット
     ///
-    ///         ڍׂMicrosoft DXGI_FORMAT enumerationQƂĂB
+    ///         詳細はMicrosoft DXGI_FORMAT enumerationを参照してください。
     ///         https://docs.microsoft.com/en-us/windows/win32/api/dxgiformat/ne-dxgiformat-dxgi_format
     ///
     enum class Format : UINT {
@@ -137,31 +137,31 @@ public :
     Layer() = default;
 
     ///
-    /// \brief  eNX`̍쐬𔺂RXgN^
+    /// \brief  テクスチャの作成を伴うコンストラクタ
     ///
-    /// \param[in] Width         : C[
-    /// \param[in] Height        : C[c
-    /// \param[in] Format        : eNX`tH[}bg
-    /// \param[in] SampleCount   : 1sNZ̃Tv
-    /// \param[in] SampleQuality : }`Tv̉掿x
+    /// \param[in] Width         : レイヤー横幅
+    /// \param[in] Height        : レイヤー縦幅
+    /// \param[in] Format        : テクスチャフォーマット
+    /// \param[in] SampleCount   : 1ピクセル当たりのサンプル数
+    /// \param[in] SampleQuality : マルチサンプルの画質レベル
     ///
     Layer(unsigned Width, unsigned Height, Format TextureFormat=Format::kRGBA8Uint, UINT SampleCount=1U, UINT SampleQuality=0U);
 
     ///
-    /// \brief  LȃC[ǂ
+    /// \brief  有効なレイヤーかどうか判定
     ///
-    ///         true  : L
-    ///         false : 
+    ///         true  : 有効
+    ///         false : 無効
     ///
-    /// \return 茋
+    /// \return 判定結果
     ///
     bool isValid() const noexcept { return TextureResource::isValid() && texture_ && layer_; }
     operator bool() const noexcept { return isValid(); }
 
 
-    /// eNX`擾
+    /// テクスチャを取得
     ID3D11ShaderResourceView* texture() const noexcept { return texture_.Get(); }
-    /// C[擾
+    /// レイヤーを取得
     ID3D11RenderTargetView* layer() const noexcept { return layer_.Get(); }
 protected :
     Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> texture_;
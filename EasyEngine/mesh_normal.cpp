@@ -0,0 +1,274 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include "mesh_normal.hpp"
+#include <cmath>
+#include <cstring>
+#include <array>
+#include <algorithm>
+#include <unordered_map>
+#include <DirectXMath.h>
+#include "parallel_algorithm.hpp"
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace mn_ns = easy_engine::g_lib;
+namespace {
+    using easy_engine::m_lib::Vector2D;
+    using easy_engine::m_lib::Vector3D;
+    using easy_engine::m_lib::Vector4D;
+
+    constexpr easy_engine::t_lib::ParallelOptions kChunkOptions{4096U}; // 並列処理の分割の最小単位(三角形、グループ数)
+    constexpr float kDegenerateEpsilon = 1.0e-20F;
+
+    // 溶接用キー(float値のビット列)
+    template <size_t N>
+    using WeldKey = std::array<std::uint32_t, N>;
+    template <size_t N>
+    struct WeldKeyHash {
+        size_t operator()(const WeldKey<N>& Key) const noexcept {
+            // FNV-1a
+            std::uint64_t hash = 14695981039346656037ULL;
+            for(auto v : Key) { hash ^= v; hash *= 1099511628211ULL; }
+            return static_cast<size_t>(hash);
+        }
+    };
+
+    // 溶接結果
+    //  group[頂点番号] = グループ番号
+    //  グループに属するコーナー(三角形の頂点)のリストを CSR 形式で保持する
+    struct WeldGroups {
+        std::vector<std::uint32_t> group;
+        std::uint32_t num_groups;
+        std::vector<std::uint32_t> offsets;  // offsets[g] ~ offsets[g+1] が corners の範囲
+        std::vector<std::uint32_t> corners;  // コーナー番号(三角形番号*3 + 頂点位置)
+    };
+
+    std::uint32_t floatBits(float) noexcept;
+    template <size_t N, class KeyFTy>
+    std::vector<std::uint32_t> weld(size_t, std::uint32_t&, KeyFTy&&);
+    void buildCorners(WeldGroups&, const std::vector<std::uint32_t>&);
+    DirectX::XMVECTOR load(const Vector3D& V) noexcept {
+        return DirectX::XMLoadFloat3(reinterpret_cast<const DirectX::XMFLOAT3*>(&V));
+    }
+    void store(Vector3D& Dest, DirectX::FXMVECTOR V) noexcept {
+        DirectX::XMStoreFloat3(reinterpret_cast<DirectX::XMFLOAT3*>(&Dest), V);
+    }
+} // unnamed namespace
+
+
+/******************************************************************************
+
+    g_lib::
+
+******************************************************************************/
+std::vector<std::uint32_t> mn_ns::weldVertices(const std::vector<m_lib::Vector3D>& Positions) {
+    std::uint32_t num_groups = 0U;
+    return weld<3>(Positions.size(), num_groups, [&](const size_t I) {
+        return WeldKey<3>{floatBits(Positions[I].x), floatBits(Positions[I].y), floatBits(Positions[I].z)};
+    });
+}
+
+void mn_ns::generateNormals(t_lib::JobSystem& Jobs,
+                            const std::vector<m_lib::Vector3D>& Positions,
+                            const std::vector<std::uint32_t>& Indices,
+                            std::vector<m_lib::Vector3D>& Normals) {
+    using namespace DirectX;
+    const size_t num_triangles = Indices.size()/3U;
+
+  // 座標で溶接
+    WeldGroups groups;
+    groups.group = weld<3>(Positions.size(), groups.num_groups, [&](const size_t I) {
+        return WeldKey<3>{floatBits(Positions[I].x), floatBits(Positions[I].y), floatBits(Positions[I].z)};
+    });
+    buildCorners(groups, Indices);
+
+  // コーナー毎の寄与(面法線*内角)を計算 : 書き込み先が重ならないので排他不要
+    std::vector<Vector3D> contributions(num_triangles*3U);
+    t_lib::parallelFor(Jobs, 0U, num_triangles, [&](const size_t Begin, const size_t End) {
+        for(size_t t=Begin; t<End; ++t) {
+            const XMVECTOR p0 = load(Positions[Indices[t*3U]]);
+            const XMVECTOR p1 = load(Positions[Indices[t*3U+1U]]);
+            const XMVECTOR p2 = load(Positions[Indices[t*3U+2U]]);
+            const XMVECTOR e01 = XMVectorSubtract(p1, p0);
+            const XMVECTOR e02 = XMVectorSubtract(p2, p0);
+            const XMVECTOR e12 = XMVectorSubtract(p2, p1);
+            const XMVECTOR face = XMVector3Cross(e01, e02);
+            if(XMVectorGetX(XMVector3LengthSq(face)) < kDegenerateEpsilon) { // 縮退面は寄与しない
+                store(contributions[t*3U], XMVectorZero());
+                store(contributions[t*3U+1U], XMVectorZero());
+                store(contributions[t*3U+2U], XMVectorZero());
+                continue;
+            }
+            const XMVECTOR n = XMVector3Normalize(face);
+            const float a0 = XMVectorGetX(XMVector3AngleBetweenVectors(e01, e02));
+            const float a1 = XMVectorGetX(XMVector3AngleBetweenVectors(XMVectorNegate(e01), e12));
+            const float a2 = XM_PI - a0 - a1;
+            store(contributions[t*3U],     XMVectorScale(n, a0));
+            store(contributions[t*3U+1U], XMVectorScale(n, a1));
+            store(contributions[t*3U+2U], XMVectorScale(n, a2));
+        }
+    }, kChunkOptions);
+
+  // グループ毎に集計 : グループ単位で分割するので排他不要
+    std::vector<Vector3D> group_normals(groups.num_groups);
+    t_lib::parallelFor(Jobs, 0U, groups.num_groups, [&](const size_t Begin, const size_t End) {
+        for(size_t g=Begin; g<End; ++g) {
+            XMVECTOR sum = XMVectorZero();
+            for(std::uint32_t c=groups.offsets[g]; c<groups.offsets[g+1U]; ++c)
+                sum = XMVectorAdd(sum, load(contributions[groups.corners[c]]));
+            store(group_normals[g], XMVector3Normalize(sum)); // 長さ0の場合は0ベクトル
+        }
+    }, kChunkOptions);
+
+    Normals.resize(Positions.size());
+    for(size_t v=0; v<Positions.size(); ++v)
+        Normals[v] = group_normals[groups.group[v]];
+}
+
+void mn_ns::generateTangents(t_lib::JobSystem& Jobs,
+                             const std::vector<m_lib::Vector3D>& Positions,
+                             const std::vector<m_lib::Vector3D>& Normals,
+                             const std::vector<m_lib::Vector2D>& UVs,
+                             const std::vector<std::uint32_t>& Indices,
+                             std::vector<m_lib::Vector4D>& Tangents) {
+    using namespace DirectX;
+    const size_t num_triangles = Indices.size()/3U;
+
+  // 座標、法線、UVで溶接
+    WeldGroups groups;
+    groups.group = weld<8>(Positions.size(), groups.num_groups, [&](const size_t I) {
+        return WeldKey<8>{
+            floatBits(Positions[I].x), floatBits(Positions[I].y), floatBits(Positions[I].z),
+            floatBits(Normals[I].x), floatBits(Normals[I].y), floatBits(Normals[I].z),
+            floatBits(UVs[I].x), floatBits(UVs[I].y)};
+    });
+    buildCorners(groups, Indices);
+
+  // コーナー毎の寄与(頂点法線に直交化した接線、従法線*内角)を計算
+    std::vector<Vector3D> tangent_contributions(num_triangles*3U);
+    std::vector<Vector3D> bitangent_contributions(num_triangles*3U);
+    t_lib::parallelFor(Jobs, 0U, num_triangles, [&](const size_t Begin, const size_t End) {
+        for(size_t t=Begin; t<End; ++t) {
+            const std::uint32_t idx[3] {Indices[t*3U], Indices[t*3U+1U], Indices[t*3U+2U]};
+            const XMVECTOR p[3] {load(Positions[idx[0]]), load(Positions[idx[1]]), load(Positions[idx[2]])};
+            const float du1 = UVs[idx[1]].x - UVs[idx[0]].x;
+            const float dv1 = UVs[idx[1]].y - UVs[idx[0]].y;
+            const float du2 = UVs[idx[2]].x - UVs[idx[0]].x;
+            const float dv2 = UVs[idx[2]].y - UVs[idx[0]].y;
+            const float det = du1*dv2 - du2*dv1;
+            const XMVECTOR e01 = XMVectorSubtract(p[1], p[0]);
+            const XMVECTOR e02 = XMVectorSubtract(p[2], p[0]);
+            if(std::fabs(det) < kDegenerateEpsilon ||
+               XMVectorGetX(XMVector3LengthSq(XMVector3Cross(e01, e02))) < kDegenerateEpsilon) {
+                for(size_t c=0; c<3U; ++c) {
+                    store(tangent_contributions[t*3U+c], XMVectorZero());
+                    store(bitangent_contributions[t*3U+c], XMVectorZero());
+                }
+                continue;
+            }
+            const float r = 1.0F/det;
+            const XMVECTOR face_t = XMVectorScale(XMVectorSubtract(XMVectorScale(e01, dv2), XMVectorScale(e02, dv1)), r);
+            const XMVECTOR face_b = XMVectorScale(XMVectorSubtract(XMVectorScale(e02, du1), XMVectorScale(e01, du2)), r);
+
+            for(size_t c=0; c<3U; ++c) {
+                const XMVECTOR prev = XMVectorSubtract(p[(c+2U)%3U], p[c]);
+                const XMVECTOR next = XMVectorSubtract(p[(c+1U)%3U], p[c]);
+                const float angle = XMVectorGetX(XMVector3AngleBetweenVectors(next, prev));
+                const XMVECTOR n = load(Normals[idx[c]]);
+                const XMVECTOR ortho_t = XMVector3Normalize(
+                    XMVectorSubtract(face_t, XMVectorMultiply(n, XMVector3Dot(n, face_t))));
+                const XMVECTOR ortho_b = XMVector3Normalize(
+                    XMVectorSubtract(face_b, XMVectorMultiply(n, XMVector3Dot(n, face_b))));
+                store(tangent_contributions[t*3U+c], XMVectorScale(ortho_t, angle));
+                store(bitangent_contributions[t*3U+c], XMVectorScale(ortho_b, angle));
+            }
+        }
+    }, kChunkOptions);
+
+  // グループ毎に集計
+    std::vector<Vector4D> group_tangents(groups.num_groups);
+    std::vector<std::uint32_t> group_vertex(groups.num_groups);
+    for(size_t v=Positions.size(); v-->0U; ) group_vertex[groups.group[v]] = static_cast<std::uint32_t>(v);
+    t_lib::parallelFor(Jobs, 0U, groups.num_groups, [&](const size_t Begin, const size_t End) {
+        for(size_t g=Begin; g<End; ++g) {
+            XMVECTOR sum_t = XMVectorZero();
+            XMVECTOR sum_b = XMVectorZero();
+            for(std::uint32_t c=groups.offsets[g]; c<groups.offsets[g+1U]; ++c) {
+                sum_t = XMVectorAdd(sum_t, load(tangent_contributions[groups.corners[c]]));
+                sum_b = XMVectorAdd(sum_b, load(bitangent_contributions[groups.corners[c]]));
+            }
+            const XMVECTOR n = load(Normals[group_vertex[g]]);
+            XMVECTOR tangent = XMVectorSubtract(sum_t, XMVectorMultiply(n, XMVector3Dot(n, sum_t)));
+            if(XMVectorGetX(XMVector3LengthSq(tangent)) < kDegenerateEpsilon) {
+                // 有効な接線が得られない場合は、法線に直交する任意の方向
+                const XMVECTOR axis = std::fabs(XMVectorGetX(n)) < 0.9F ?
+                    XMVectorSet(1.0F, 0.0F, 0.0F, 0.0F) : XMVectorSet(0.0F, 1.0F, 0.0F, 0.0F);
+                tangent = XMVector3Cross(n, XMVector3Cross(axis, n));
+            }
+            tangent = XMVector3Normalize(tangent);
+            const float handedness = XMVectorGetX(XMVector3Dot(XMVector3Cross(n, tangent), sum_b)) < 0.0F ? -1.0F : 1.0F;
+
+            XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(&group_tangents[g]), XMVectorSetW(tangent, handedness));
+        }
+    }, kChunkOptions);
+
+    Tangents.resize(Positions.size());
+    for(size_t v=0; v<Positions.size(); ++v)
+        Tangents[v] = group_tangents[groups.group[v]];
+}
+
+
+/******************************************************************************
+
+    others
+
+******************************************************************************/
+namespace {
+// float値のビット列 (+0と-0は同一視する)
+std::uint32_t floatBits(const float Value) noexcept {
+    std::uint32_t bits;
+    const float value = Value==0.0F ? 0.0F : Value;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+// キーが一致する頂点に同じグループ番号を割り当てる
+template <size_t N, class KeyFTy>
+std::vector<std::uint32_t> weld(const size_t NumVertices, std::uint32_t& NumGroups, KeyFTy&& Key) {
+    std::vector<std::uint32_t> group(NumVertices);
+    std::unordered_map<WeldKey<N>, std::uint32_t, WeldKeyHash<N>> table;
+    table.reserve(NumVertices);
+
+    NumGroups = 0U;
+    for(size_t v=0; v<NumVertices; ++v) {
+        const auto result = table.emplace(Key(v), NumGroups);
+        if(result.second) ++NumGroups;
+        group[v] = result.first->second;
+    }
+    return group;
+}
+
+// グループ毎のコーナーリストを作成(計数ソート)
+void buildCorners(WeldGroups& Groups, const std::vector<std::uint32_t>& Indices) {
+    const size_t num_corners = Indices.size()/3U*3U;
+    Groups.offsets.assign(Groups.num_groups+1U, 0U);
+    for(size_t c=0; c<num_corners; ++c)
+        ++Groups.offsets[Groups.group[Indices[c]]+1U];
+    for(size_t g=0; g<Groups.num_groups; ++g)
+        Groups.offsets[g+1U] += Groups.offsets[g];
+
+    Groups.corners.resize(num_corners);
+    std::vector<std::uint32_t> cursor{Groups.offsets.begin(), Groups.offsets.end()-1};
+    for(size_t c=0; c<num_corners; ++c)
+        Groups.corners[cursor[Groups.group[Indices[c]]]++] = static_cast<std::uint32_t>(c);
+}
+} // unnamed namespace
+// EOF
@@ -0,0 +1,87 @@
+///
+/// \file   mesh_normal.hpp
+/// \brief  メッシュ法線、接線生成関数定義ヘッダ
+///
+///         頂点座標、UV、頂点インデックスから
+///         頂点バッファ用の法線と接線を生成します。
+///
+/// \author 板場
+///
+/// \par    履歴
+///         - 2026/10/19
+///             - ヘッダ追加
+///             - weldVertices(…) 定義
+///             - generateNormals(…) 定義
+///             - generateTangents(…) 定義
+///             - generateNormals(…), generateTangents(…) をジョブシステムで並列に処理するよう変更
+///
+/// \note   接線について\n
+///         MikkTSpace と同じ方針(角度重み付き、頂点法線に直交化、従法線の符号をwに格納)で生成するが、
+///         分割、縮退面の扱い等の細部は MikkTSpace と完全には一致しない。
+///
+#ifndef INCLUDED_EGEG_GLIB_MESH_NORMAL_HEADER_
+#define INCLUDED_EGEG_GLIB_MESH_NORMAL_HEADER_
+
+#include <cstdint>
+#include <vector>
+#include "mvector.hpp"
+
+namespace easy_engine {
+namespace t_lib { class JobSystem; }
+namespace g_lib {
+
+///
+/// \brief  座標が一致する頂点を溶接
+///
+///         座標が完全に一致する頂点同士に、同じ代表頂点番号を割り当てます。
+///         UVや法線の不連続により分割された頂点を、法線の平滑化で一つの頂点として扱うために使用します。
+///
+/// \param[in] Positions : 頂点座標リスト
+///
+/// \return 各頂点の代表頂点番号リスト(要素数は Positions と同じ)
+///
+std::vector<std::uint32_t> weldVertices(const std::vector<m_lib::Vector3D>& Positions);
+
+///
+/// \brief  スムーズ法線を生成
+///
+///         面法線を各頂点の内角で重み付けして平均します。
+///         座標が一致する頂点は溶接して平滑化されます。
+///         三角形範囲毎にジョブシステムのスレッドで並列に処理します。
+///         呼び出し例.) generateNormals(EasyEngine::jobs(), positions, indices, normals);
+///
+/// \param[in]  Jobs      : 使用するジョブシステム
+/// \param[in]  Positions : 頂点座標リスト
+/// \param[in]  Indices   : 頂点インデックスリスト(三角形リスト)
+/// \param[out] Normals   : 生成した法線リスト(要素数は Positions と同じ)
+///
+void generateNormals(t_lib::JobSystem& Jobs,
+                     const std::vector<m_lib::Vector3D>& Positions,
+                     const std::vector<std::uint32_t>& Indices,
+                     std::vector<m_lib::Vector3D>& Normals);
+
+///
+/// \brief  接線を生成
+///
+///         接線(xyz)と、従法線の向きを表す符号(w : ±1)を生成します。
+///         従法線は cross(法線, 接線)*w で求めることができます。
+///         座標、法線、UVが全て一致する頂点は溶接して平滑化されます。
+///
+/// \param[in]  Jobs      : 使用するジョブシステム
+/// \param[in]  Positions : 頂点座標リスト
+/// \param[in]  Normals   : 頂点法線リスト
+/// \param[in]  UVs       : テクスチャ座標リスト
+/// \param[in]  Indices   : 頂点インデックスリスト(三角形リスト)
+/// \param[out] Tangents  : 生成した接線リスト(要素数は Positions と同じ)
+///
+void generateTangents(t_lib::JobSystem& Jobs,
+                      const std::vector<m_lib::Vector3D>& Positions,
+                      const std::vector<m_lib::Vector3D>& Normals,
+                      const std::vector<m_lib::Vector2D>& UVs,
+                      const std::vector<std::uint32_t>& Indices,
+                      std::vector<m_lib::Vector4D>& Tangents);
+
+} // namespace g_lib
+} // namespace easy_engine
+#endif // !INCLUDED_EGEG_GLIB_MESH_NORMAL_HEADER_
+// EOF
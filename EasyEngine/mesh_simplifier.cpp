@@ -0,0 +1,551 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include "mesh_simplifier.hpp"
+#include <cmath>
+#include <array>
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
+#include "mesh_normal.hpp"
+#include "parallel_algorithm.hpp"
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace ms_ns = easy_engine::g_lib;
+namespace {
+    using easy_engine::m_lib::Vector2D;
+    using easy_engine::m_lib::Vector3D;
+
+    constexpr size_t kDimension = 8U;   // 座標3 + 法線3 + UV2
+    constexpr size_t kSymmetricSize = kDimension*(kDimension+1U)/2U;
+    constexpr double kBorderWeight = 10.0;
+    constexpr std::uint32_t kInvalid = 0xFFFFFFFFU;
+
+    using Point = std::array<double, kDimension>;
+
+    // 一般化二次誤差
+    //  Q(x) = x^T A x + 2 b^T x + c
+    //  A は対称行列のため上三角のみ保持する
+    struct Quadric {
+        double a[kSymmetricSize];
+        double b[kDimension];
+        double c;
+        double weight;  // 面積の総和(誤差の正規化に使用)
+    };
+
+    // 縮約候補
+    struct Collapse {
+        double cost;
+        std::uint32_t from;
+        std::uint32_t to;
+        std::uint32_t version;
+        bool operator>(const Collapse& Rhs) const noexcept { return cost > Rhs.cost; }
+    };
+
+    // 縮約で消える頂点と、その縮約先の組
+    using CollapsePairs = std::vector<std::pair<std::uint32_t, std::uint32_t>>;
+
+    // 簡略化処理
+    class Simplifier {
+    public :
+        Simplifier(const std::vector<Vector3D>&, const std::vector<Vector3D>&, const std::vector<Vector2D>&,
+                   const std::vector<std::uint32_t>&, const ms_ns::SimplifyOptions&);
+        ms_ns::SimplifyResult run();
+
+    private :
+        void buildTopology(const std::vector<std::uint32_t>&);
+        void buildQuadrics(const std::vector<Vector3D>&, const std::vector<Vector2D>&);
+        void findCollapse(std::uint32_t);
+        bool pairCollapse(std::uint32_t, std::uint32_t, CollapsePairs&) const;
+        bool isValid(const CollapsePairs&) const;
+        double cost(const CollapsePairs&) const;
+        void collapse(const CollapsePairs&);
+        void neighbors(std::uint32_t, std::vector<std::uint32_t>&) const;
+        bool isBorderEdge(std::uint32_t GroupA, std::uint32_t GroupB) const {
+            return border_edges_.count(edgeKey(GroupA, GroupB)) != 0U;
+        }
+        static std::uint64_t edgeKey(std::uint32_t A, std::uint32_t B) noexcept {
+            if(A > B) std::swap(A, B);
+            return (static_cast<std::uint64_t>(A) << 32) | B;
+        }
+
+        const std::vector<Vector3D>& positions_;
+        ms_ns::SimplifyOptions options_;
+        std::vector<std::uint32_t> triangles_;
+        std::vector<bool> triangle_alive_;
+        size_t num_alive_triangles_;
+        std::vector<std::vector<std::uint32_t>> vertex_triangles_;
+        std::vector<std::uint32_t> group_;                  // 座標が一致する頂点のグループ
+        std::vector<std::vector<std::uint32_t>> members_;   // グループに属する生存頂点
+        std::vector<bool> border_group_;
+        std::unordered_set<std::uint64_t> border_edges_;    // グループ間の境界辺
+        std::vector<Point> points_;
+        std::vector<Quadric> quadrics_;
+        std::vector<bool> vertex_alive_;
+        std::vector<std::uint32_t> version_;
+        std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>> queue_;
+
+        // 作業領域(呼び出し毎の確保を避ける)
+        mutable std::vector<std::uint32_t> candidates_;
+        mutable std::vector<std::uint32_t> around_;
+        mutable std::vector<std::uint32_t> around_to_;
+        mutable std::vector<std::uint32_t> opposite_;
+        CollapsePairs candidate_pairs_;
+    };
+
+    size_t symmetricIndex(size_t, size_t) noexcept;
+    void addTriangleQuadric(Quadric&, const Point&, const Point&, const Point&, double);
+    void addPlaneQuadric(Quadric&, const Vector3D&, double, double);
+    void addQuadric(Quadric&, const Quadric&) noexcept;
+    double evaluate(const Quadric&, const Point&) noexcept;
+    Vector3D faceNormal(const Vector3D&, const Vector3D&, const Vector3D&) noexcept;
+    void removeValue(std::vector<std::uint32_t>&, std::uint32_t);
+} // unnamed namespace
+
+
+/******************************************************************************
+
+    g_lib::
+
+******************************************************************************/
+ms_ns::SimplifyResult ms_ns::simplifyMesh(const std::vector<m_lib::Vector3D>& Positions,
+                                          const std::vector<m_lib::Vector3D>& Normals,
+                                          const std::vector<m_lib::Vector2D>& UVs,
+                                          const std::vector<std::uint32_t>& Indices,
+                                          const SimplifyOptions& Options) {
+    return Simplifier{Positions, Normals, UVs, Indices, Options}.run();
+}
+
+std::vector<ms_ns::SimplifyResult> ms_ns::generateLods(t_lib::JobSystem& Jobs,
+                                                       const std::vector<m_lib::Vector3D>& Positions,
+                                                       const std::vector<m_lib::Vector3D>& Normals,
+                                                       const std::vector<m_lib::Vector2D>& UVs,
+                                                       const std::vector<std::uint32_t>& Indices,
+                                                       const std::vector<SimplifyOptions>& Levels) {
+    std::vector<SimplifyResult> results(Levels.size());
+
+    // レベル毎に処理時間が異なるため、1レベルずつ分割し、空いたスレッドから次のレベルを取る
+    t_lib::parallelFor(Jobs, 0U, Levels.size(), [&](const size_t Level) {
+        results[Level] = simplifyMesh(Positions, Normals, UVs, Indices, Levels[Level]);
+    }, t_lib::ParallelOptions{1U});
+
+    return results;
+}
+
+
+/******************************************************************************
+
+    others
+
+******************************************************************************/
+namespace {
+Simplifier::Simplifier(const std::vector<Vector3D>& Positions, const std::vector<Vector3D>& Normals,
+                       const std::vector<Vector2D>& UVs, const std::vector<std::uint32_t>& Indices,
+                       const ms_ns::SimplifyOptions& Options) :
+    positions_{Positions}, options_{Options} {
+    buildTopology(Indices);
+    buildQuadrics(Normals, UVs);
+}
+
+ms_ns::SimplifyResult Simplifier::run() {
+    for(std::uint32_t v=0; v<positions_.size(); ++v)
+        findCollapse(v);
+
+    const double error_limit = static_cast<double>(options_.target_error) * options_.target_error;
+    double max_error = 0.0;
+    CollapsePairs pairs;
+    std::vector<std::uint32_t> affected;
+    std::vector<std::uint32_t> around;
+    while(num_alive_triangles_ > options_.target_triangles && !queue_.empty()) {
+        const Collapse top = queue_.top();
+        queue_.pop();
+        if(!vertex_alive_[top.from] || top.version != version_[top.from]) continue;
+        if(top.cost > error_limit) break;
+
+        // 登録後に周囲が変化している場合があるため、再検証する
+        if(!vertex_alive_[top.to] || !pairCollapse(top.from, top.to, pairs) || !isValid(pairs)) {
+            findCollapse(top.from);
+            continue;
+        }
+        const double c = cost(pairs);
+        if(c > top.cost) {
+            queue_.push(Collapse{c, top.from, top.to, ++version_[top.from]});
+            continue;
+        }
+
+        collapse(pairs);
+        max_error = std::max(max_error, c);
+
+        // 縮約先の周囲の候補を更新
+        affected.clear();
+        for(const auto& pair : pairs) {
+            affected.push_back(pair.second);
+            neighbors(pair.second, around);
+            affected.insert(affected.end(), around.begin(), around.end());
+        }
+        const size_t num_direct = affected.size();
+        for(size_t i=0; i<num_direct; ++i) {
+            const auto& wedges = members_[group_[affected[i]]];
+            affected.insert(affected.end(), wedges.begin(), wedges.end());
+        }
+        std::sort(affected.begin(), affected.end());
+        affected.erase(std::unique(affected.begin(), affected.end()), affected.end());
+        for(auto v : affected)
+            findCollapse(v);
+    }
+
+    ms_ns::SimplifyResult result;
+    result.indices.reserve(num_alive_triangles_*3U);
+    for(size_t t=0; t<triangle_alive_.size(); ++t) {
+        if(!triangle_alive_[t]) continue;
+        result.indices.insert(result.indices.end(), triangles_.begin()+t*3U, triangles_.begin()+t*3U+3U);
+    }
+    result.error = static_cast<float>(std::sqrt(max_error));
+    return result;
+}
+
+// 三角形、グループ、境界の構築
+void Simplifier::buildTopology(const std::vector<std::uint32_t>& Indices) {
+    const size_t num_vertices = positions_.size();
+    const size_t num_triangles = Indices.size()/3U;
+    triangles_.assign(Indices.begin(), Indices.begin()+num_triangles*3U);
+    triangle_alive_.assign(num_triangles, true);
+    num_alive_triangles_ = 0U;
+    vertex_triangles_.assign(num_vertices, {});
+    for(std::uint32_t t=0; t<num_triangles; ++t) {
+        const auto* tri = &triangles_[t*3U];
+        if(tri[0]==tri[1] || tri[1]==tri[2] || tri[2]==tri[0]) { triangle_alive_[t] = false; continue; }
+        for(size_t k=0; k<3U; ++k) vertex_triangles_[tri[k]].push_back(t);
+        ++num_alive_triangles_;
+    }
+
+    group_ = ms_ns::weldVertices(positions_);
+    members_.assign(num_vertices, {});
+    vertex_alive_.assign(num_vertices, false);
+    for(std::uint32_t v=0; v<num_vertices; ++v) {
+        if(vertex_triangles_[v].empty()) continue;
+        vertex_alive_[v] = true;
+        members_[group_[v]].push_back(v);
+    }
+    version_.assign(num_vertices, 0U);
+
+  // 1つの三角形にしか属さない辺(と非多様体辺)を境界とする
+    std::unordered_map<std::uint64_t, std::uint32_t> edge_count;
+    edge_count.reserve(num_triangles*3U);
+    for(size_t t=0; t<num_triangles; ++t) {
+        if(!triangle_alive_[t]) continue;
+        for(size_t k=0; k<3U; ++k)
+            ++edge_count[edgeKey(group_[triangles_[t*3U+k]], group_[triangles_[t*3U+(k+1U)%3U]])];
+    }
+    border_group_.assign(num_vertices, false);
+    for(const auto& edge : edge_count) {
+        if(edge.second == 2U) continue;
+        border_edges_.insert(edge.first);
+        border_group_[static_cast<std::uint32_t>(edge.first >> 32)] = true;
+        border_group_[static_cast<std::uint32_t>(edge.first & 0xFFFFFFFFU)] = true;
+    }
+}
+
+// 頂点毎の二次誤差を構築
+void Simplifier::buildQuadrics(const std::vector<Vector3D>& Normals, const std::vector<Vector2D>& UVs) {
+    const size_t num_vertices = positions_.size();
+
+  // 座標をメッシュの大きさで正規化
+    Vector3D min{0.0F, 0.0F, 0.0F};
+    Vector3D max{0.0F, 0.0F, 0.0F};
+    if(num_vertices) min = max = positions_[0];
+    for(const auto& p : positions_) {
+        min.x = std::min(min.x, p.x); min.y = std::min(min.y, p.y); min.z = std::min(min.z, p.z);
+        max.x = std::max(max.x, p.x); max.y = std::max(max.y, p.y); max.z = std::max(max.z, p.z);
+    }
+    const double extent = std::max({max.x-min.x, max.y-min.y, max.z-min.z});
+    const double scale = extent > 0.0 ? 1.0/extent : 1.0;
+
+    const bool has_normal = Normals.size() == num_vertices;
+    const bool has_uv = UVs.size() == num_vertices;
+    points_.resize(num_vertices);
+    for(size_t v=0; v<num_vertices; ++v) {
+        auto& p = points_[v];
+        p[0] = (positions_[v].x-min.x)*scale;
+        p[1] = (positions_[v].y-min.y)*scale;
+        p[2] = (positions_[v].z-min.z)*scale;
+        p[3] = has_normal ? Normals[v].x*options_.normal_weight : 0.0;
+        p[4] = has_normal ? Normals[v].y*options_.normal_weight : 0.0;
+        p[5] = has_normal ? Normals[v].z*options_.normal_weight : 0.0;
+        p[6] = has_uv ? UVs[v].x*options_.uv_weight : 0.0;
+        p[7] = has_uv ? UVs[v].y*options_.uv_weight : 0.0;
+    }
+
+    quadrics_.assign(num_vertices, Quadric{});
+    for(size_t t=0; t<triangle_alive_.size(); ++t) {
+        if(!triangle_alive_[t]) continue;
+        const auto* tri = &triangles_[t*3U];
+
+        // 面の二次誤差を面積で重み付けして各頂点に加算
+        const Vector3D n = faceNormal(positions_[tri[0]], positions_[tri[1]], positions_[tri[2]]);
+        const double area = 0.5*std::sqrt(static_cast<double>(n.x)*n.x + n.y*n.y + n.z*n.z)*scale*scale;
+        Quadric face{};
+        addTriangleQuadric(face, points_[tri[0]], points_[tri[1]], points_[tri[2]], area);
+        for(size_t k=0; k<3U; ++k) addQuadric(quadrics_[tri[k]], face);
+
+        // 境界辺には面に垂直な平面の二次誤差を加算し、境界の形状を保つ
+        if(options_.lock_border) continue;
+        for(size_t k=0; k<3U; ++k) {
+            const auto a = tri[k];
+            const auto b = tri[(k+1U)%3U];
+            if(!isBorderEdge(group_[a], group_[b])) continue;
+            const Point& pa = points_[a];
+            const Point& pb = points_[b];
+            const double ex = pb[0]-pa[0], ey = pb[1]-pa[1], ez = pb[2]-pa[2];
+            double px = ey*n.z - ez*n.y;
+            double py = ez*n.x - ex*n.z;
+            double pz = ex*n.y - ey*n.x;
+            const double len = std::sqrt(px*px + py*py + pz*pz);
+            if(len <= 0.0) continue;
+            px /= len; py /= len; pz /= len;
+            const Vector3D plane{static_cast<float>(px), static_cast<float>(py), static_cast<float>(pz)};
+            const double d = -(px*pa[0] + py*pa[1] + pz*pa[2]);
+            const double weight = kBorderWeight * (ex*ex + ey*ey + ez*ez);
+            addPlaneQuadric(quadrics_[a], plane, d, weight);
+            addPlaneQuadric(quadrics_[b], plane, d, weight);
+        }
+    }
+}
+
+// 頂点の最小誤差の縮約先を探して登録
+void Simplifier::findCollapse(const std::uint32_t From) {
+    ++version_[From];
+    if(!vertex_alive_[From]) return;
+    if(options_.lock_border && border_group_[group_[From]]) return;
+
+    neighbors(From, candidates_);
+    double best_cost = 0.0;
+    std::uint32_t best = kInvalid;
+    for(auto to : candidates_) {
+        if(!pairCollapse(From, to, candidate_pairs_)) continue;
+        const double c = cost(candidate_pairs_);
+        if(best != kInvalid && c >= best_cost) continue;
+        if(!isValid(candidate_pairs_)) continue;
+        best_cost = c;
+        best = to;
+    }
+    if(best != kInvalid)
+        queue_.push(Collapse{best_cost, From, best, version_[From]});
+}
+
+// 継ぎ目を考慮した縮約の組を作成
+//  同じ座標の頂点(継ぎ目の各側)は、それぞれ縮約先の座標の隣接頂点へ縮約する
+bool Simplifier::pairCollapse(const std::uint32_t From, const std::uint32_t To, CollapsePairs& Pairs) const {
+    Pairs.clear();
+    const auto group_from = group_[From];
+    const auto group_to = group_[To];
+    if(group_from == group_to) return false;
+    if(border_group_[group_from]) {
+        if(options_.lock_border) return false;
+        // 境界の頂点は境界に沿ってのみ縮約する
+        if(!isBorderEdge(group_from, group_to)) return false;
+    }
+
+    for(auto wedge : members_[group_from]) {
+        if(wedge == From) { Pairs.emplace_back(From, To); continue; }
+        neighbors(wedge, around_);
+        const auto it = std::find_if(around_.begin(), around_.end(), [&](std::uint32_t V) { return group_[V] == group_to; });
+        if(it == around_.end()) return false;
+        Pairs.emplace_back(wedge, *it);
+    }
+    return true;
+}
+
+// 縮約により位相、面の向きが壊れないか
+bool Simplifier::isValid(const CollapsePairs& Pairs) const {
+    for(const auto& pair : Pairs) {
+        const auto from = pair.first;
+        const auto to = pair.second;
+
+        // リンク条件 : 共通の隣接頂点は、辺を共有する三角形の対頂点のみ
+        opposite_.clear();
+        for(auto t : vertex_triangles_[from]) {
+            const auto* tri = &triangles_[t*3U];
+            if(tri[0]!=to && tri[1]!=to && tri[2]!=to) continue;
+            for(size_t k=0; k<3U; ++k)
+                if(tri[k]!=from && tri[k]!=to) opposite_.push_back(tri[k]);
+        }
+        neighbors(from, around_);
+        neighbors(to, around_to_);
+        for(auto v : around_) {
+            if(v == to) continue;
+            if(std::find(around_to_.begin(), around_to_.end(), v) != around_to_.end() &&
+               std::find(opposite_.begin(), opposite_.end(), v) == opposite_.end())
+                return false;
+        }
+
+        // 面の反転
+        for(auto t : vertex_triangles_[from]) {
+            const auto* tri = &triangles_[t*3U];
+            if(tri[0]==to || tri[1]==to || tri[2]==to) continue;
+            Vector3D p[3];
+            for(size_t k=0; k<3U; ++k) p[k] = positions_[tri[k]==from ? to : tri[k]];
+            const Vector3D before = faceNormal(positions_[tri[0]], positions_[tri[1]], positions_[tri[2]]);
+            const Vector3D after = faceNormal(p[0], p[1], p[2]);
+            if(before.x*after.x + before.y*after.y + before.z*after.z <= 0.0F) return false;
+        }
+    }
+    return true;
+}
+
+// 縮約の誤差(組の中の最大値)
+double Simplifier::cost(const CollapsePairs& Pairs) const {
+    double result = 0.0;
+    for(const auto& pair : Pairs) {
+        const auto& qa = quadrics_[pair.first];
+        const auto& qb = quadrics_[pair.second];
+        const Point& target = points_[pair.second];
+        const double weight = qa.weight + qb.weight;
+        const double error = evaluate(qa, target) + evaluate(qb, target);
+        result = std::max(result, weight > 0.0 ? std::max(error, 0.0)/weight : 0.0);
+    }
+    return result;
+}
+
+// 縮約を実行
+void Simplifier::collapse(const CollapsePairs& Pairs) {
+    // 境界辺の付け替え
+    std::vector<std::uint32_t> border_neighbors;
+    const auto group_from = group_[Pairs.front().first];
+    const auto group_to = group_[Pairs.front().second];
+    if(border_group_[group_from]) {
+        std::vector<std::uint32_t> around;
+        for(const auto& pair : Pairs) {
+            neighbors(pair.first, around);
+            for(auto v : around)
+                if(group_[v] != group_to && isBorderEdge(group_from, group_[v])) border_neighbors.push_back(group_[v]);
+        }
+    }
+
+    for(const auto& pair : Pairs) {
+        const auto from = pair.first;
+        const auto to = pair.second;
+        for(auto t : vertex_triangles_[from]) {
+            auto* tri = &triangles_[t*3U];
+            if(tri[0]==to || tri[1]==to || tri[2]==to) {
+                // 縮約する辺を含む三角形は消滅
+                triangle_alive_[t] = false;
+                --num_alive_triangles_;
+                for(size_t k=0; k<3U; ++k)
+                    if(tri[k] != from) removeValue(vertex_triangles_[tri[k]], t);
+                continue;
+            }
+            for(size_t k=0; k<3U; ++k)
+                if(tri[k] == from) tri[k] = to;
+            vertex_triangles_[to].push_back(t);
+        }
+        vertex_triangles_[from].clear();
+        vertex_alive_[from] = false;
+        addQuadric(quadrics_[to], quadrics_[from]);
+        removeValue(members_[group_from], from);
+    }
+
+    for(auto g : border_neighbors)
+        border_edges_.insert(edgeKey(group_to, g));
+}
+
+// 隣接頂点を列挙
+void Simplifier::neighbors(const std::uint32_t V, std::vector<std::uint32_t>& Out) const {
+    Out.clear();
+    for(auto t : vertex_triangles_[V]) {
+        for(size_t k=0; k<3U; ++k) {
+            const auto w = triangles_[t*3U+k];
+            if(w != V && std::find(Out.begin(), Out.end(), w) == Out.end()) Out.push_back(w);
+        }
+    }
+}
+
+size_t symmetricIndex(size_t I, size_t J) noexcept {
+    if(I > J) std::swap(I, J);
+    return I*kDimension - I*(I-1U)/2U + (J-I);
+}
+
+// 三角形を含む平面(8次元空間内の2次元平面)からの距離の二乗を表す二次誤差を加算
+void addTriangleQuadric(Quadric& Dest, const Point& P0, const Point& P1, const Point& P2, const double Weight) {
+    // P0 を原点とする平面の正規直交基底 e1, e2
+    Point e1, e2;
+    double len1 = 0.0;
+    for(size_t i=0; i<kDimension; ++i) { e1[i] = P1[i]-P0[i]; len1 += e1[i]*e1[i]; }
+    len1 = std::sqrt(len1);
+    if(len1 <= 0.0) return;
+    for(auto& v : e1) v /= len1;
+    double proj = 0.0;
+    for(size_t i=0; i<kDimension; ++i) { e2[i] = P2[i]-P0[i]; proj += e2[i]*e1[i]; }
+    double len2 = 0.0;
+    for(size_t i=0; i<kDimension; ++i) { e2[i] -= proj*e1[i]; len2 += e2[i]*e2[i]; }
+    len2 = std::sqrt(len2);
+    if(len2 <= 0.0) return;
+    for(auto& v : e2) v /= len2;
+
+    // A = I - e1 e1^T - e2 e2^T
+    // b = (p0・e1)e1 + (p0・e2)e2 - p0
+    // c = p0・p0 - (p0・e1)^2 - (p0・e2)^2
+    double d1 = 0.0, d2 = 0.0, dp = 0.0;
+    for(size_t i=0; i<kDimension; ++i) { d1 += P0[i]*e1[i]; d2 += P0[i]*e2[i]; dp += P0[i]*P0[i]; }
+    for(size_t i=0; i<kDimension; ++i) {
+        for(size_t j=i; j<kDimension; ++j)
+            Dest.a[symmetricIndex(i, j)] += Weight * ((i==j ? 1.0 : 0.0) - e1[i]*e1[j] - e2[i]*e2[j]);
+        Dest.b[i] += Weight * (d1*e1[i] + d2*e2[i] - P0[i]);
+    }
+    Dest.c += Weight * (dp - d1*d1 - d2*d2);
+    Dest.weight += Weight;
+}
+
+// 座標空間の平面 n・x + d = 0 の二次誤差を加算
+void addPlaneQuadric(Quadric& Dest, const Vector3D& Normal, const double D, const double Weight) {
+    const double n[3] = {Normal.x, Normal.y, Normal.z};
+    for(size_t i=0; i<3U; ++i) {
+        for(size_t j=i; j<3U; ++j)
+            Dest.a[symmetricIndex(i, j)] += Weight * n[i]*n[j];
+        Dest.b[i] += Weight * D*n[i];
+    }
+    Dest.c += Weight * D*D;
+}
+
+void addQuadric(Quadric& Dest, const Quadric& Src) noexcept {
+    for(size_t i=0; i<kSymmetricSize; ++i) Dest.a[i] += Src.a[i];
+    for(size_t i=0; i<kDimension; ++i) Dest.b[i] += Src.b[i];
+    Dest.c += Src.c;
+    Dest.weight += Src.weight;
+}
+
+double evaluate(const Quadric& Q, const Point& X) noexcept {
+    double result = Q.c;
+    for(size_t i=0; i<kDimension; ++i) {
+        const double* row = Q.a + symmetricIndex(i, i);
+        result += row[0]*X[i]*X[i] + 2.0*Q.b[i]*X[i];
+        for(size_t j=i+1U; j<kDimension; ++j)
+            result += 2.0*row[j-i]*X[i]*X[j];
+    }
+    return result;
+}
+
+Vector3D faceNormal(const Vector3D& P0, const Vector3D& P1, const Vector3D& P2) noexcept {
+    const float e1x = P1.x-P0.x, e1y = P1.y-P0.y, e1z = P1.z-P0.z;
+    const float e2x = P2.x-P0.x, e2y = P2.y-P0.y, e2z = P2.z-P0.z;
+    return Vector3D{e1y*e2z - e1z*e2y, e1z*e2x - e1x*e2z, e1x*e2y - e1y*e2x};
+}
+
+void removeValue(std::vector<std::uint32_t>& Vec, const std::uint32_t Value) {
+    const auto it = std::find(Vec.begin(), Vec.end(), Value);
+    if(it == Vec.end()) return;
+    *it = Vec.back();
+    Vec.pop_back();
+}
+} // unnamed namespace
+// EOF
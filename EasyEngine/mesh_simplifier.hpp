@@ -0,0 +1,121 @@
+///
+/// \file   mesh_simplifier.hpp
+/// \brief  メッシュ簡略化関数定義ヘッダ
+///
+///         二次誤差(QEM)による辺の縮約でメッシュを簡略化し、LODを生成します。
+///         縮約は既存の頂点への縮約のみ行うため、簡略化後のインデックスは元の頂点データを参照します。
+///         LOD間で頂点バッファを共有するか、
+///         optimizeVertexFetch(…), remapVertices(…)で LOD毎の頂点データに詰め直してください。
+///
+/// \author 板場
+///
+/// \par    履歴
+///         - 2026/10/19
+///             - ヘッダ追加
+///             - SimplifyOptions 定義
+///             - SimplifyResult 定義
+///             - simplifyMesh(…) 定義
+///             - generateLods(…) 定義
+///             - generateLods(…) をジョブシステムで並列に処理するよう変更
+///
+/// \note   誤差について\n
+///         頂点座標をメッシュの大きさ(AABBの最大辺)で正規化し、法線とUVを重み付けして連結した
+///         8次元の一般化二次誤差(Garland & Heckbert 1998)を使用する。
+///         誤差の値はメッシュの大きさに対する比率で、縮約後の面からのずれの二乗平均平方根の目安。
+///
+#ifndef INCLUDED_EGEG_GLIB_MESH_SIMPLIFIER_HEADER_
+#define INCLUDED_EGEG_GLIB_MESH_SIMPLIFIER_HEADER_
+
+#include <cstdint>
+#include <vector>
+#include "mvector.hpp"
+
+namespace easy_engine {
+namespace t_lib { class JobSystem; }
+namespace g_lib {
+
+/******************************************************************************
+
+    SimplifyOptions
+
+******************************************************************************/
+///
+/// \brief  簡略化の設定
+///
+///         三角形数が target_triangles 以下になるか、
+///         次の縮約の誤差が target_error を超えた時点で簡略化を終了します。
+///
+struct SimplifyOptions {
+    size_t target_triangles = 0U;   ///< 目標三角形数
+    float target_error = 1.0e-2F;   ///< 許容誤差(メッシュの大きさに対する比率)
+    bool lock_border = true;        ///< 開いた境界の頂点を固定するか
+    float normal_weight = 0.5F;     ///< 法線の誤差の重み
+    float uv_weight = 1.0F;         ///< UVの誤差の重み
+};
+
+/******************************************************************************
+
+    SimplifyResult
+
+******************************************************************************/
+///
+/// \brief  簡略化結果
+///
+struct SimplifyResult {
+    std::vector<std::uint32_t> indices; ///< 頂点インデックスリスト(元の頂点データを参照)
+    float error;                        ///< 実際に発生した最大誤差
+};
+
+/******************************************************************************
+
+    functions
+
+******************************************************************************/
+///
+/// \brief  メッシュを簡略化
+///
+///         座標が一致する頂点は一つの位置として扱い、
+///         UV、法線の継ぎ目は継ぎ目に沿った縮約のみ行います。
+///         Normals, UVs が空の場合は、その属性を誤差に含めません。
+///
+/// \param[in] Positions : 頂点座標リスト
+/// \param[in] Normals   : 頂点法線リスト(空可)
+/// \param[in] UVs       : 頂点UVリスト(空可)
+/// \param[in] Indices   : 頂点インデックスリスト(三角形リスト)
+/// \param[in] Options   : 簡略化の設定
+///
+/// \return 簡略化結果
+///
+SimplifyResult simplifyMesh(const std::vector<m_lib::Vector3D>& Positions,
+                            const std::vector<m_lib::Vector3D>& Normals,
+                            const std::vector<m_lib::Vector2D>& UVs,
+                            const std::vector<std::uint32_t>& Indices,
+                            const SimplifyOptions& Options);
+
+///
+/// \brief  LODを一括生成
+///
+///         各レベルを元のメッシュから、ジョブシステムのスレッドで並列に簡略化します。
+///         呼び出し例.) generateLods(EasyEngine::jobs(), positions, normals, uvs, indices, levels);
+///         戻り値は Levels と同じ要素数で、同じ添え字に結果が格納されます。
+///
+/// \param[in] Jobs      : 使用するジョブシステム
+/// \param[in] Positions : 頂点座標リスト
+/// \param[in] Normals   : 頂点法線リスト(空可)
+/// \param[in] UVs       : 頂点UVリスト(空可)
+/// \param[in] Indices   : 頂点インデックスリスト(三角形リスト)
+/// \param[in] Levels    : 各レベルの簡略化の設定
+///
+/// \return 各レベルの簡略化結果
+///
+std::vector<SimplifyResult> generateLods(t_lib::JobSystem& Jobs,
+                                         const std::vector<m_lib::Vector3D>& Positions,
+                                         const std::vector<m_lib::Vector3D>& Normals,
+                                         const std::vector<m_lib::Vector2D>& UVs,
+                                         const std::vector<std::uint32_t>& Indices,
+                                         const std::vector<SimplifyOptions>& Levels);
+
+} // namespace g_lib
+} // namespace easy_engine
+#endif // !INCLUDED_EGEG_GLIB_MESH_SIMPLIFIER_HEADER_
+// EOF
@@ -1,13 +1,15 @@
 ///
 /// \file   mmatrix.hpp
-/// \brief  s\̒`wb_
+/// \brief  行列構造体定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/8/3
-///             - wb_ǉ
-///             - s\̈ڍs
+///             - ヘッダ追加
+///             - 行列構造体移行
+///         - 2026/10/19
+///             - MSVC 以外のコンパイラでのアライメント指定付きの型の定義を修正
 ///
 #ifndef INCLUDED_EGEG_MLIB_MMATRIX_HEADER_
 #define INCLUDED_EGEG_MLIB_MMATRIX_HEADER_
@@ -88,11 +90,10 @@ struct Matrix3x3 {
     Matrix3x3& operator*=(float) noexcept;
     Matrix3x3& operator/=(float) noexcept;
 };
-using Matrix3x3A = 
 #ifdef _MSC_VER
-__declspec(align(16)) Matrix3x3;
+using Matrix3x3A = __declspec(align(16)) Matrix3x3;
 #else
-__attribute__((aligned(16))) Matrix3x3;
+typedef Matrix3x3 Matrix3x3A __attribute__((aligned(16)));
 #endif
 
 /******************************************************************************
@@ -133,11 +134,10 @@ struct Matrix3x4 {
     Matrix3x4& operator*=(float) noexcept;
     Matrix3x4& operator/=(float) noexcept;
 };
-using Matrix3x4A =
 #ifdef _MSC_VER
-__declspec(align(16)) Matrix3x4;
+using Matrix3x4A = __declspec(align(16)) Matrix3x4;
 #else
-__attribute__((aligned(16))) Matrix3x4;
+typedef Matrix3x4 Matrix3x4A __attribute__((aligned(16)));
 #endif
 
 /******************************************************************************
@@ -180,11 +180,10 @@ struct Matrix4x3 {
     Matrix4x3& operator*=(float) noexcept;
     Matrix4x3& operator/=(float) noexcept;
 };
-using Matrix4x3A =
 #ifdef _MSC_VER
-__declspec(align(16)) Matrix4x3;
+using Matrix4x3A = __declspec(align(16)) Matrix4x3;
 #else
-__attribute__((aligned(16))) Matrix4x3;
+typedef Matrix4x3 Matrix4x3A __attribute__((aligned(16)));
 #endif
 
 /******************************************************************************
@@ -227,11 +226,10 @@ struct Matrix4x4 {
     Matrix4x4& operator*=(float) noexcept;
     Matrix4x4& operator/=(float) noexcept;
 };
-using Matrix4x4A = 
 #ifdef _MSC_VER
-__declspec(align(16)) Matrix4x4;
+using Matrix4x4A = __declspec(align(16)) Matrix4x4;
 #else
-__attribute__((aligned(16))) Matrix4x4;
+typedef Matrix4x4 Matrix4x4A __attribute__((aligned(16)));
 #endif
 
 /******************************************************************************
@@ -1,32 +1,36 @@
 ///
 /// \file   mmatrix_calc.hpp
-/// \brief  s񉉎Z`wb_
+/// \brief  行列演算定義ヘッダ
 ///
-///         RpCs񉉎Z1T|[gĂ܂B
-///         ftHgƎgpłAEGEG_MLIB_USE_DEFAULT_NONCOPY_OPERATION}N̎wŉ\ɂȂ̂܂B
+///         コンパイル時行列演算を1部サポートしています。
+///         デフォルトだと使用できず、EGEG_MLIB_USE_DEFAULT_NONCOPY_OPERATIONマクロの指定で可能になるものがあります。
 ///
-/// \author 
+/// \author 板場
 ///
-/// \attention 1̃RpCs񉉎Zs߂ɂ́Ae|IuWFNg𐶐ȂIKv邪A
-///            x߂̂ł΃ftHg̏ǂƎvB
-///            ꌩe|IuWFNgȂق悤Ɏv邪A
-///            RpCɂœK]߂̂̓ftHg̕B
+/// \attention 1部のコンパイル時行列演算を行うためには、テンポラリオブジェクトを生成しない処理を選択する必要があるが、
+///            速度を求めるのであればデフォルトの処理が良いと思う。
+///            一見テンポラリオブジェクトを作らないほうが早いように思われるが、
+///            コンパイラによる最適化が望めるのはデフォルトの方。
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/8/3
-///             - wb_ǉ
-///             - `ςݍs񉉎Zڍs
+///             - ヘッダ追加
+///             - 定義済み行列演算移行
 ///         - 2020/8/4
-///             - e|IuWFNg𐶐Ȃs񉉎Z`
+///             - テンポラリオブジェクトを生成しない行列演算定義
 ///         - 2020/8/5
-///             - SIMDZgps̏Z֐`
+///             - SIMD演算を使用した行列の乗算関数定義
+///         - 2026/10/19
+///             - 行列でない型との乗算が、オーバーロードの候補から外れずにエラーとなる問題を修正
+///             - スカラー倍の式テンプレートの生成、変換関数の重複定義を修正
 ///
 #ifndef INCLUDED_EGEG_MLIB_MMATRIX_CALC_HEADER_
 #define INCLUDED_EGEG_MLIB_MMATRIX_CALC_HEADER_
 
+#include <type_traits>
 #include <DirectXMath.h>
 #include "mmatrix.hpp"
-#include "mvector_calc.hpp" // s̏Zœςgp
+#include "mvector_calc.hpp" // 行列の乗算内で内積を使用
 
 namespace easy_engine {
 namespace m_lib {
@@ -144,8 +148,14 @@ namespace m_lib {
         const float r_;
     };
 
+    // 行列でない型(ベクトル、スカラー)との組み合わせは false (置き換え失敗にする)
+    template <class LTy, class RTy, class=void>
+    struct IsMultipliable : std::false_type {};
     template <class LTy, class RTy>
-    static constexpr bool kIsMultipliable = LTy::kNumColumns == RTy::kNumRows;
+    struct IsMultipliable<LTy, RTy, std::void_t<decltype(LTy::kNumColumns), decltype(RTy::kNumRows)>> :
+        std::bool_constant<LTy::kNumColumns == RTy::kNumRows> {};
+    template <class LTy, class RTy>
+    static constexpr bool kIsMultipliable = IsMultipliable<LTy, RTy>::value;
     template <class LTy, class RTy>
     using MultipleType = std::enable_if_t<kIsMultipliable<LTy,RTy>,MatrixType<LTy::kNumRows,RTy::kNumColumns>>;
     template <class MTy>
@@ -345,19 +355,19 @@ namespace m_lib {
     }
     template <class LhTy>
     inline constexpr matrix_impl::MatrixMul<LhTy, float> matrixMul(const LhTy& L, const float R) noexcept {
-        return matrix_impl::MatrixMul{LhTy, R};
+        return matrix_impl::MatrixMul<LhTy, float>{L, R};
     }
     template <class LhTy>
     inline constexpr matrix_impl::MatrixMul<LhTy, float> operator*(const LhTy& L, const float R) noexcept {
-        return matrix_impl::MatrixMul{LhTy, R};
+        return matrix_impl::MatrixMul<LhTy, float>{L, R};
     }
     template <class LhTy>
     inline constexpr matrix_impl::MatrixMul<LhTy, float> matrixDiv(const LhTy& L, const float R) noexcept {
-        return matrix_impl::MatrixMul{LhTy, 1.0F/R};
+        return matrix_impl::MatrixMul<LhTy, float>{L, 1.0F/R};
     }
     template <class LhTy>
     inline constexpr matrix_impl::MatrixMul<LhTy, float> operator/(const LhTy& L, const float R) noexcept {
-        return matrix_impl::MatrixMul{LhTy, 1.0F/R};
+        return matrix_impl::MatrixMul<LhTy, float>{L, 1.0F/R};
     }
   } // namespace default_noncopy_operation
   namespace simd_operation {
@@ -420,28 +430,28 @@ namespace m_lib {
   } // namespace simd_operation
 
   namespace matrix_impl {
-    DirectX::XMMATRIX loadMatrix3x3(const Matrix3x3& M) {
+    inline DirectX::XMMATRIX loadMatrix3x3(const Matrix3x3& M) {
         return DirectX::XMLoadFloat3x3(reinterpret_cast<const DirectX::XMFLOAT3X3*>(&M));
     }
-    DirectX::XMMATRIX loadMatrix3x4(const Matrix3x4& M) {
+    inline DirectX::XMMATRIX loadMatrix3x4(const Matrix3x4& M) {
         return DirectX::XMLoadFloat3x4(reinterpret_cast<const DirectX::XMFLOAT3X4*>(&M));
     }
-    DirectX::XMMATRIX loadMatrix4x3(const Matrix4x3& M) {
+    inline DirectX::XMMATRIX loadMatrix4x3(const Matrix4x3& M) {
         return DirectX::XMLoadFloat4x3(reinterpret_cast<const DirectX::XMFLOAT4X3*>(&M));
     }
-    DirectX::XMMATRIX loadMatrix4x4(const Matrix4x4& M) {
+    inline DirectX::XMMATRIX loadMatrix4x4(const Matrix4x4& M) {
         return DirectX::XMLoadFloat4x4(reinterpret_cast<const DirectX::XMFLOAT4X4*>(&M));
     }
-    void storeMatrix3x3(Matrix3x3& D, DirectX::FXMMATRIX S) {
+    inline void storeMatrix3x3(Matrix3x3& D, DirectX::FXMMATRIX S) {
         DirectX::XMStoreFloat3x3(reinterpret_cast<DirectX::XMFLOAT3X3*>(&D), S);
     }
-    void storeMatrix3x4(Matrix3x4& D, DirectX::FXMMATRIX S) {
+    inline void storeMatrix3x4(Matrix3x4& D, DirectX::FXMMATRIX S) {
         DirectX::XMStoreFloat3x4(reinterpret_cast<DirectX::XMFLOAT3X4*>(&D), S);
     }
-    void storeMatrix4x3(Matrix4x3& D, DirectX::FXMMATRIX S) {
+    inline void storeMatrix4x3(Matrix4x3& D, DirectX::FXMMATRIX S) {
         DirectX::XMStoreFloat4x3(reinterpret_cast<DirectX::XMFLOAT4X3*>(&D), S);
     }
-    void storeMatrix4x4(Matrix4x4& D, DirectX::FXMMATRIX S) {
+    inline void storeMatrix4x4(Matrix4x4& D, DirectX::FXMMATRIX S) {
         DirectX::XMStoreFloat4x4(reinterpret_cast<DirectX::XMFLOAT4X4*>(&D), S);
     }
   } // namespace matrix_impl
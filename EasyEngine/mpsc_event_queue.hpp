@@ -0,0 +1,410 @@
+///
+/// \file   mpsc_event_queue.hpp
+/// \brief  マルチプロデューサー・シングルコンシューマーのイベントキュー定義ヘッダ
+///
+///         複数のスレッドからイベントを追加し、1つのスレッド(メインスレッド等)で呼び出すためのキューです。
+///         いずれもロックを使用しません。
+///
+/// \author 板場
+///
+/// \par    履歴
+///         - 2026/10/19
+///             - ヘッダ追加
+///             - BoundedMpscEventQueue<…> 定義
+///             - MpscEventQueue<…> 定義
+///
+#ifndef INCLUDED_EGEG_TLIB_MPSC_EVENT_QUEUE_HEADER_
+#define INCLUDED_EGEG_TLIB_MPSC_EVENT_QUEUE_HEADER_
+
+#include <cstddef>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+#include "event_container.hpp"
+#include "noncopyable.hpp"
+
+namespace easy_engine {
+namespace t_lib {
+
+/******************************************************************************
+
+    BoundedMpscEventQueue
+
+******************************************************************************/
+///
+/// \brief  容量固定のイベントキュー
+///
+///         リングバッファによる、マルチプロデューサー・シングルコンシューマーのイベントキューです。
+///         (Vyukov の bounded MPMC queue の、取り出し側を1スレッドに限定したもの)
+///         イベントの追加はどのスレッドからでも行えます。呼び出しと取り出しは1つのスレッドからのみ行えます。
+///         追加時にメモリを確保しません。(イベント自体が確保する場合を除く)
+///
+///         呼び出しのインターフェースは EventQueue<…>と同じです。
+/// \see    EventQueue
+///
+/// \tparam FTy      : イベント関数の関数型(EventQueue<…>と同様)
+/// \tparam Capacity : 容量(2の累乗)
+///
+template <class FTy, size_t Capacity=1024U>
+class BoundedMpscEventQueue final : Noncopyable<BoundedMpscEventQueue<FTy, Capacity>> {
+public :
+    static_assert(Capacity >= 2U && (Capacity & (Capacity-1U)) == 0U, "'Capacity' must be power of 2");
+
+    using FuncType = event_impl::EventType<FTy>;
+    using ResultType = typename FuncType::result_type;
+
+    BoundedMpscEventQueue() {
+        for(size_t i = 0U; i < Capacity; ++i) cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    ~BoundedMpscEventQueue() {
+        while(Cell* cell = front()) pop(*cell);
+    }
+
+    ///
+    /// \brief  イベントを追加
+    ///
+    ///         どのスレッドからでも呼び出せます。
+    ///         イベントの構築で例外が送出された場合は、何も追加せずに例外を再送出します。
+    ///
+    /// \param[in] Args : イベントの構築に使用する引数
+    ///
+    /// \return true : 追加した  false : キューが一杯で追加できなかった
+    ///
+    template <class ...ArgTypes_>
+    bool emplace(ArgTypes_&& ...Args) {
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        Cell* cell;
+        for(;;) {
+            cell = &cells_[pos & (Capacity-1U)];
+            const size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+            if(diff == 0) {
+                if(tail_.compare_exchange_weak(pos, pos+1U, std::memory_order_relaxed)) break;
+            }
+            else if(diff < 0) {
+                return false;
+            }
+            else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+        // 確保したセルは公開しないと以降のイベントを取り出せなくなるため、
+        //  構築に失敗した場合は空のセルとして公開する(取り出し側で読み飛ばす)
+        try {
+            ::new(static_cast<void*>(cell->storage)) FuncType(std::forward<ArgTypes_>(Args)...);
+            cell->constructed = true;
+        }
+        catch(...) {
+            cell->constructed = false;
+            cell->sequence.store(pos+1U, std::memory_order_release);
+            throw;
+        }
+        cell->sequence.store(pos+1U, std::memory_order_release);
+        return true;
+    }
+    bool push(const FuncType& Event) { return emplace(Event); }
+    bool push(FuncType&& Event) { return emplace(std::move(Event)); }
+
+    ///
+    /// \brief  先頭のイベントを呼び出す
+    ///
+    ///         保持している最も古いイベントを呼び出します。
+    ///         呼び出したイベントはコンテナ内に残ります。
+    ///         取り出し側のスレッドからのみ呼び出せます。
+    ///
+    /// \param[in] Args : イベントに渡す引数リスト
+    ///
+    /// \return 呼び出したイベントから返った値
+    ///
+    template <class ...ArgTypes_>
+    ResultType call(ArgTypes_&& ...Args) {
+        Cell* cell = front();
+        if(!cell) event_impl::callError("BoundedMpscEventQueue::call");
+
+        return event(*cell)(std::forward<ArgTypes_>(Args)...);
+    }
+
+    ///
+    /// \brief  先頭のイベントを呼び出してから破棄
+    ///
+    ///         取り出し側のスレッドからのみ呼び出せます。
+    ///
+    /// \param[in] Args : イベントに渡す引数リスト
+    ///
+    /// \return 呼び出したイベントから返った値
+    ///
+    template <class ...ArgTypes_>
+    ResultType pop_with_call(ArgTypes_&& ...Args) {
+        Cell* cell = front();
+        if(!cell) event_impl::callError("BoundedMpscEventQueue::pop_with_call");
+
+        auto func = std::move(event(*cell));
+        pop(*cell);
+        return func(std::forward<ArgTypes_>(Args)...);
+    }
+
+    ///
+    /// \brief  キュー内のイベントをまとめて呼び出す
+    ///
+    ///         呼び出し開始の時点で追加されていたイベントを、古い順に呼び出して破棄します。
+    ///         呼び出し中に追加されたイベントは、次回の呼び出しまで残ります。
+    ///         取り出し側のスレッドからのみ呼び出せます。
+    ///
+    /// \param[in] Args : 各イベントに渡す引数リスト
+    ///
+    /// \return 呼び出したイベントの数
+    ///
+    template <class ...ArgTypes_>
+    size_t drainAll(const ArgTypes_& ...Args) {
+        const size_t end = tail_.load(std::memory_order_acquire);
+        size_t count = 0U;
+        while(static_cast<std::ptrdiff_t>(end - head_) > 0) { // 空のセルを読み飛ばすと、head_ が end を越える場合がある
+            Cell* cell = front();
+            if(!cell) break; // 追加中のイベント以降は、順序を保つため次回に回す
+            auto func = std::move(event(*cell));
+            pop(*cell);
+            func(Args...);
+            ++count;
+        }
+        return count;
+    }
+
+    /// 空かどうか(取り出し側のスレッドからのみ正確)
+    bool empty() const noexcept {
+        return cells_[head_ & (Capacity-1U)].sequence.load(std::memory_order_acquire) != head_+1U;
+    }
+    /// 保持しているイベントの数の目安
+    size_t size() const noexcept { return tail_.load(std::memory_order_relaxed) - head_; }
+    static constexpr size_t capacity() noexcept { return Capacity; }
+
+private :
+    struct Cell {
+        std::atomic<size_t> sequence;
+        bool constructed;   // false : イベントの構築に失敗した空のセル
+        alignas(FuncType) unsigned char storage[sizeof(FuncType)];
+    };
+    // 先頭のイベント(空のセルは読み飛ばす)
+    Cell* front() noexcept {
+        for(;;) {
+            Cell* cell = &cells_[head_ & (Capacity-1U)];
+            if(cell->sequence.load(std::memory_order_acquire) != head_+1U) return nullptr;
+            if(cell->constructed) return cell;
+            cell->sequence.store(head_+Capacity, std::memory_order_release);
+            ++head_;
+        }
+    }
+    static FuncType& event(Cell& Target) noexcept {
+        return *std::launder(reinterpret_cast<FuncType*>(Target.storage));
+    }
+    void pop(Cell& Target) noexcept {
+        event(Target).~FuncType();
+        Target.sequence.store(head_+Capacity, std::memory_order_release);
+        ++head_;
+    }
+
+    alignas(64) std::atomic<size_t> tail_{0U};  // 追加側が奪い合う
+    alignas(64) size_t head_ = 0U;              // 取り出し側のみ操作する
+    alignas(64) std::unique_ptr<Cell[]> cells_{new Cell[Capacity]};
+};
+
+
+/******************************************************************************
+
+    MpscEventQueue
+
+******************************************************************************/
+///
+/// \brief  容量無制限のイベントキュー
+///
+///         連結リストによる、マルチプロデューサー・シングルコンシューマーのイベントキューです。
+///         (Vyukov の intrusive MPSC queue)
+///         イベントの追加はどのスレッドからでも行え、追加側は待機しません。
+///         呼び出しと取り出しは1つのスレッドからのみ行えます。
+///
+///         ノードは同じイベント型のキュー間で共有するプールから、まとめて確保して再利用するため、
+///         定常状態では追加時にメモリを確保しません。(プールはプログラムの終了まで領域を返却しません。)
+///
+///         呼び出しのインターフェースは EventQueue<…>と同じです。
+/// \see    EventQueue
+///
+/// \tparam FTy : イベント関数の関数型(EventQueue<…>と同様)
+///
+template <class FTy>
+class MpscEventQueue final : Noncopyable<MpscEventQueue<FTy>> {
+public :
+    using FuncType = event_impl::EventType<FTy>;
+    using ResultType = typename FuncType::result_type;
+
+    MpscEventQueue() : tail_{acquire()} {
+        tail_->next.store(nullptr, std::memory_order_relaxed);
+        head_.store(tail_, std::memory_order_relaxed);
+    }
+    ~MpscEventQueue() {
+        Node* first = tail_;
+        while(Node* next = tail_->next.load(std::memory_order_acquire)) {
+            next->event().~FuncType();
+            tail_ = next;
+        }
+        release(first, tail_);
+    }
+
+    ///
+    /// \brief  イベントを追加
+    ///
+    ///         どのスレッドからでも呼び出せます。
+    ///
+    /// \param[in] Args : イベントの構築に使用する引数
+    ///
+    template <class ...ArgTypes_>
+    void emplace(ArgTypes_&& ...Args) {
+        Node* node = acquire();
+        try {
+            ::new(static_cast<void*>(node->storage)) FuncType(std::forward<ArgTypes_>(Args)...);
+        }
+        catch(...) {
+            release(node, node);
+            throw;
+        }
+        node->next.store(nullptr, std::memory_order_relaxed);
+        Node* prev = head_.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+    }
+    void push(const FuncType& Event) { emplace(Event); }
+    void push(FuncType&& Event) { emplace(std::move(Event)); }
+
+    ///
+    /// \brief  先頭のイベントを呼び出す
+    ///
+    ///         取り出し側のスレッドからのみ呼び出せます。
+    /// \see    BoundedMpscEventQueue::call
+    ///
+    template <class ...ArgTypes_>
+    ResultType call(ArgTypes_&& ...Args) {
+        Node* next = tail_->next.load(std::memory_order_acquire);
+        if(!next) event_impl::callError("MpscEventQueue::call");
+
+        return next->event()(std::forward<ArgTypes_>(Args)...);
+    }
+
+    ///
+    /// \brief  先頭のイベントを呼び出してから破棄
+    ///
+    ///         取り出し側のスレッドからのみ呼び出せます。
+    /// \see    BoundedMpscEventQueue::pop_with_call
+    ///
+    template <class ...ArgTypes_>
+    ResultType pop_with_call(ArgTypes_&& ...Args) {
+        Node* next = tail_->next.load(std::memory_order_acquire);
+        if(!next) event_impl::callError("MpscEventQueue::pop_with_call");
+
+        auto func = std::move(next->event());
+        pop(next);
+        return func(std::forward<ArgTypes_>(Args)...);
+    }
+
+    ///
+    /// \brief  キュー内のイベントをまとめて呼び出す
+    ///
+    ///         取り出し側のスレッドからのみ呼び出せます。
+    /// \see    BoundedMpscEventQueue::drainAll
+    ///
+    template <class ...ArgTypes_>
+    size_t drainAll(const ArgTypes_& ...Args) {
+        const Node* last = head_.load(std::memory_order_acquire);
+        size_t count = 0U;
+        while(tail_ != last) {
+            Node* next = tail_->next.load(std::memory_order_acquire);
+            if(!next) break; // 連結途中のイベント以降は、順序を保つため次回に回す
+            auto func = std::move(next->event());
+            pop(next);
+            func(Args...);
+            ++count;
+        }
+        return count;
+    }
+
+    /// 空かどうか(取り出し側のスレッドからのみ正確)
+    bool empty() const noexcept { return !tail_->next.load(std::memory_order_acquire); }
+
+private :
+    struct Node {
+        FuncType& event() noexcept { return *std::launder(reinterpret_cast<FuncType*>(storage)); }
+
+        std::atomic<Node*> next{nullptr};
+        alignas(FuncType) unsigned char storage[sizeof(FuncType)];
+    };
+
+    static constexpr size_t kChunkSize = 64U; // プールがまとめて確保するノード数
+
+    // ノードのプール
+    //  空きリストへの追加はどのスレッドも行うが、取得は常に全体を引き取るため ABA は起きない
+    struct NodePool {
+        std::atomic<Node*> free{nullptr};
+        std::mutex mutex;
+        std::vector<std::unique_ptr<Node[]>> chunks;
+    };
+    static NodePool& pool() {
+        static NodePool instance;
+        return instance;
+    }
+
+    // スレッド毎の予備ノード
+    //  スレッドの終了時にプールへ戻す
+    struct Spare {
+        ~Spare() {
+            if(!chain) return;
+            Node* last = chain;
+            while(Node* next = last->next.load(std::memory_order_relaxed)) last = next;
+            release(chain, last);
+        }
+
+        Node* chain = nullptr;
+    };
+    static Spare& spare() noexcept {
+        thread_local Spare instance;
+        return instance;
+    }
+
+    // 予備 -> プールの空きリスト(まとめて引き取る) -> 新規確保 の順に取得する
+    static Node* acquire() {
+        Spare& local = spare();
+        if(!local.chain) local.chain = pool().free.exchange(nullptr, std::memory_order_acquire);
+        if(!local.chain) {
+            auto chunk = std::make_unique<Node[]>(kChunkSize);
+            for(size_t i = 0U; i+1U < kChunkSize; ++i) chunk[i].next.store(&chunk[i+1U], std::memory_order_relaxed);
+            local.chain = chunk.get();
+            NodePool& nodes = pool();
+            std::lock_guard<std::mutex> lock{nodes.mutex};
+            nodes.chunks.push_back(std::move(chunk));
+        }
+        return std::exchange(local.chain, local.chain->next.load(std::memory_order_relaxed));
+    }
+
+    // First から Last までの連結済みのノードをプールへ戻す
+    static void release(Node* First, Node* Last) noexcept {
+        NodePool& nodes = pool();
+        Node* top = nodes.free.load(std::memory_order_relaxed);
+        do {
+            Last->next.store(top, std::memory_order_relaxed);
+        } while(!nodes.free.compare_exchange_weak(top, First, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    // 先頭を取り出す
+    //  先頭のノードは次の番兵になり、それまでの番兵をプールへ戻す
+    void pop(Node* Next) noexcept {
+        Next->event().~FuncType();
+        Node* old = std::exchange(tail_, Next);
+        release(old, old);
+    }
+
+    alignas(64) std::atomic<Node*> head_;               // 最後に追加したノード(追加側が奪い合う)
+    alignas(64) Node* tail_;                            // 番兵(取り出し側のみ操作する)
+};
+
+} // namespace t_lib
+} // namespace easy_engine
+#endif // !INCLUDED_EGEG_TLIB_MPSC_EVENT_QUEUE_HEADER_
+// EOF
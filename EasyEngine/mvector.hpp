@@ -1,18 +1,20 @@
 ///
 /// \file   mvector.hpp
-/// \brief  xNg\̒`wb_
+/// \brief  ベクトル構造体定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/7/28
-///             - wb_ǉ
-///             - VectorND `
-///             - MatrixMxN `
-///             - xNgZvg^Cv錾(xdspARpCvZp)
+///             - ヘッダ追加
+///             - VectorND 定義
+///             - MatrixMxN 定義
+///             - ベクトル演算プロトタイプ宣言(速度重視実行時用、コンパイル時計算用)
 ///         - 2020/8/3
-///             - s񉉎Zǉ
-///             - wb_
+///             - 行列演算追加
+///             - ヘッダ分割
+///         - 2026/10/19
+///             - MSVC 以外のコンパイラでのアライメント指定付きの型、演算子の定義を修正
 ///
 #ifndef INCLUDED_EGEG_MLIB_MVECTOR_HEADER_
 #define INCLUDED_EGEG_MLIB_MVECTOR_HEADER_
@@ -67,11 +69,10 @@ struct Vector2D {
     Vector2D& operator*=(float) noexcept;
     Vector2D& operator/=(float) noexcept;
 };
-using Vector2DA =
 #ifdef _MSC_VER
-__declspec(align(16)) Vector2D;
+using Vector2DA = __declspec(align(16)) Vector2D;
 #else
-__attribute__((aligned(16))) Vector2D;
+typedef Vector2D Vector2DA __attribute__((aligned(16)));
 #endif
 
 /******************************************************************************
@@ -113,11 +114,10 @@ struct Vector3D {
     Vector3D& operator*=(float) noexcept;
     Vector3D& operator/=(float) noexcept;
 };
-using Vector3DA =
 #ifdef _MSC_VER
-__declspec(align(16)) Vector3D;
-#else  
-__attribute__((aligned(16))) Vector3D;
+using Vector3DA = __declspec(align(16)) Vector3D;
+#else
+typedef Vector3D Vector3DA __attribute__((aligned(16)));
 #endif
 
 /******************************************************************************
@@ -159,11 +159,10 @@ struct Vector4D {
     Vector4D& operator*=(float) noexcept;
     Vector4D& operator/=(float) noexcept;
 };
-using Vector4DA =
 #ifdef _MSC_VER
-__declspec(align(16)) Vector4D;
+using Vector4DA = __declspec(align(16)) Vector4D;
 #else
-__attribute__((aligned(16))) Vector4D
+typedef Vector4D Vector4DA __attribute__((aligned(16)));
 #endif
 
 /******************************************************************************
@@ -187,8 +186,8 @@ inline Vector2D& Vector2D::operator=(const float (&XY)[N]) noexcept {
 template <class Ty, class>
 inline constexpr Vector2D::Vector2D(const Ty& Temp) noexcept : v{Temp[0], Temp[1]} {}
 template <class Ty>
-inline std::enable_if_t<Ty::kDimension==Vector2D::kDimension, Vector2D&>
-  Vector2D::operator=(const Ty& Temp) noexcept {
+inline auto Vector2D::operator=(const Ty& Temp) noexcept
+  -> std::enable_if_t<Ty::kDimension==kDimension, Vector2D&> {
     v[0] = Temp[0];
     v[1] = Temp[1];
     return *this;
@@ -207,8 +206,8 @@ inline Vector2D& Vector2D::operator+=(const Vector2D& V) noexcept {
     return *this;
 }
 template <class Ty>
-inline std::enable_if_t<Ty::kDimension==Vector2D::kDimension, Vector2D&>
-  Vector2D::operator+=(const Ty& Temp) noexcept {
+inline auto Vector2D::operator+=(const Ty& Temp) noexcept
+  -> std::enable_if_t<Ty::kDimension==kDimension, Vector2D&> {
     v[0] += Temp[0];
     v[1] += Temp[1];
     return *this;
@@ -219,8 +218,8 @@ inline Vector2D& Vector2D::operator-=(const Vector2D& V) noexcept {
     return *this;
 }
 template <class Ty>
-inline std::enable_if_t<Ty::kDimension==Vector2D::kDimension, Vector2D&>
-  Vector2D::operator-=(const Ty& Temp) noexcept {
+inline auto Vector2D::operator-=(const Ty& Temp) noexcept
+  -> std::enable_if_t<Ty::kDimension==kDimension, Vector2D&> {
     v[0] -= Temp[0];
     v[1] -= Temp[1];
     return *this;
@@ -256,8 +255,8 @@ inline Vector3D& Vector3D::operator=(const float (&XYZ)[N]) noexcept {
 template <class Ty, class>
 inline constexpr Vector3D::Vector3D(const Ty& Temp) noexcept : v{Temp[0], Temp[1], Temp[2]} {}
 template <class Ty>
-inline std::enable_if_t<Ty::kDimension==Vector3D::kDimension, Vector3D&>
-  Vector3D::operator=(const Ty& Temp) noexcept {
+inline auto Vector3D::operator=(const Ty& Temp) noexcept
+  -> std::enable_if_t<Ty::kDimension==kDimension, Vector3D&> {
     v[0] = Temp[0];
     v[1] = Temp[1];
     v[2] = Temp[2];
@@ -278,8 +277,8 @@ inline Vector3D& Vector3D::operator+=(const Vector3D& V) noexcept {
     return *this;
 }
 template <class Ty>
-inline std::enable_if_t<Ty::kDimension==Vector3D::kDimension, Vector3D&>
-  Vector3D::operator+=(const Ty& Temp) noexcept {
+inline auto Vector3D::operator+=(const Ty& Temp) noexcept
+  -> std::enable_if_t<Ty::kDimension==kDimension, Vector3D&> {
     v[0] += Temp[0];
     v[1] += Temp[1];
     v[2] += Temp[2];
@@ -292,8 +291,8 @@ inline Vector3D& Vector3D::operator-=(const Vector3D& V) noexcept {
     return *this;
 }
 template <class Ty>
-inline std::enable_if_t<Ty::kDimension==Vector3D::kDimension, Vector3D&>
-  Vector3D::operator-=(const Ty& Temp) noexcept {
+inline auto Vector3D::operator-=(const Ty& Temp) noexcept
+  -> std::enable_if_t<Ty::kDimension==kDimension, Vector3D&> {
     v[0] -= Temp[0];
     v[1] -= Temp[1];
     v[2] -= Temp[2];
@@ -332,8 +331,8 @@ inline Vector4D& Vector4D::operator=(const float (&XYZW)[N]) noexcept {
 template <class Ty, class>
 inline constexpr Vector4D::Vector4D(const Ty& Temp) noexcept : v{Temp[0], Temp[1], Temp[2], Temp[3]} {}
 template <class Ty>
-inline std::enable_if_t<Ty::kDimension==Vector4D::kDimension, Vector4D&>
-  Vector4D::operator=(const Ty& Temp) noexcept {
+inline auto Vector4D::operator=(const Ty& Temp) noexcept
+  -> std::enable_if_t<Ty::kDimension==kDimension, Vector4D&> {
     v[0] = Temp[0];
     v[1] = Temp[1];
     v[2] = Temp[2];
@@ -356,8 +355,8 @@ inline Vector4D& Vector4D::operator+=(const Vector4D& V) noexcept {
     return *this;
 }
 template <class Ty>
-inline std::enable_if_t<Ty::kDimension==Vector4D::kDimension, Vector4D&>
-  Vector4D::operator+=(const Ty& Temp) noexcept {
+inline auto Vector4D::operator+=(const Ty& Temp) noexcept
+  -> std::enable_if_t<Ty::kDimension==kDimension, Vector4D&> {
     v[0] += Temp[0];
     v[1] += Temp[1];
     v[2] += Temp[2];
@@ -372,15 +371,15 @@ inline Vector4D& Vector4D::operator-=(const Vector4D& V) noexcept {
     return *this;
 }
 template <class Ty>
-inline std::enable_if_t<Ty::kDimension==Vector4D::kDimension, Vector4D&>
-  Vector4D::operator-=(const Ty& Temp) noexcept {
+inline auto Vector4D::operator-=(const Ty& Temp) noexcept
+  -> std::enable_if_t<Ty::kDimension==kDimension, Vector4D&> {
     v[0] -= Temp[0];
     v[1] -= Temp[1];
     v[2] -= Temp[2];
     v[3] -= Temp[3];
     return *this;
 }
-Vector4D& Vector4D::operator*=(const float S) noexcept {
+inline Vector4D& Vector4D::operator*=(const float S) noexcept {
     v[0] *= S;
     v[1] *= S;
     v[2] *= S;
@@ -1,13 +1,15 @@
 ///
 /// \file   mvector_calc.hpp
-/// \brief  xNgZ`wb_
+/// \brief  ベクトル演算定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/8/3
-///             - wb_ǉ
-///             - `ς݃xNgZڍs
+///             - ヘッダ追加
+///             - 定義済みベクトル演算移行
+///         - 2026/10/19
+///             - MSVC 固有の __m128 のメンバ、組み込み関数の使用を DirectXMath の関数に置き換え
 ///
 #ifndef INCLUDED_EGEG_MLIB_MVECTOR_CALC_HEADER_
 #define INCLUDED_EGEG_MLIB_MVECTOR_CALC_HEADER_
@@ -151,7 +153,7 @@ namespace m_lib {
     inline constexpr float dot(const Vector4D& L, const Vector4D& R) noexcept {
         return (L[0]*R[0]) + (L[1]*R[1]) + (L[2]*R[2]) + (L[3]*R[3]);
     }
-    // Ql : https://docs.microsoft.com/en-us/windows/win32/api/directxmath/nf-directxmath-xmvector4cross
+    // 参考 : https://docs.microsoft.com/en-us/windows/win32/api/directxmath/nf-directxmath-xmvector4cross
     inline constexpr Vector4D cross(const Vector4D& V1, const Vector4D& V2, const Vector4D& V3) noexcept {
         return Vector4D {
             V1[1]*(V2[2]*V3[3]-V3[2]*V2[3]) - V1[2]*(V2[1]*V3[3]-V3[1]*V2[3]) + V1[3]*(V2[1]*V3[2]-V3[1]*V2[2]),
@@ -241,7 +243,7 @@ namespace m_lib {
     template <class FTy, class STy, class TTy>
     inline constexpr std::enable_if_t<FTy::kDimension==4&&STy::kDimension==4&&TTy::kDimension==4, Vector4D>
       cross(const FTy& F, const STy& S, const TTy& T) noexcept {
-        // KȂ߁Ae|IuWFNg𐶐𓾂Ȃ
+        // 規則性が分からないため、テンポラリオブジェクトを生成せざるを得ない
         return Vector4D {
             F[1]*(S[2]*T[3]-T[2]*S[3]) - F[2]*(S[1]*T[3]-T[1]*S[3]) + F[3]*(S[1]*T[2]-T[1]*S[2]),
             F[0]*(T[2]*S[3]-S[2]*T[3]) - F[2]*(T[0]*S[3]-S[0]*T[3]) + F[3]*(T[0]*S[2]-S[0]*T[2]),
@@ -253,27 +255,27 @@ namespace m_lib {
   namespace simd_operation {
     template <class VectorTy>
     inline DirectX::XMVECTOR vectorAdd(const VectorTy& L, const VectorTy& R) {
-        return DirectX::XMVectorAdd(*reinterpret_cast<const __m128*>(&L), *reinterpret_cast<const __m128*>(&R));
+        return DirectX::XMVectorAdd(*reinterpret_cast<const DirectX::XMVECTOR*>(&L), *reinterpret_cast<const DirectX::XMVECTOR*>(&R));
     }
     template <class VectorTy>
     inline DirectX::XMVECTOR vectorAdd(DirectX::FXMVECTOR L, const VectorTy& R) {
-        return DirectX::XMVectorAdd(L, *reinterpret_cast<const __m128*>(&R));
+        return DirectX::XMVectorAdd(L, *reinterpret_cast<const DirectX::XMVECTOR*>(&R));
     }
     template <class VectorTy>
     inline DirectX::XMVECTOR vectorSub(const VectorTy& L, const VectorTy& R) {
-        return DirectX::XMVectorSubtract(*reinterpret_cast<const __m128*>(&L), *reinterpret_cast<const __m128*>(&R));
+        return DirectX::XMVectorSubtract(*reinterpret_cast<const DirectX::XMVECTOR*>(&L), *reinterpret_cast<const DirectX::XMVECTOR*>(&R));
     }
     template <class VectorTy>
     inline DirectX::XMVECTOR vectorSub(DirectX::FXMVECTOR L, const VectorTy& R) {
-        return DirectX::XMVectorSubtract(L, *reinterpret_cast<const __m128*>(&R));
+        return DirectX::XMVectorSubtract(L, *reinterpret_cast<const DirectX::XMVECTOR*>(&R));
     }
     template <class VectorTy>
     inline DirectX::XMVECTOR vectorMul(const VectorTy& L, const float R) {
-        return DirectX::XMVectorMultiply(*reinterpret_cast<const __m128*>(&L), _mm_load1_ps(&R));
+        return DirectX::XMVectorMultiply(*reinterpret_cast<const DirectX::XMVECTOR*>(&L), DirectX::XMVectorReplicate(R));
     }
     template <class VectorTy>
     inline DirectX::XMVECTOR vectorDiv(const VectorTy& L, const float R) {
-        return DirectX::XMVectorDivide(*reinterpret_cast<const __m128*>(&L), _mm_load1_ps(&R));
+        return DirectX::XMVectorDivide(*reinterpret_cast<const DirectX::XMVECTOR*>(&L), DirectX::XMVectorReplicate(R));
     }
     template <class LhTy, class RhTy>
     inline DirectX::XMVECTOR operator+(const LhTy& L, const RhTy& R) {
@@ -290,31 +292,40 @@ namespace m_lib {
         return simd_operation::vectorDiv(L, R);
     }
     inline float dot(const Vector2D& L, const Vector2D& R) {
-        return DirectX::XMVector2Dot(vector_impl::load(L), vector_impl::load(R)).m128_f32[0];
+        return DirectX::XMVectorGetX(DirectX::XMVector2Dot(vector_impl::load(L), vector_impl::load(R)));
     }
     inline float cross(const Vector2D& L, const Vector2D& R) {
-        return DirectX::XMVector2Cross(vector_impl::load(L), vector_impl::load(R)).m128_f32[0];
+        return DirectX::XMVectorGetX(DirectX::XMVector2Cross(vector_impl::load(L), vector_impl::load(R)));
     }
     inline float dot(const Vector3D& L, const Vector3D& R) {
-        return DirectX::XMVector3Dot(vector_impl::load(L), vector_impl::load(R)).m128_f32[0];
+        return DirectX::XMVectorGetX(DirectX::XMVector3Dot(vector_impl::load(L), vector_impl::load(R)));
     }
     inline Vector3D cross(const Vector3D& L, const Vector3D& R) {
-        return Vector3D{DirectX::XMVector3Cross(vector_impl::load(L), vector_impl::load(R)).m128_f32};
+        Vector3D ret;
+        DirectX::XMStoreFloat3(reinterpret_cast<DirectX::XMFLOAT3*>(&ret),
+                               DirectX::XMVector3Cross(vector_impl::load(L), vector_impl::load(R)));
+        return ret;
     }
     inline float dot(const Vector4D& L, const Vector4D& R) {
-        return DirectX::XMVector4Dot(*reinterpret_cast<const __m128*>(&L), *reinterpret_cast<const __m128*>(&R)).m128_f32[0];
+        return DirectX::XMVectorGetX(
+            DirectX::XMVector4Dot(*reinterpret_cast<const DirectX::XMVECTOR*>(&L), *reinterpret_cast<const DirectX::XMVECTOR*>(&R)));
     }
     inline Vector4D cross(const Vector4D& V1, const Vector4D& V2, const Vector4D& V3) {
-        return Vector4D{DirectX::XMVector4Cross(*reinterpret_cast<const __m128*>(&V1),
-                                                *reinterpret_cast<const __m128*>(&V2),
-                                                *reinterpret_cast<const __m128*>(&V3)).m128_f32};
+        Vector4D ret;
+        DirectX::XMStoreFloat4(reinterpret_cast<DirectX::XMFLOAT4*>(&ret),
+                               DirectX::XMVector4Cross(*reinterpret_cast<const DirectX::XMVECTOR*>(&V1),
+                                                       *reinterpret_cast<const DirectX::XMVECTOR*>(&V2),
+                                                       *reinterpret_cast<const DirectX::XMVECTOR*>(&V3)));
+        return ret;
     }
   } // namespace simd_operation
 
   namespace vector_impl {
     inline DirectX::XMVECTOR load(const Vector2D& V) { return DirectX::XMVECTOR{V[0], V[1]}; }
     inline DirectX::XMVECTOR load(const Vector3D& V) { return DirectX::XMVECTOR{V[0], V[1], V[2]}; }
-    inline DirectX::XMVECTOR load(const Vector4DA& V) { return _mm_load_ps(V.v); }
+    inline DirectX::XMVECTOR load(const Vector4DA& V) {
+        return DirectX::XMLoadFloat4A(reinterpret_cast<const DirectX::XMFLOAT4A*>(V.v));
+    }
   } // namespace vector_impl
 } // namespace m_lib
 } // namespace easy_engine
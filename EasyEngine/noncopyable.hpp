@@ -1,15 +1,15 @@
 ///
 /// \file   noncopyable.hpp
-/// \brief  Rs[֎~~bNXC`wb_
+/// \brief  コピー禁止ミックスイン定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/7/24
-///             - wb_ǉ
-///             - Noncopyable<c> `()
+///             - ヘッダ追加
+///             - Noncopyable<…> 定義(未完)
 ///         - 2020/7/25
-///             - Noncopyable<c> 
+///             - Noncopyable<…> 完成
 ///
 #ifndef INCLUDED_EGEG_TLIB_NONCOPYABLE_HEADER_
 #define INCLUDED_EGEG_TLIB_NONCOPYABLE_HEADER_
@@ -23,13 +23,13 @@ namespace t_lib {
 
 ******************************************************************************/
 ///
-/// \brief  Rs[֎~~bNXC
+/// \brief  コピー禁止ミックスイン
 ///
-///         Rs[֎~t^NXŁÃ~bNXCprivatepĂB
-///         ev[gNXłB
-///         NXɐp̃Rs[֎~~bNXC𗘗p邱ƂŁAȂׂEBO悤ɂĂ܂B
+///         コピー禁止属性を付与したいクラスで、このミックスインをprivate継承してください。
+///         テンプレートクラスです。
+///         クラス毎に専用のコピー禁止ミックスインを利用することで、なるべくEBOが効くようにしています。
 ///
-/// \tparam DerivedTy : Rs[֎~t^NX
+/// \tparam DerivedTy : コピー禁止属性を付与するクラス
 ///
 template <class DerivedTy>
 class Noncopyable {
@@ -0,0 +1,389 @@
+///
+/// \file   parallel_algorithm.hpp
+/// \brief  並列アルゴリズム定義ヘッダ
+///
+///         添え字の範囲、またはランダムアクセス可能なコンテナに対する並列処理です。
+///         処理はジョブシステム(t_lib::JobSystem)のスレッドで行います。
+///
+/// \author 板場
+///
+/// \par    履歴
+///         - 2026/10/19
+///             - ヘッダ追加
+///             - ParallelOptions 定義
+///             - parallelFor(…) 定義
+///             - parallelReduce(…) 定義
+///             - parallelScan(…) 定義
+///
+#ifndef INCLUDED_EGEG_TLIB_PARALLEL_ALGORITHM_HEADER_
+#define INCLUDED_EGEG_TLIB_PARALLEL_ALGORITHM_HEADER_
+
+#include <cstddef>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "job_system.hpp"
+
+namespace easy_engine {
+namespace t_lib {
+
+/******************************************************************************
+
+    ParallelOptions
+
+******************************************************************************/
+///
+/// \brief  並列アルゴリズムの設定
+///
+struct ParallelOptions {
+    ///
+    /// \brief  分割の最小単位(要素数)
+    ///
+    ///         0 の場合は要素数とスレッド数から決定します。
+    ///         1要素当たりの処理が軽い場合は、大きめに指定するとジョブの管理コストを抑えられます。
+    ///
+    size_t grain = 0U;
+
+    ///
+    /// \brief  決定的な結果にするか
+    ///
+    ///         true の場合、範囲の分割と結果の結合の順序を、スレッド数や実行のタイミングに依らず固定します。
+    ///         浮動小数点数の合計等、結合の順序で結果が変わる演算を再現可能にしたい場合に指定します。
+    ///         (分割は要素数と grain のみから決まり、結合は常に範囲の先頭から順に行います。)
+    ///
+    bool deterministic = false;
+};
+
+  namespace parallel_impl {
+    constexpr size_t kChunksPerThread = 8U;         // 適応的な分割で、1スレッド当たりの最小単位の数の目安
+    constexpr size_t kDeterministicChunks = 256U;   // 決定的な分割での分割数の目安(スレッド数に依存させない)
+
+    // 範囲 [Begin, End) を分割し、呼び出したスレッドとヘルパーのジョブで処理する
+    //  Body(size_t Begin, size_t End, size_t Participant) の Participant は処理したスレッドの番号 [0, participants)
+    //  Fixed が false の場合は、残りの要素数に応じて分割の大きさを小さくしていく(ガイド付きスケジューリング)
+    //  Fixed が true の場合は、Grain 毎に固定で分割する
+    template <class BodyTy>
+    class Partitioner {
+    public :
+        Partitioner(const size_t Begin, const size_t End, const size_t Grain, const size_t Threads, const bool Fixed,
+                    BodyTy& Body) noexcept :
+            next_{Begin}, end_{End}, grain_{std::max<size_t>(Grain, 1U)}, threads_{Threads}, fixed_{Fixed}, body_{Body} {}
+
+        // ヘルパーの数
+        size_t helpers() const noexcept {
+            const size_t chunks = (end_ - next_.load(std::memory_order_relaxed) + grain_-1U) / grain_;
+            return std::min(threads_-1U, chunks > 0U ? chunks-1U : 0U);
+        }
+
+        void work(const size_t Participant) noexcept {
+            size_t begin;
+            size_t end;
+            while(acquire(begin, end)) {
+                try {
+                    body_(begin, end, Participant);
+                }
+                catch(...) {
+                    std::lock_guard<std::mutex> lock{mutex_};
+                    if(!error_) error_ = std::current_exception();
+                    next_.store(end_, std::memory_order_relaxed); // 残りは処理しない
+                    return;
+                }
+            }
+        }
+
+        void rethrow() {
+            if(error_) std::rethrow_exception(error_);
+        }
+
+    private :
+        bool acquire(size_t& Begin, size_t& End) noexcept {
+            if(fixed_) {
+                Begin = next_.fetch_add(grain_, std::memory_order_relaxed);
+                if(Begin >= end_) return false;
+                End = std::min(Begin+grain_, end_);
+                return true;
+            }
+            size_t current = next_.load(std::memory_order_relaxed);
+            size_t count;
+            do {
+                if(current >= end_) return false;
+                const size_t remaining = end_ - current;
+                count = std::min(std::max(remaining / (threads_*2U), grain_), remaining);
+            } while(!next_.compare_exchange_weak(current, current+count, std::memory_order_relaxed));
+            Begin = current;
+            End = current + count;
+            return true;
+        }
+
+        std::atomic<size_t> next_;
+        const size_t end_;
+        const size_t grain_;
+        const size_t threads_;
+        const bool fixed_;
+        BodyTy& body_;
+        std::mutex mutex_;
+        std::exception_ptr error_;
+    };
+
+    // 並列に処理するスレッド数
+    //  ジョブシステムに属していないスレッドからの呼び出しは、逐次処理にする
+    //  (登録が共有のキューを経由し、待機中にジョブを実行できないため)
+    inline size_t threads(const JobSystem& Jobs) noexcept {
+        return Jobs.isJobThread() ? Jobs.numThreads() : 1U;
+    }
+
+    // 分割の最小単位
+    inline size_t grain(const size_t Count, const size_t Threads, const ParallelOptions& Options) noexcept {
+        if(Options.grain > 0U) return Options.grain;
+        const size_t chunks = Options.deterministic ? kDeterministicChunks : Threads*kChunksPerThread;
+        return std::max<size_t>((Count + chunks-1U) / chunks, 1U);
+    }
+
+    // Body を分割した範囲毎に並列に呼び出す
+    //  返った時点で、全ての呼び出しが完了している
+    //
+    //  ヘルパーのジョブは開始時点で残っている範囲のみを処理するため、
+    //  ワーカーが全て使用中(入れ子の呼び出し等)の場合でも、呼び出したスレッドが全て処理して待機せずに返る
+    template <class BodyTy>
+    size_t dispatch(JobSystem& Jobs, const size_t Begin, const size_t End, const size_t Grain, const bool Fixed,
+                    BodyTy&& Body, const size_t Threads) {
+        Partitioner<std::remove_reference_t<BodyTy>> partitioner{Begin, End, Grain, Threads, Fixed, Body};
+        const size_t helpers = Threads > 1U ? partitioner.helpers() : 0U;
+        JobCounter counter;
+        for(size_t i = 1U; i <= helpers; ++i)
+            Jobs.run([&partitioner, i]() { partitioner.work(i); }, &counter);
+        partitioner.work(0U);
+        if(helpers > 0U) Jobs.wait(counter);
+        partitioner.rethrow();
+        return helpers + 1U;
+    }
+
+    // Map の呼び出し形式(範囲 : Ty(size_t, size_t, Ty)、要素 : Ty(size_t))の判定
+    template <class MapTy, class Ty>
+    constexpr bool kIsRangeMap = std::is_invocable_v<MapTy&, size_t, size_t, Ty>;
+
+    // 範囲 [Begin, End) を Init から畳み込む
+    template <class Ty, class MapTy, class CombineTy>
+    Ty fold(const size_t Begin, const size_t End, Ty Init, MapTy& Map, CombineTy& Combine) {
+        if constexpr(kIsRangeMap<MapTy, Ty>) {
+            return Map(Begin, End, std::move(Init));
+        }
+        else {
+            for(size_t i = Begin; i < End; ++i) Init = Combine(std::move(Init), Map(i));
+            return Init;
+        }
+    }
+  } // namespace parallel_impl
+
+/******************************************************************************
+
+    parallelFor
+
+******************************************************************************/
+///
+/// \brief  添え字の範囲 [Begin, End) に対して並列に関数を呼び出す
+///
+///         Func は要素毎の void(size_t Index)、または分割した範囲毎の void(size_t Begin, size_t End) です。
+///         範囲毎の形式は、分割の中でのループをコンパイラに最適化させたい場合に使用します。
+///         使用例.)
+///             parallelFor(EasyEngine::jobs(), 0U, particles.size(), [&](size_t I) { particles[I].update(dt); });
+///
+///         呼び出したスレッドも処理に加わり、全ての呼び出しが完了してから返ります。
+///         ジョブの中から呼び出すこと(入れ子の並列処理)ができます。
+///         ジョブシステムに属していないスレッドから呼び出した場合は、そのスレッドで逐次処理します。
+///         呼び出し順は不定です。
+///
+/// \param[in] Jobs    : 使用するジョブシステム
+/// \param[in] Begin   : 範囲の先頭
+/// \param[in] End     : 範囲の終端
+/// \param[in] Func    : 呼び出す関数
+/// \param[in] Options : 設定
+///
+/// \throw  Func から送出された例外(最初の1つ) 送出後、未処理の範囲は呼び出しません。
+///
+template <class FTy>
+void parallelFor(JobSystem& Jobs, const size_t Begin, const size_t End, FTy&& Func,
+                 const ParallelOptions& Options=ParallelOptions{}) {
+    if(Begin >= End) return;
+    const size_t threads = parallel_impl::threads(Jobs);
+    const size_t grain = parallel_impl::grain(End-Begin, threads, Options);
+    parallel_impl::dispatch(Jobs, Begin, End, grain, Options.deterministic, [&Func](const size_t B, const size_t E, size_t) {
+        if constexpr(std::is_invocable_v<FTy&, size_t, size_t>) Func(B, E);
+        else for(size_t i = B; i < E; ++i) Func(i);
+    }, threads);
+}
+
+///
+/// \brief  コンテナの全要素に対して並列に関数を呼び出す
+///
+///         Func は void(要素型&) です。
+///         使用例.)
+///             parallelFor(EasyEngine::jobs(), particles, [dt](Particle& P) { P.update(dt); });
+///
+/// \param[in] Jobs      : 使用するジョブシステム
+/// \param[in] Container : ランダムアクセス可能なコンテナ
+/// \param[in] Func      : 呼び出す関数
+/// \param[in] Options   : 設定
+///
+template <class ContainerTy, class FTy>
+void parallelFor(JobSystem& Jobs, ContainerTy& Container, FTy&& Func, const ParallelOptions& Options=ParallelOptions{}) {
+    const auto first = std::begin(Container);
+    parallelFor(Jobs, 0U, static_cast<size_t>(std::size(Container)), [first, &Func](const size_t B, const size_t E) {
+        for(auto itr = first+B, end = first+E; itr != end; ++itr) Func(*itr);
+    }, Options);
+}
+
+
+/******************************************************************************
+
+    parallelReduce
+
+******************************************************************************/
+///
+/// \brief  添え字の範囲 [Begin, End) を並列に集計
+///
+///         Map は要素毎の Ty(size_t Index)、または範囲毎の Ty(size_t Begin, size_t End, Ty Init) です。
+///         範囲毎の形式は、Init に範囲の要素を畳み込んだ値を返します。
+///         Combine は Ty(Ty, Ty) の結合的な演算で、Identity はその単位元です。
+///         使用例.)
+///             const float total = parallelReduce(jobs, 0U, n, 0.0F,
+///                 [&](size_t I) { return mass[I]; }, std::plus<>{});
+///
+///         既定では、各スレッドが処理した範囲の結果をスレッド毎に結合するため、結合の順序は実行毎に変わります。
+///         ParallelOptions::deterministic を指定すると、固定の分割毎の結果を先頭から順に結合します。
+///
+/// \param[in] Jobs     : 使用するジョブシステム
+/// \param[in] Begin    : 範囲の先頭
+/// \param[in] End      : 範囲の終端
+/// \param[in] Identity : 単位元(空の範囲の結果)
+/// \param[in] Map      : 要素、または範囲の値を求める関数
+/// \param[in] Combine  : 結合する関数
+/// \param[in] Options  : 設定
+///
+/// \return 集計結果
+///
+template <class Ty, class MapTy, class CombineTy>
+Ty parallelReduce(JobSystem& Jobs, const size_t Begin, const size_t End, Ty Identity, MapTy&& Map, CombineTy&& Combine,
+                  const ParallelOptions& Options=ParallelOptions{}) {
+    if(Begin >= End) return Identity;
+    const size_t threads = parallel_impl::threads(Jobs);
+    const size_t grain = parallel_impl::grain(End-Begin, threads, Options);
+
+    if(Options.deterministic) { // 分割毎の結果を、先頭から順に結合する
+        std::vector<Ty> partials((End-Begin + grain-1U) / grain, Identity);
+        parallel_impl::dispatch(Jobs, Begin, End, grain, true, [&](const size_t B, const size_t E, size_t) {
+            partials[(B-Begin) / grain] = parallel_impl::fold(B, E, Identity, Map, Combine);
+        }, threads);
+        Ty result = std::move(Identity);
+        for(auto& partial : partials) result = Combine(std::move(result), std::move(partial));
+        return result;
+    }
+
+    // スレッド毎に結合する
+    std::vector<Ty> partials(threads, Identity);
+    const size_t participants = parallel_impl::dispatch(Jobs, Begin, End, grain, false,
+        [&](const size_t B, const size_t E, const size_t Participant) {
+            partials[Participant] = Combine(std::move(partials[Participant]), parallel_impl::fold(B, E, Identity, Map, Combine));
+        }, threads);
+    Ty result = std::move(partials[0]);
+    for(size_t i = 1U; i < participants; ++i) result = Combine(std::move(result), std::move(partials[i]));
+    return result;
+}
+
+///
+/// \brief  コンテナの全要素を並列に集計
+///
+///         Map は Ty(const 要素型&) です。
+///         使用例.)
+///             const size_t alive = parallelReduce(jobs, enemies, size_t{0U},
+///                 [](const Enemy& E) { return E.isAlive() ? 1U : 0U; }, std::plus<>{});
+///
+template <class ContainerTy, class Ty, class MapTy, class CombineTy>
+Ty parallelReduce(JobSystem& Jobs, const ContainerTy& Container, Ty Identity, MapTy&& Map, CombineTy&& Combine,
+                  const ParallelOptions& Options=ParallelOptions{}) {
+    const auto first = std::begin(Container);
+    return parallelReduce(Jobs, 0U, static_cast<size_t>(std::size(Container)), std::move(Identity),
+        [first, &Map, &Combine](const size_t B, const size_t E, Ty Init) {
+            for(auto itr = first+B, end = first+E; itr != end; ++itr) Init = Combine(std::move(Init), Map(*itr));
+            return Init;
+        }, Combine, Options);
+}
+
+
+/******************************************************************************
+
+    parallelScan
+
+******************************************************************************/
+///
+/// \brief  並列に累積(包括的スキャン)を求める
+///
+///         Out[i] = Identity ○ In[0] ○ In[1] ○ … ○ In[i] (○ は Combine) を求めます。
+///         In と Out は同じでも構いません。(その場での累積)
+///         使用例.) 可変長の出力の書き込み位置を求める
+///             parallelScan(jobs, counts.begin(), counts.end(), offsets.begin(), 0U, std::plus<>{});
+///
+///         範囲を分割し、分割毎の合計と、合計の累積を基にした分割毎の累積の2回に分けて並列に処理します。
+///         Combine は結合的である必要があります。
+///         分割はスレッド数から決めるため、結合の順序で結果が変わる演算の場合は
+///         ParallelOptions::deterministic を指定してください。
+///
+/// \param[in]  Jobs     : 使用するジョブシステム
+/// \param[in]  First    : 入力の先頭(ランダムアクセスイテレータ)
+/// \param[in]  Last     : 入力の終端
+/// \param[out] Out      : 出力の先頭(ランダムアクセスイテレータ)
+/// \param[in]  Identity : 単位元
+/// \param[in]  Combine  : 結合する関数 Ty(Ty, 入力の要素型)
+/// \param[in]  Options  : 設定
+///
+/// \return 全要素の合計
+///
+template <class InputItrTy, class OutputItrTy, class Ty, class CombineTy>
+Ty parallelScan(JobSystem& Jobs, const InputItrTy First, const InputItrTy Last, const OutputItrTy Out, Ty Identity,
+                CombineTy&& Combine, const ParallelOptions& Options=ParallelOptions{}) {
+    const size_t count = static_cast<size_t>(std::distance(First, Last));
+    if(count == 0U) return Identity;
+    const size_t threads = parallel_impl::threads(Jobs);
+    const size_t grain = parallel_impl::grain(count, threads, Options);
+    const size_t chunks = (count + grain-1U) / grain;
+
+  // 分割毎の合計(最後の分割は不要)
+    std::vector<Ty> offsets(chunks, Identity);
+    if(chunks > 1U) {
+        parallel_impl::dispatch(Jobs, 0U, (chunks-1U)*grain, grain, true, [&](const size_t B, const size_t E, size_t) {
+            Ty sum = Identity;
+            for(auto itr = First+B, end = First+E; itr != end; ++itr) sum = Combine(std::move(sum), *itr);
+            offsets[B / grain] = std::move(sum);
+        }, threads);
+    }
+
+  // 合計の累積から、分割毎の開始値を求める
+    Ty total = std::move(Identity);
+    for(size_t i = 0U; i+1U < chunks; ++i) {
+        Ty sum = std::exchange(offsets[i], total);
+        total = Combine(std::move(total), std::move(sum));
+    }
+    offsets.back() = std::move(total);
+
+  // 分割毎の累積
+    parallel_impl::dispatch(Jobs, 0U, count, grain, true, [&](const size_t B, const size_t E, size_t) {
+        Ty sum = offsets[B / grain];
+        auto out = Out+B;
+        for(auto itr = First+B, end = First+E; itr != end; ++itr, ++out) {
+            sum = Combine(std::move(sum), *itr);
+            *out = sum;
+        }
+        if(E == count) offsets.back() = std::move(sum); // 全体の合計
+    }, threads);
+    return std::move(offsets.back());
+}
+
+} // namespace t_lib
+} // namespace easy_engine
+#endif // !INCLUDED_EGEG_TLIB_PARALLEL_ALGORITHM_HEADER_
+// EOF
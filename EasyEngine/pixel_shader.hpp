@@ -1,13 +1,13 @@
 ///
 /// \file   pixel_shader.hpp
-/// \brief  sNZVF[_[`wb_
+/// \brief  ピクセルシェーダー定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/8/28
-///             - wb_ǉ
-///             - PixelShader `
+///             - ヘッダ追加
+///             - PixelShader 定義
 ///
 #ifndef INCLUDED_EGEG_GLIB_PIXEL_SHADER_HEADER_
 #define INCLUDED_EGEG_GLIB_PIXEL_SHADER_HEADER_
@@ -23,41 +23,41 @@ namespace g_lib {
 
 ******************************************************************************/
 ///
-/// \brief  sNZVF[_[
+/// \brief  ピクセルシェーダー
 ///
-/// \par    ǂݍ݂xꍇ
-///         - ftHgRXgN^ō\zVF[_[ɑ
+/// \par    読み込みを遅延させたい場合
+///         - デフォルトコンストラクタで構築したシェーダーに代入
 ///           PixelShader ps{};
-///             c
-///           ps = PixelShader{"hogehoge.xxx", c};
+///             …
+///           ps = PixelShader{"hogehoge.xxx", …};
 ///
-/// \attention  ̃NXP̂łgpł܂AVF[_[Ƃɂ̃NXƂڍ׃NX`\n
-///             ǐオ܂AオƎv̂ł߂܂B\n
+/// \attention  このクラス単体でも使用できますが、シェーダーごとにこのクラスを基底とした詳細クラスを定義した方が\n
+///             可読性が上がりますし、可搬性も上がると思うのでお勧めします。\n
 ///
 class PixelShader {
 public :
     PixelShader() = default;
 
     ///
-    /// \brief  ǂݍ݂𔺂RXgN^
+    /// \brief  読み込みを伴うコンストラクタ
     ///
-    /// \param[in] ShaderFilePath : ǂݍރVF[_[t@C̃pX
+    /// \param[in] ShaderFilePath : 読み込むシェーダーファイルのパス
     ///
     PixelShader(const char* ShaderFilePath);
 
     ///
-    /// \brief  LȃsNZVF[_[
+    /// \brief  有効なピクセルシェーダーか判定
     ///
-    ///         true  : L
-    ///         false : 
+    ///         true  : 有効
+    ///         false : 無効
     ///
-    /// \return 茋
+    /// \return 判定結果
     ///
     bool isValid() const noexcept { return shader_; }
     operator bool() const noexcept { return isValid(); }
 
 
-    /// VF[_[IuWFNg擾
+    /// シェーダーオブジェクトを取得
     ID3D11PixelShader* shader() const noexcept { return shader_.Get(); }
 private :
     Microsoft::WRL::ComPtr<ID3D11PixelShader> shader_;
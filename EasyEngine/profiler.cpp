@@ -0,0 +1,241 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include "profiler.hpp"
+#ifdef EGEG_TLIB_ENABLE_PROFILER
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace prof_ns = easy_engine::t_lib;
+namespace {
+    using prof_ns::Profiler;
+    using SteadyClock = std::chrono::steady_clock;
+
+    constexpr std::uint64_t kEventMask = Profiler::kEventsPerThread - 1U;
+    static_assert((Profiler::kEventsPerThread & kEventMask) == 0U, "'kEventsPerThread' must be power of 2");
+
+    struct Event {
+        const char* name;
+        std::uint64_t begin;
+        std::uint64_t end;
+    };
+
+    // スレッド毎のリングバッファ
+    //  書き込みは所有スレッドのみ。written で書き込み済みの位置を公開する
+    struct ThreadBuffer {
+        explicit ThreadBuffer(std::uint32_t ID) : id{ID}, events{new Event[Profiler::kEventsPerThread]} {}
+        const std::uint32_t id;
+        std::atomic<std::uint64_t> written{0U};
+        std::uint64_t aggregated = 0U;  // endFrame()で集計済みの位置
+        std::unique_ptr<Event[]> events;
+    };
+
+    // 区間毎の計測値(直近 kStatSamples 回)
+    struct Samples {
+        std::vector<std::uint64_t> ticks;
+        std::uint64_t count = 0U;       // 計測回数の合計
+        std::uint64_t first_frame = 0U; // 最初に計測したフレーム
+    };
+
+    struct Frame {
+        std::uint64_t begin;
+        std::uint64_t end;
+    };
+
+    struct State {
+        State() : base_tick{Profiler::now()}, base_time{SteadyClock::now()}, frame_begin{base_tick} {}
+
+        std::mutex mutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+        std::unordered_map<const char*, Samples> samples;
+        std::array<Frame, Profiler::kMaxFrames> frames{};
+        std::uint64_t num_frames = 0U;
+
+      // TSCと実時間の対応(較正用)
+        const std::uint64_t base_tick;
+        const SteadyClock::time_point base_time;
+        std::uint64_t frame_begin;
+    };
+
+    State& state();
+    ThreadBuffer* registerThread();
+    double ticksPerNanosecond();
+    void writeEscaped(std::ostream&, const char*);
+
+    thread_local ThreadBuffer* tls_buffer = nullptr;
+} // unnamed namespace
+
+
+/******************************************************************************
+
+    Profiler::
+
+******************************************************************************/
+void prof_ns::Profiler::record(const char* Name, const std::uint64_t Begin, const std::uint64_t End) noexcept {
+    ThreadBuffer* buffer = tls_buffer;
+    if(!buffer) {
+        try { buffer = tls_buffer = registerThread(); }
+        catch(...) { return; }
+    }
+    const std::uint64_t pos = buffer->written.load(std::memory_order_relaxed);
+    buffer->events[pos & kEventMask] = Event{Name, Begin, End};
+    buffer->written.store(pos+1U, std::memory_order_release);
+}
+
+void prof_ns::Profiler::endFrame() {
+    const std::uint64_t now_tick = now();
+    State& s = state();
+    std::lock_guard<std::mutex> lock{s.mutex};
+
+    s.frames[s.num_frames % kMaxFrames] = Frame{s.frame_begin, now_tick};
+    s.frame_begin = now_tick;
+
+    for(auto& buffer : s.buffers) {
+        const std::uint64_t written = buffer->written.load(std::memory_order_acquire);
+        const std::uint64_t first = std::max(buffer->aggregated, written > kEventsPerThread ? written-kEventsPerThread : 0U);
+        for(std::uint64_t i=first; i<written; ++i) {
+            const Event& event = buffer->events[i & kEventMask];
+            Samples& samples = s.samples[event.name];
+            if(samples.ticks.empty()) {
+                samples.ticks.reserve(kStatSamples);
+                samples.first_frame = s.num_frames;
+            }
+            if(samples.ticks.size() < kStatSamples) samples.ticks.push_back(event.end-event.begin);
+            else samples.ticks[samples.count % kStatSamples] = event.end-event.begin;
+            ++samples.count;
+        }
+        buffer->aggregated = written;
+    }
+    ++s.num_frames;
+}
+
+std::vector<prof_ns::ProfileStats> prof_ns::Profiler::stats() {
+    State& s = state();
+    const double ns_per_tick = 1.0 / ticksPerNanosecond();
+    const auto to_ns = [ns_per_tick](double Ticks) {
+        return std::chrono::nanoseconds{static_cast<std::chrono::nanoseconds::rep>(Ticks*ns_per_tick)};
+    };
+
+    std::lock_guard<std::mutex> lock{s.mutex};
+    std::vector<ProfileStats> result;
+    result.reserve(s.samples.size());
+    std::vector<std::uint64_t> ticks;
+    for(const auto& samples : s.samples) {
+        ticks = samples.second.ticks;
+        const size_t p99 = ticks.size()*99U/100U;
+        std::nth_element(ticks.begin(), ticks.begin()+p99, ticks.end());
+        const std::uint64_t p99_ticks = ticks[p99];
+        const std::uint64_t min_ticks = *std::min_element(ticks.begin(), ticks.end());
+        double sum = 0.0;
+        for(auto t : ticks) sum += static_cast<double>(t);
+
+        const std::uint64_t num_frames = std::max<std::uint64_t>(1U, s.num_frames-samples.second.first_frame);
+        result.push_back(ProfileStats{
+            samples.first,
+            static_cast<double>(samples.second.count) / num_frames,
+            to_ns(static_cast<double>(min_ticks)),
+            to_ns(sum/ticks.size()),
+            to_ns(static_cast<double>(p99_ticks))
+        });
+    }
+    std::sort(result.begin(), result.end(), [](const ProfileStats& L, const ProfileStats& R) { return L.avg > R.avg; });
+
+    return result;
+}
+
+bool prof_ns::Profiler::writeChromeTrace(const char* FilePath, size_t NumFrames) {
+    std::ofstream file{FilePath};
+    if(!file) return false;
+
+    State& s = state();
+    const double us_per_tick = 1.0 / (ticksPerNanosecond()*1000.0);
+    std::lock_guard<std::mutex> lock{s.mutex};
+
+    NumFrames = static_cast<size_t>(std::min<std::uint64_t>({NumFrames, kMaxFrames, s.num_frames}));
+    const std::uint64_t first_frame = s.num_frames - NumFrames;
+    const std::uint64_t window_begin = NumFrames ? s.frames[first_frame % kMaxFrames].begin : s.frame_begin;
+    const auto to_us = [&](std::uint64_t Tick) { return static_cast<double>(Tick-s.base_tick)*us_per_tick; };
+
+    file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+    file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Frames\"}}";
+    for(std::uint64_t f=first_frame; f<s.num_frames; ++f) {
+        const Frame& frame = s.frames[f % kMaxFrames];
+        file << ",\n{\"name\":\"Frame " << f << "\",\"ph\":\"X\",\"pid\":1,\"tid\":0,\"ts\":" << to_us(frame.begin)
+             << ",\"dur\":" << to_us(frame.end)-to_us(frame.begin) << "}";
+    }
+    for(auto& buffer : s.buffers) {
+        const std::uint32_t tid = buffer->id + 1U;
+        file << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << tid
+             << ",\"args\":{\"name\":\"Thread " << buffer->id << "\"}}";
+
+        const std::uint64_t written = buffer->written.load(std::memory_order_acquire);
+        const std::uint64_t first = written > kEventsPerThread ? written-kEventsPerThread : 0U;
+        for(std::uint64_t i=first; i<written; ++i) {
+            const Event& event = buffer->events[i & kEventMask];
+            if(event.begin < window_begin) continue;
+            file << ",\n{\"name\":\"";
+            writeEscaped(file, event.name);
+            file << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << tid << ",\"ts\":" << to_us(event.begin)
+                 << ",\"dur\":" << to_us(event.end)-to_us(event.begin) << "}";
+        }
+    }
+    file << "\n]}\n";
+
+    return static_cast<bool>(file);
+}
+
+
+/******************************************************************************
+
+    others
+
+******************************************************************************/
+namespace {
+State& state() {
+    static State state;
+    return state;
+}
+
+ThreadBuffer* registerThread() {
+    State& s = state();
+    std::lock_guard<std::mutex> lock{s.mutex};
+    s.buffers.push_back(std::make_unique<ThreadBuffer>(static_cast<std::uint32_t>(s.buffers.size())));
+    return s.buffers.back().get();
+}
+
+// 不変TSCを前提に、プロファイラの初期化時点からの経過で較正する
+//  TSC を使用しない場合は steady_clock の周期が求まる
+double ticksPerNanosecond() {
+    const State& s = state();
+    const std::uint64_t tick = Profiler::now();
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(SteadyClock::now() - s.base_time).count();
+    return ns > 0 ? static_cast<double>(tick - s.base_tick) / ns : 1.0;
+}
+
+void writeEscaped(std::ostream& Stream, const char* Str) {
+    for(; Str && *Str; ++Str) {
+        switch(*Str) {
+        case '"' :  Stream << "\\\""; break;
+        case '\\' : Stream << "\\\\"; break;
+        default :
+            if(static_cast<unsigned char>(*Str) >= 0x20U) Stream << *Str;
+        }
+    }
+}
+} // unnamed namespace
+#endif // EGEG_TLIB_ENABLE_PROFILER
+// EOF
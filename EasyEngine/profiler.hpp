@@ -0,0 +1,213 @@
+///
+/// \file   profiler.hpp
+/// \brief  フレームプロファイラ定義ヘッダ
+///
+///         EGEG_TLIB_ENABLE_PROFILER マクロを定義すると、プロファイラが有効になります。
+///         定義しない場合、計測用のマクロは何も生成せず、プロファイラのクラスも定義されません。
+///
+/// \author 板場
+///
+/// \par    履歴
+///         - 2026/10/19
+///             - ヘッダ追加
+///             - EGEG_PROFILE_SCOPE, EGEG_PROFILE_CHAIN, EGEG_PROFILE_FRAME 定義
+///             - ProfileStats 定義
+///             - Profiler 定義
+///             - ProfileScope 定義
+///             - ProfileChain 定義
+///             - x86 以外では、時刻の取得に std::chrono::steady_clock を使用するよう変更
+///
+#ifndef INCLUDED_EGEG_TLIB_PROFILER_HEADER_
+#define INCLUDED_EGEG_TLIB_PROFILER_HEADER_
+
+#define EGEG_TLIB_PROFILE_CONCAT_IMPL(A, B) A##B
+#define EGEG_TLIB_PROFILE_CONCAT(A, B) EGEG_TLIB_PROFILE_CONCAT_IMPL(A, B)
+
+#ifdef EGEG_TLIB_ENABLE_PROFILER
+///
+/// \brief  スコープの計測
+///
+///         スコープの開始から終了までを、Name の区間として記録します。
+///         Name は、プロファイラの使用中に有効な文字列(文字列リテラル等)である必要があります。
+///
+#define EGEG_PROFILE_SCOPE(Name) \
+    const ::easy_engine::t_lib::ProfileScope EGEG_TLIB_PROFILE_CONCAT(egeg_profile_scope_, __LINE__){Name}
+///
+/// \brief  連続した区間の計測
+///
+///         EGEG_PROFILE_CHAIN(Var) で計測を開始し、EGEG_PROFILE_CHAIN_MARK(Var, Name) で
+///         前回の区切りからの区間を Name として記録します。
+///         ループ内で連続して呼び出す処理を、1区間当たり1回の時刻取得で計測できます。
+///
+#define EGEG_PROFILE_CHAIN(Var) ::easy_engine::t_lib::ProfileChain Var
+#define EGEG_PROFILE_CHAIN_MARK(Var, Name) Var.mark(Name)
+/// フレームの区切り(毎フレーム1回、メインスレッドで呼び出す)
+#define EGEG_PROFILE_FRAME() ::easy_engine::t_lib::Profiler::endFrame()
+#else
+#define EGEG_PROFILE_SCOPE(Name) ((void)0)
+#define EGEG_PROFILE_CHAIN(Var) ((void)0)
+#define EGEG_PROFILE_CHAIN_MARK(Var, Name) ((void)0)
+#define EGEG_PROFILE_FRAME() ((void)0)
+#endif // EGEG_TLIB_ENABLE_PROFILER
+
+#ifdef EGEG_TLIB_ENABLE_PROFILER
+#include <cstdint>
+#include <chrono>
+#include <vector>
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define EGEG_TLIB_PROFILE_USE_TSC
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+#include "noncopyable.hpp"
+
+namespace easy_engine {
+namespace t_lib {
+
+/******************************************************************************
+
+    ProfileStats
+
+******************************************************************************/
+///
+/// \brief  区間毎の統計
+///
+///         直近 Profiler::kStatSamples 回の計測から求めます。
+///
+struct ProfileStats {
+    const char* name;                   ///< 区間名
+    double calls_per_frame;             ///< 1フレーム当たりの平均計測回数
+    std::chrono::nanoseconds min;       ///< 最短時間
+    std::chrono::nanoseconds avg;       ///< 平均時間
+    std::chrono::nanoseconds p99;       ///< 99パーセンタイル
+};
+
+/******************************************************************************
+
+    Profiler
+
+******************************************************************************/
+///
+/// \brief  フレームプロファイラ
+///
+///         区間の開始、終了時刻を、スレッド毎のリングバッファに記録します。
+///         時刻は x86 では TSC、それ以外では std::chrono::steady_clock の値で、集計時に実時間へ換算します。
+///         記録はロックを取らず、集計はフレームの区切り(endFrame)で行います。
+///         各タスクマネージャーは、登録されたタスクを自動で計測します。
+///
+class Profiler final {
+public :
+    static constexpr size_t kEventsPerThread = 1U << 16;    ///< スレッド毎に保持する区間数(2のべき乗)
+    static constexpr size_t kMaxFrames = 256U;              ///< 保持するフレーム数
+    static constexpr size_t kStatSamples = 1024U;           ///< 統計に用いる区間毎の計測数
+
+    /// 現在時刻(TSC、または steady_clock のカウント)
+    static std::uint64_t now() noexcept {
+#ifdef EGEG_TLIB_PROFILE_USE_TSC
+        return __rdtsc();
+#else
+        return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+    ///
+    /// \brief  区間の記録
+    ///
+    ///         通常は EGEG_PROFILE_SCOPE を使用してください。
+    ///
+    /// \param[in] Name  : 区間名
+    /// \param[in] Begin : 開始時刻(now()の値)
+    /// \param[in] End   : 終了時刻(now()の値)
+    ///
+    static void record(const char* Name, std::uint64_t Begin, std::uint64_t End) noexcept;
+
+    ///
+    /// \brief  フレームの区切り
+    ///
+    ///         前回の呼び出しからの区間を集計します。
+    ///         タスクの実行が完了している時点で呼び出してください。
+    ///
+    static void endFrame();
+
+    ///
+    /// \brief  区間毎の統計を取得
+    ///
+    /// \return 平均時間の長い順に並べた統計
+    ///
+    static std::vector<ProfileStats> stats();
+
+    ///
+    /// \brief  Chrome トレース形式で出力
+    ///
+    ///         直近のフレームの区間を JSON で出力します。
+    ///         chrome://tracing や Perfetto(https://ui.perfetto.dev)で読み込めます。
+    ///
+    /// \attention スレッド毎のリングバッファを同期せずに読み込むため、
+    ///            endFrame() と同様に、区間を記録しているスレッドが無い時点で呼び出してください。
+    ///            (フレームの処理の後のメインスレッドや、EngineConfig::on_exit 等。)
+    ///            記録中に呼び出した場合、上書き中の区間を読み込む可能性があります。
+    ///
+    /// \param[in] FilePath  : 出力先ファイルパス
+    /// \param[in] NumFrames : 出力するフレーム数(最大 kMaxFrames)
+    ///
+    /// \return true : 成功　false : ファイルを開けなかった
+    ///
+    static bool writeChromeTrace(const char* FilePath, size_t NumFrames=kMaxFrames);
+
+private :
+    Profiler() = delete;
+};
+
+/******************************************************************************
+
+    ProfileScope
+
+******************************************************************************/
+///
+/// \brief  スコープの計測
+///
+///         生成から破棄までを区間として記録します。
+///
+class ProfileScope final : Noncopyable<ProfileScope> {
+public :
+    explicit ProfileScope(const char* Name) noexcept : name_{Name}, begin_{Profiler::now()} {}
+    ~ProfileScope() { Profiler::record(name_, begin_, Profiler::now()); }
+
+private :
+    const char* name_;
+    std::uint64_t begin_;
+};
+
+/******************************************************************************
+
+    ProfileChain
+
+******************************************************************************/
+///
+/// \brief  連続した区間の計測
+///
+///         区間の終了時刻を次の区間の開始時刻として使用します。
+///
+class ProfileChain final : Noncopyable<ProfileChain> {
+public :
+    ProfileChain() noexcept : last_{Profiler::now()} {}
+
+    /// 前回の区切りからの区間を記録
+    void mark(const char* Name) noexcept {
+        const std::uint64_t now = Profiler::now();
+        Profiler::record(Name, last_, now);
+        last_ = now;
+    }
+
+private :
+    std::uint64_t last_;
+};
+
+} // namespace t_lib
+} // namespace easy_engine
+#endif // EGEG_TLIB_ENABLE_PROFILER
+#endif // !INCLUDED_EGEG_TLIB_PROFILER_HEADER_
+// EOF
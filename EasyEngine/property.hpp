@@ -1,17 +1,17 @@
 ///
 /// \file   property.hpp
-/// \brief  vpeB`wb_
+/// \brief  プロパティ定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/7/26
-///             - wb_ǉ
-///             - PropertyBase<c> `
-///             - Property<c> `
+///             - ヘッダ追加
+///             - PropertyBase<…> 定義
+///             - Property<…> 定義
 ///         - 2020/7/27
-///             - Rgǉ
-///             - ftHg̊֐Ŏ邱ƂɋCtAƓrAssignment<c>폜
+///             - コメント追加
+///             - デフォルトの関数で事足りることに気が付き、作業途中だったAssignment<…>を削除
 ///
 #ifndef INCLUDED_EGEG_TLIB_PROPERTY_HEADER_
 #define INCLUDED_EGEG_TLIB_PROPERTY_HEADER_
@@ -29,7 +29,7 @@ class Property;
     template <> class PropertyBase<> {}; // empty PropertyBase
     template <class FieldType, class ...Rest>
     class PropertyBase<FieldType, Rest...> : protected FieldType, protected PropertyBase<Rest...> {
-        static_assert(prop_impl::IsField<FieldType>::value, "'FieldType' must be of type Field<c>");
+        static_assert(prop_impl::IsField<FieldType>::value, "'FieldType' must be of type Field<…>");
     };
     template <class ...FieldTypes, class ...Rest>
     class PropertyBase<Property<FieldTypes...>, Rest...> : protected PropertyBase<FieldTypes..., Rest...> {};
@@ -47,15 +47,15 @@ class Property;
 
 ******************************************************************************/
 ///
-/// \brief  vpeB
+/// \brief  プロパティ
 ///
-///         Field<c> 𕡐ێ܂B
-///         ۔A̓Xg[̃f[^͂ȂField<c>l̋@\񋟂܂B
-///         tB[hւ̃ANZXfield()gp܂B
+///         Field<…> を複数保持します。
+///         代入可否判定、入力ストリームからのデータ入力などField<…>同様の機能を提供します。
+///         フィールドへのアクセスはfield()を使用します。
 ///
 /// \see    Field
 ///
-/// \tparam FieldTypes  : ێtB[ȟ^Xg
+/// \tparam FieldTypes  : 保持するフィールドの型リスト
 ///
 template <class ...FieldTypes>
 class Property : private prop_impl::PropertyBase<FieldTypes...> { //, private prop_impl::Assignment<FieldTypes...> {
@@ -63,12 +63,12 @@ public :
     Property() = default;
 
     ///
-    /// \brief  ̓Xg[̃f[^ŏ
+    /// \brief  入力ストリームからのデータで初期化
     ///
-    ///         ̓Xg[AtB[h̐p[^͂܂B
-    ///         ̍ہAFieldTypes... ̕тœǂݍ܂܂B
+    ///         入力ストリームから、フィールドの数だけパラメータを入力します。
+    ///         その際、FieldTypes... の並びで読み込まれます。
     ///
-    /// \param[in] Istream  : f[^ǂݍޓ̓Xg[
+    /// \param[in] Istream  : データを読み込む入力ストリーム
     ///
     Property(std::istream& Istream) {
         Istream >> *this;
@@ -93,8 +93,8 @@ public :
 private :
     template <class FieldType>
     const FieldType& access() const noexcept {
-        static_assert(field_impl::IsField<FieldType>::value, "'FieldType' must be of type 'Field<c>'");
-        static_assert(std::is_base_of_v<FieldType, Property>, "'FieldType' must be base for this Property<c>'");
+        static_assert(field_impl::IsField<FieldType>::value, "'FieldType' must be of type 'Field<…>'");
+        static_assert(std::is_base_of_v<FieldType, Property>, "'FieldType' must be base for this Property<…>'");
 
         return *static_cast<const FieldType*>(this);
     }
@@ -116,7 +116,7 @@ private :
     };
   } // namespace prop_impl
 
-///< ̓Xg[vpeBւ̓
+///< 入力ストリームからプロパティへの入力
 template <class ...FieldTypes>
 std::istream& operator>>(std::istream& Istream, Property<FieldTypes...>& Prop) {
     prop_impl::Extractor<FieldTypes...>{Istream, Prop};
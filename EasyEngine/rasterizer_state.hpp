@@ -1,14 +1,14 @@
 ///
 /// \file   rasterizer_state.hpp
-/// \brief  X^CUԒ`NX`wb_
+/// \brief  ラスタライザ状態定義クラス定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/9/8
-///             - wb_ǉ
-///             - RasterizerState `
-///             - RasterizerDesc `
+///             - ヘッダ追加
+///             - RasterizerState 定義
+///             - RasterizerDesc 定義
 ///                 -
 ///
 #ifndef INCLUDED_EGEG_GLIB_RASTERIZER_STATE_HEADER_
@@ -25,38 +25,38 @@ namespace g_lib {
     RasterizerDesc
 
 ******************************************************************************/
-/// 3p`_OƂ̓hԂ@
-// ڍ : https://docs.microsoft.com/en-us/windows/win32/api/d3d11/ns-d3d11-d3d11_rasterizer_desc
+/// 3角形をレンダリングするときの塗りつぶし方法
+// 詳細 : https://docs.microsoft.com/en-us/windows/win32/api/d3d11/ns-d3d11-d3d11_rasterizer_desc
 enum class RasterizerFillMode {
     kWireframe,
     kSolid
 };
 
-/// `悵Ȃ3p`̕
-// ڍ : https://docs.microsoft.com/en-us/windows/win32/api/d3d11/ns-d3d11-d3d11_rasterizer_desc
+/// 描画しない3角形の方向
+// 詳細 : https://docs.microsoft.com/en-us/windows/win32/api/d3d11/ns-d3d11-d3d11_rasterizer_desc
 enum class RasterizerCullMode {
     kNone,
     kFront,
     kBack
 };
 
-/// ʂƂĈ3p`̒_̕
+/// 正面として扱う3角形の頂点の方向
 enum class RasterizerFront {
-    kCounterClockWise, ///< v肪
-    kClockWise         ///< v肪
+    kCounterClockWise, ///< 反時計周りが正面
+    kClockWise         ///< 時計回りが正面
 };
 
 struct RasterizerDesc {
-    RasterizerFillMode fill_mode;   ///< 3p`̓hԂ@
-    RasterizerCullMode cull_mode;   ///< `悵Ȃ3p`̎w
-    RasterizerFront front;          ///< ʂƂĈ3p`
-    int depth_bias;                 ///< sNZɒǉ[xl
-    float depth_bias_clamp;         ///< ő[xoCAX
-    float slope_scaled_depth_bias;  ///< sNŽX
-    bool depth_clip_enable;         ///< ɖ߂ÂNbsOLɂ邩@true:L@false:
-    bool scissor_enable;            ///< VU[`OLɂ邩@true:L@false:
-    bool multisample_enable;        ///< }`TvLɂ邩@true:L@false:
-    bool antialiased_line_enable;   ///< ̕`ɃA`GCAXgp邩(multisample_enablefalsêƂ̂)@true:L@false:
+    RasterizerFillMode fill_mode;   ///< 3角形の塗りつぶし方法
+    RasterizerCullMode cull_mode;   ///< 描画しない3角形の指定
+    RasterizerFront front;          ///< 正面として扱う3角形
+    int depth_bias;                 ///< ピクセルに追加される深度値
+    float depth_bias_clamp;         ///< 最大深度バイアス
+    float slope_scaled_depth_bias;  ///< ピクセルの傾き
+    bool depth_clip_enable;         ///< 距離に戻づいたクリッピングを有効にするか　true:有効　false:無効
+    bool scissor_enable;            ///< シザー矩形化リングを有効にするか　true:有効　false:無効
+    bool multisample_enable;        ///< マルチサンプルを有効にするか　true:有効　false:無効
+    bool antialiased_line_enable;   ///< 線の描画にアンチエイリアスを使用するか(multisample_enableがfalseのときのみ)　true:有効　false:無効
 };
 
 
@@ -66,35 +66,35 @@ struct RasterizerDesc {
 
 ******************************************************************************/
 ///
-/// \brief  X^CUԒ`NX
+/// \brief  ラスタライザ状態定義クラス
 ///         
 class RasterizerState {
 public :
     ///
-    /// \brief  ftHg̃RXgN^
+    /// \brief  デフォルトのコンストラクタ
     ///
-    ///         Ԃ̒`܂B
+    ///         状態の定義を持ちません。
     ///
     RasterizerState() = default;
 
     ///
-    /// \brief  X^CUXe[g̍쐬𔺂RXgN^
+    /// \brief  ラスタライザステートの作成を伴うコンストラクタ
     ///
-    /// \param[in] Desc : X^CUXe[g̏Ԓ`\
+    /// \param[in] Desc : ラスタライザステートの状態定義構造体
     ///
     RasterizerState(const RasterizerDesc& Desc);
 
     ///
-    /// \brief  LȃX^CUԒ`IuWFNgǂ
+    /// \brief  有効なラスタライザ状態定義オブジェクトかどうか判定
     ///
-    ///         true  : L
-    ///         false : 
+    ///         true  : 有効
+    ///         false : 無効
     ///
     bool isValid() const noexcept { return state_; }
     operator bool() const noexcept { return isValid(); }
 
 
-    /// X^CUXe[gIuWFNg擾
+    /// ラスタライザステートオブジェクトを取得
     ID3D11RasterizerState* state() const noexcept { state_.Get(); }
 private :
     Microsoft::WRL::ComPtr<ID3D11RasterizerState> state_;
@@ -106,7 +106,7 @@ private :
     rasterizer presets
 
 ******************************************************************************/
-// Ql : https://github.com/microsoft/DirectXTK
+// 参考 : https://github.com/microsoft/DirectXTK
 //        https://github.com/microsoft/DirectXTK/blob/master/Src/CommonStates.cpp
   namespace rasterizer_impl {
       inline RasterizerState createRS(const RasterizerFillMode F, const RasterizerCullMode C) {
@@ -126,9 +126,9 @@ private :
   } // namespace rasterizer_impl
 
 namespace rasterizer_preset {
-/// fill:kSolid@cull:kNone
+/// fill:kSolid　cull:kNone
 inline RasterizerState nonCulling() { return rasterizer_impl::createRS(RasterizerFillMode::kSolid, RasterizerCullMode::kNone); }
-// fill:kSolid@cull:kBack
+// fill:kSolid　cull:kBack
 inline RasterizerState solid() { return rasterizer_impl::createRS(RasterizerFillMode::kSolid, RasterizerCullMode::kBack); }
 // fill:kWireframe cull:kBack
 inline RasterizerState wireframe() { return rasterizer_impl::createRS(RasterizerFillMode::kWireframe, RasterizerCullMode::kBack); }
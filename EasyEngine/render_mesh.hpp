@@ -1,13 +1,13 @@
 ///
 /// \file   render_mesh.hpp
-/// \brief  `pbV`wb_
+/// \brief  描画用メッシュ定義ヘッダ
 ///
-/// \authro 
+/// \authro 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/9/1
-///             - wb_ǉ
-///             - RenderMesh `
+///             - ヘッダ追加
+///             - RenderMesh 定義
 ///
 #ifndef INCLUDED_EGEG_GLIB_RENDER_MESH_HEADER_
 #define INCLUDED_EGEG_GLIB_RENDER_MESH_HEADER_
@@ -26,7 +26,7 @@ namespace g_lib {
 
 ******************************************************************************/
 ///
-/// \brief  `Pʂ̃bV
+/// \brief  描画単位のメッシュ
 ///
 class RenderMesh {
 public :
@@ -40,20 +40,20 @@ public :
     };
 
     ///
-    /// \brief  _CfbNXobt@Zbg
+    /// \brief  頂点インデックスバッファをセット
     ///
-    /// \param[in] Buffer : ZbgCfbNXobt@
-    /// \param[in] Offset : gpvf܂ł̃ItZbg
+    /// \param[in] Buffer : セットするインデックスバッファ
+    /// \param[in] Offset : 使用する要素までのオフセット
     ///
     void setIndex(const IndexBuffer& Buffer, const UINT Offset) noexcept { setIndex(Index{Buffer, Offset}); }
     void setIndex(const Index& Index) noexcept { index_ = Index; }
 
     ///
-    /// \brief  _obt@Zbg
+    /// \brief  頂点バッファをセット
     ///
-    /// \param[in] Slot   : ZbgXbgԍ
-    /// \param[in] Buffer : Zbg钸_obt@
-    /// \param[in] Offset : gpvf܂ł̃ItZbg
+    /// \param[in] Slot   : セットするスロット番号
+    /// \param[in] Buffer : セットする頂点バッファ
+    /// \param[in] Offset : 使用する要素までのオフセット
     ///
     void setVertex(const UINT Slot, const VertexBuffer& Buffer, const UINT Offset) {
         setVertex(Slot, Vertex{Buffer, Offset});
@@ -62,13 +62,13 @@ public :
         vertices_[Slot] = Vertex;
     }
     ///
-    /// \brief  XbgԍA_obt@XgZbg
+    /// \brief  スロット番号が連続した頂点バッファリストをセット
     ///
-    ///         Vertices̐擪vfXbgԍStartSlotɃZbg܂B
-    ///         c̃f[^́A1ZꂽXbgԍɃZbg܂B
+    ///         Verticesの先頭要素がスロット番号StartSlotにセットされます。
+    ///         残りのデータは、順に1ずつ加算されたスロット番号にセットされます。
     ///
-    /// \param[in] StartSlot : XbgJnԍ
-    /// \param[in] Vertices  : Zbg钸_obt@Xg
+    /// \param[in] StartSlot : スロット開始番号
+    /// \param[in] Vertices  : セットする頂点バッファリスト
     ///
     void setVertices(UINT StartSlot, const std::vector<Vertex>& Vertices) {
         for(auto& vertex : Vertices)
@@ -76,9 +76,9 @@ public :
     }
 
 
-    /// _CfbNX擾
+    /// 頂点インデックスを取得
     Index index() const noexcept { return index_; }
-    /// XbgԍɃ}bvꂽ_f[^擾
+    /// スロット番号にマップされた頂点データを取得
     const std::map<UINT, Vertex>& vertices() const noexcept { return vertices_; }
 private :
     Index index_;
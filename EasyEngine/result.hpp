@@ -1,16 +1,16 @@
 ///
 /// \file   result.hpp
-/// \brief  ֐߂lpev[gNXQ`wb_
+/// \brief  関数戻り値用テンプレートクラス群定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/7/27
-///             - wb_ǉ
-///             - Result<c> `
-///             - DetailedResult<c> `
+///             - ヘッダ追加
+///             - Result<…> 定義
+///             - DetailedResult<…> 定義
 ///         - 2020/8/21
-///             - DetailedResult<c> RXgN^noexceptwC
+///             - DetailedResult<…> コンストラクタのnoexcept指定修正
 ///
 #ifndef INCLUDED_EGEG_TLIB_RESULT_HEADER_
 #define INCLUDED_EGEG_TLIB_RESULT_HEADER_
@@ -35,23 +35,23 @@ struct Failure{};
 
 ******************************************************************************/
 ///
-/// \brief  Ԃ߂l
+/// \brief  状態を持つ戻り値
 ///
-///         gp) 
-///          : c return Result<c>{Success{}};
-///          s: c return Result<c>{Failure{}, "hoghoge error"};
-///          NXȗAreturn {Success{}, c};@ƋLq邱Ƃ\łB
+///         使用例) 
+///          成功: … return Result<…>{Success{}};
+///          失敗: … return Result<…>{Failure{}, "hoghoge error"};
+///          クラス名を省略し、return {Success{}, …};　と記述することも可能です。
 ///
-/// \tparam ValueTy : ߂lƂĕێľ^
+/// \tparam ValueTy : 戻り値として保持する値の型
 ///
-/// \attention  Result<bool>ƂăCX^X邱Ƃ֎~Ă܂B\n
-///             g炢ȂAgݍ݌^boolg܂傤B
+/// \attention  Result<bool>としてインスタンス化することを禁止しています。\n
+///             ↑これを使うくらいなら、組み込み型のboolを使いましょう。
 ///
-/// \note   value_̍\zɂ\n
-///         Result̍\zAValueTyNX̏ꍇ̓ftHg̃RXgN^Ăяo邪A\n
-///         gݍ݌^̏ꍇ͌Ă΂Ȃ悤ȃV`G[VB\n
-///         ftHg\zsV`G[VɂāA̒lgp邱Ƃ͖ƂOɊÂA\n
-///         ق̂ƂœK̂
+/// \note   value_の構築について\n
+///         Resultの構築時、ValueTyがクラスの場合はデフォルトのコンストラクタが呼び出されるが、\n
+///         組み込み型の場合は呼ばれないようなシチュエーションがある。\n
+///         デフォルト構築が行われるシチュエーションにおいて、その値が使用されることは無いという前提に基づく、\n
+///         ほんのちょっとした最適化のつもり
 ///
 template <class ValueTy>
 class Result {
@@ -73,7 +73,7 @@ public :
         value_{std::forward<ValTy>(InvalidValue)} {}
 
     ValueType& get() {
-        if(!*this) result_impl::referenceError("Result<c>::get");
+        if(!*this) result_impl::referenceError("Result<…>::get");
         return value_;
     }
     ValueType& operator*() { return get(); }
@@ -94,20 +94,20 @@ template <> class Result<bool>;
 
 ******************************************************************************/
 ///
-/// \brief  ԂƁAڍׂ߂l
+/// \brief  状態と、詳細を持つ戻り値
 ///
-///         Result̊głłB
-///         ԂɒǉāAڍׂێ邱Ƃł܂B
-///         gp)
+///         Resultの拡張版です。
+///         状態に追加して、詳細を保持することができます。
+///         使用例)
 ///          DetailedResult<Hoge*, std::string> f() {
-///              : return {Success{}, new Hoge{}};
-///              s: return {Failure{}, nullptr, "dead"};
+///              成功: return {Success{}, new Hoge{}};
+///              失敗: return {Failure{}, nullptr, "dead"};
 ///          }
 ///
-/// \tparam ValueTy  : ߂lƂĕێľ^
-/// \tparam DetailTy : ڍׂƂĕێľ^
+/// \tparam ValueTy  : 戻り値として保持する値の型
+/// \tparam DetailTy : 詳細として保持する値の型
 ///
-/// \note   ftHg\zɂāAResultƓl
+/// \note   デフォルト構築について、Resultと同様
 /// \see    Result
 ///
 template <class ValueTy, class DetailTy>
@@ -137,7 +137,7 @@ public :
         detail_(std::forward<DtlTy>(Details)) {}
 
     ValueType& get() {
-        if(!*this) result_impl::referenceError("DetailedResult<c>::get");
+        if(!*this) result_impl::referenceError("DetailedResult<…>::get");
         return value_;
     }
     ValueType& operator*() { return get(); }
@@ -155,7 +155,7 @@ private :
 };
 
 template <class DetailTy>
-class DetailedResult<bool, DetailTy> { // bool^ւ̕ꉻ
+class DetailedResult<bool, DetailTy> { // bool型への部分特殊化
 public :
   // alias
     using ValueType = bool;
@@ -1,34 +1,34 @@
 ///
 /// \file   sampler_state.hpp
-/// \brief  Tv[Ԓ`NX`wb_
+/// \brief  サンプラー状態定義クラス定義ヘッダ
 ///
-/// \aurhor 
+/// \aurhor 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/9/4
-///             - wb_ǉ
-///             - SamplerState `
-///             - SamplerDesc `
-///                 - SamplerFilter `
-///                 - SamplerAddressMode `
-///                 - SamplerComparison `
-///                 - PointWrapSampler `
-///                 - PointMirrorSampler `
-///                 - PointClampSampler `
-///                 - PointBorderSampler `
-///                 - PointMirrorOnceSampler `
-///                 - LinearWrapSampler `
-///                 - LinearMirrorSampler `
-///                 - LinearClampSampler `
-///                 - LinearBorderSampler `
-///                 - LinearMirrorOnceSampler `
-///                 - AnisotropicWrapSampler `
-///                 - AnisotropicMirrorSampler `
-///                 - AnisotropicClampSampler `
-///                 - AnisotropicBorderSampler `
-///                 - AnisotropicMirrorOnceSampler `
+///             - ヘッダ追加
+///             - SamplerState 定義
+///             - SamplerDesc 定義
+///                 - SamplerFilter 定義
+///                 - SamplerAddressMode 定義
+///                 - SamplerComparison 定義
+///                 - PointWrapSampler 定義
+///                 - PointMirrorSampler 定義
+///                 - PointClampSampler 定義
+///                 - PointBorderSampler 定義
+///                 - PointMirrorOnceSampler 定義
+///                 - LinearWrapSampler 定義
+///                 - LinearMirrorSampler 定義
+///                 - LinearClampSampler 定義
+///                 - LinearBorderSampler 定義
+///                 - LinearMirrorOnceSampler 定義
+///                 - AnisotropicWrapSampler 定義
+///                 - AnisotropicMirrorSampler 定義
+///                 - AnisotropicClampSampler 定義
+///                 - AnisotropicBorderSampler 定義
+///                 - AnisotropicMirrorOnceSampler 定義
 ///         - 2020/9/8
-///             - vZbg֐ɒu
+///             - プリセットを関数に置き換えた
 ///
 #ifndef INCLUDED_EGEG_GLIB_SAMPLER_STATE_HEADER_
 #define INCLUDED_EGEG_GLIB_SAMPLER_STATE_HEADER_
@@ -46,8 +46,8 @@ namespace g_lib {
     SamplerDesc
 
 ******************************************************************************/
-/// tB^O@
-// ڍ : https://docs.microsoft.com/en-us/windows/win32/api/D3D11/ne-d3d11-d3d11_filter
+/// フィルタリング方法
+// 詳細 : https://docs.microsoft.com/en-us/windows/win32/api/D3D11/ne-d3d11-d3d11_filter
 enum class SamplerFilter {
     kMinMagMipPoint,
     kMinMagPointMipLinear,
@@ -90,8 +90,8 @@ enum class SamplerFilter {
     kMaximumAnisotropic
 };
 
-/// eNX`͈̔͊OɂȂuvW̉@
-// ڍ : https://docs.microsoft.com/en-us/windows/win32/api/D3D11/ne-d3d11-d3d11_texture_address_mode
+/// テクスチャの範囲外になるuv座標の解決方法
+// 詳細 : https://docs.microsoft.com/en-us/windows/win32/api/D3D11/ne-d3d11-d3d11_texture_address_mode
 enum class SamplerAddressMode {
     kWrap,
     kMirror,
@@ -100,8 +100,8 @@ enum class SamplerAddressMode {
     kMirrorOnce
 };
 
-/// TvOꂽf[^Ɗ̃TvOς݃f[^̔r
-// ڍ : https://docs.microsoft.com/en-us/windows/win32/api/d3d11/ne-d3d11-d3d11_comparison_func
+/// サンプリングされたデータと既存のサンプリング済みデータの比較操作
+// 詳細 : https://docs.microsoft.com/en-us/windows/win32/api/d3d11/ne-d3d11-d3d11_comparison_func
 enum class SamplerComparison {
     kNever,
     kLess,
@@ -114,16 +114,16 @@ enum class SamplerComparison {
 };
 
 struct SamplerDesc {
-    SamplerFilter filter;         ///< eNX`TvOۂ̃tB^O@
-    SamplerAddressMode address_u; ///< ͈͊ÕeNX`uW̉@
-    SamplerAddressMode address_v; ///< ͈͊ÕeNX`vW̉@
-    SamplerAddressMode address_w; ///< ͈͊ÕeNX`wW̉@
-    float mip_lod_bias;           ///< vZꂽ݂Ճ}bvx̃ItZbg
-    unsigned max_anisotropy;      ///< filterkAnisotropickComparisonAnisotropicw肵ꍇɎgpNvl(1~16)
-    SamplerComparison comparison; ///< TvOς݃f[^rIvV
-    Color border_color;           ///< address_ZkBorderw肵ꍇɎgp鋫E̐F
-    float min_lod;                ///< ANZXNv~bv}bv̉l
-    float max_lod;                ///< ANZXNv~bv}bv̏l
+    SamplerFilter filter;         ///< テクスチャをサンプリングする際のフィルタリング方法
+    SamplerAddressMode address_u; ///< 範囲外のテクスチャu座標の解決方法
+    SamplerAddressMode address_v; ///< 範囲外のテクスチャv座標の解決方法
+    SamplerAddressMode address_w; ///< 範囲外のテクスチャw座標の解決方法
+    float mip_lod_bias;           ///< 計算されたみっぷマップレベルからのオフセット
+    unsigned max_anisotropy;      ///< filterにkAnisotropicかkComparisonAnisotropicを指定した場合に使用されるクランプ値(1~16)
+    SamplerComparison comparison; ///< サンプリング済みデータ比較オプション
+    Color border_color;           ///< address_〇にkBorderを指定した場合に使用する境界線の色
+    float min_lod;                ///< アクセスをクランプするミップマップの下限値
+    float max_lod;                ///< アクセスをクランプするミップマップの上限値
 };
 
 
@@ -133,37 +133,37 @@ struct SamplerDesc {
 
 ******************************************************************************/
 ///
-/// \brief  Tv[Ԓ`NX
+/// \brief  サンプラー状態定義クラス
 ///
 class SamplerState {
 public :
     ///
-    /// \brief  ftHg̃RXgN^
+    /// \brief  デフォルトのコンストラクタ
     ///
-    ///         Ԃ̒`܂BB
+    ///         状態の定義を持ちません。。
     ///
     SamplerState() = default;
 
     ///
-    /// \brief  Tv[Xe[g̍쐬𔺂RXgN^
+    /// \brief  サンプラーステートの作成を伴うコンストラクタ
     ///
-    /// \param[in] Desc : Tv[Ԓ`\
+    /// \param[in] Desc : サンプラー状態定義構造体
     ///
     SamplerState(const SamplerDesc& Desc);
 
     ///
-    /// \brief  LȃTv[Ԓ`IuWFNgǂ
+    /// \brief  有効なサンプラー状態定義オブジェクトかどうか判定
     ///
-    ///         true  : L
-    ///         false : 
+    ///         true  : 有効
+    ///         false : 無効
     ///
-    /// \return 茋
+    /// \return 判定結果
     ///
     bool isValid() const noexcept { return state_.Get(); }
     operator bool() const noexcept { return isValid(); }
 
 
-    /// Tv[Xe[gIuWFNg擾
+    /// サンプラーステートオブジェクトを取得
     ID3D11SamplerState* state() const noexcept { return state_.Get(); }
 private :
     Microsoft::WRL::ComPtr<ID3D11SamplerState> state_;
@@ -175,7 +175,7 @@ private :
     sampler presets
 
 ******************************************************************************/
-// Ql : https://github.com/microsoft/DirectXTK
+// 参考 : https://github.com/microsoft/DirectXTK
 //        https://github.com/microsoft/DirectXTK/blob/master/Src/CommonStates.cpp
   namespace sampler_impl { 
       inline SamplerState createSampler(const SamplerFilter F, const SamplerAddressMode A, const Color C=Color{0}) {
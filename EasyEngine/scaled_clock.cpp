@@ -0,0 +1,97 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include "scaled_clock.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace egeg_ns = easy_engine;
+
+
+/******************************************************************************
+
+    ScaledClock::
+
+******************************************************************************/
+egeg_ns::ScaledClock::ScaledClock(ScaledClock* const Parent, const double Scale) :
+    parent_{Parent}, scale_{Scale > 0.0 ? Scale : 0.0} {
+    if(parent_) parent_->children_.push_back(this);
+}
+
+egeg_ns::ScaledClock::~ScaledClock() {
+    if(parent_) {
+        auto& siblings = parent_->children_;
+        siblings.erase(std::find(siblings.begin(), siblings.end(), this));
+    }
+    for(auto* child : children_) child->parent_ = nullptr;
+}
+
+void egeg_ns::ScaledClock::advance(const Time Delta) {
+    assert(!parent_ && "ルートクロック以外は親クロックにより更新されます。");
+    tick(Delta);
+}
+
+bool egeg_ns::ScaledClock::isPaused() const noexcept {
+    for(const ScaledClock* clock = this; clock; clock = clock->parent_)
+        if(clock->paused_) return true;
+    return false;
+}
+
+void egeg_ns::ScaledClock::setFixedStep(const Time Step, const uint32_t MaxSteps) noexcept {
+    step_ = Step;
+    max_steps_ = MaxSteps ? MaxSteps : 1U;
+    accumulator_ = Time{};
+}
+
+double egeg_ns::ScaledClock::interpolation() const noexcept {
+    if(!isFixedStep()) return 1.0;
+    return static_cast<double>(accumulator_.nanoseconds()) / step_.nanoseconds();
+}
+
+// 親の経過時間から自身の経過時間を求め、子へ伝える
+//  停止中は 0 を伝えるため、子孫も全て停止する
+void egeg_ns::ScaledClock::tick(const Time ParentDelta) {
+    Time delta{};
+    if(!paused_) {
+        if(scale_ == 1.0) {
+            delta = ParentDelta;
+        }
+        else { // 端数を持ち越し、倍率を掛けた時間の合計がずれないようにする
+            const double scaled = static_cast<double>(ParentDelta.nanoseconds())*scale_ + carry_;
+            const double whole = std::floor(scaled);
+            carry_ = scaled - whole;
+            delta = Nanoseconds{static_cast<Nanoseconds::rep>(whole)};
+        }
+    }
+
+    if(isFixedStep()) {
+        accumulator_ += delta;
+        steps_ = 0U;
+        delta = Time{};
+        while(accumulator_ >= step_ && steps_ < max_steps_) {
+            accumulator_ -= step_;
+            delta += step_;
+            ++steps_;
+        }
+        if(accumulator_ >= step_) accumulator_ %= step_; // 上限を超えた分は切り捨てる
+    }
+    else {
+        steps_ = delta > Time{} ? 1U : 0U;
+    }
+
+    delta_ = delta;
+    now_ += delta;
+    ++ticks_;
+    for(auto* child : children_) child->tick(delta);
+}
+// EOF
@@ -0,0 +1,145 @@
+///
+/// \file   scaled_clock.hpp
+/// \brief  階層クロック定義ヘッダ
+///
+/// \author 板場
+///
+/// \par    履歴
+///         - 2026/10/19
+///             - ヘッダ追加
+///             - ScaledClock 定義
+///             - EngineClocks 定義
+///
+#ifndef INCLUDED_EGEG_SCALED_CLOCK_HEADER_
+#define INCLUDED_EGEG_SCALED_CLOCK_HEADER_
+
+#include <cstdint>
+#include <vector>
+#include "noncopyable.hpp"
+#include "time.hpp"
+
+namespace easy_engine {
+
+/******************************************************************************
+
+    ScaledClock
+
+******************************************************************************/
+///
+/// \brief  時間の速さを変更できる階層クロック
+///
+///         親クロックの経過時間に倍率を掛けた時間で進みます。
+///         停止すると、自身と全ての子クロックの経過時間が 0 になります。
+///         スローモーションや一時停止を、システム毎ではなくクロック単位で行うために使用します。
+///         使用例.) ゲーム内の時間を半分の速さにし、UI は通常の速さで動かす
+///             EasyEngine::clocks().game.setScale(0.5);
+///             ScaledClock physics_clock{&EasyEngine::clocks().game}; // サブシステム専用のクロック
+///
+///         固定ステップを設定したクロックは、経過時間を蓄積し、ステップ単位でのみ進みます。
+///
+///         クロックは1フレームに1回、ルートの advance(…) で親から順に更新されます。
+///         UpdateManager::registerTask にクロックを渡すと、更新関数にそのクロックの経過時間が渡されます。
+///
+/// \attention 生成、破棄はメインスレッドで、ルートの advance(…) の外で行ってください。
+///            子クロックより先に親クロックを破棄した場合、子クロックはルートになります。
+///
+class ScaledClock final : t_lib::Noncopyable<ScaledClock> {
+public :
+    ///
+    /// \brief  コンストラクタ
+    ///
+    /// \param[in] Parent : 親クロック nullptr の場合はルート
+    /// \param[in] Scale  : 時間の倍率
+    ///
+    explicit ScaledClock(ScaledClock* Parent=nullptr, double Scale=1.0);
+    ~ScaledClock();
+
+    ///
+    /// \brief  ルートクロックを進める
+    ///
+    ///         全ての子孫クロックを更新します。
+    ///
+    /// \param[in] Delta : 実際の経過時間
+    ///
+    void advance(Time Delta);
+
+    ///
+    /// \brief  時間の倍率を設定
+    ///
+    ///         次の更新から反映します。負の値は 0 として扱います。
+    ///
+    void setScale(double Scale) noexcept { scale_ = Scale > 0.0 ? Scale : 0.0; }
+    double scale() const noexcept { return scale_; }
+
+    void pause() noexcept { paused_ = true; }
+    void resume() noexcept { paused_ = false; }
+    void setPaused(const bool Paused) noexcept { paused_ = Paused; }
+    /// 停止しているか(自身、または祖先のクロックが停止している場合 true)
+    bool isPaused() const noexcept;
+
+    ///
+    /// \brief  固定ステップの設定
+    ///
+    ///         経過時間を蓄積し、Step の整数倍だけ進みます。
+    ///         1回の更新で進めるステップ数は MaxSteps までとし、超過した時間は切り捨てます。
+    ///
+    /// \param[in] Step     : 1ステップの時間 Time{}で無効
+    /// \param[in] MaxSteps : 1回の更新で進める最大ステップ数
+    ///
+    void setFixedStep(Time Step, uint32_t MaxSteps=5U) noexcept;
+    bool isFixedStep() const noexcept { return step_ > Time{}; }
+    Time fixedStep() const noexcept { return step_; }
+    /// 直前の更新で進めたステップ数(固定ステップでない場合は、進んだ場合 1)
+    uint32_t steps() const noexcept { return steps_; }
+    /// 固定ステップで、次のステップまでの進み具合 [0, 1)
+    double interpolation() const noexcept;
+
+    /// 直前の更新での経過時間
+    Time delta() const noexcept { return delta_; }
+    /// 生成してからの経過時間の合計
+    Time now() const noexcept { return now_; }
+    /// 更新回数
+    uint64_t ticks() const noexcept { return ticks_; }
+    ScaledClock* parent() const noexcept { return parent_; }
+
+private :
+    void tick(Time ParentDelta);
+
+    ScaledClock* parent_;
+    std::vector<ScaledClock*> children_;
+    double scale_;
+    double carry_ = 0.0;    // 倍率を掛けた時間の、ナノ秒未満の端数
+    bool paused_ = false;
+    Time delta_{};
+    Time now_{};
+    uint64_t ticks_ = 0U;
+
+  // 固定ステップ
+    Time step_{};
+    uint32_t max_steps_ = 5U;
+    uint32_t steps_ = 0U;
+    Time accumulator_{};
+};
+
+
+/******************************************************************************
+
+    EngineClocks
+
+******************************************************************************/
+///
+/// \brief  エンジンが持つ標準のクロック
+///
+///         real : 実時間(ルート 倍率、停止は変更しないでください)
+///         game : ゲーム内の時間(real の子) スローモーション、ポーズはこのクロックで行います。
+///         ui   : UI の時間(real の子) ゲームのポーズ中も進みます。
+///
+struct EngineClocks {
+    ScaledClock real;
+    ScaledClock game{&real};
+    ScaledClock ui{&real};
+};
+
+} // namespace easy_engine
+#endif // !INCLUDED_EGEG_SCALED_CLOCK_HEADER_
+// EOF
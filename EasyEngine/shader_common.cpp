@@ -1,4 +1,4 @@
-// 쐬 : 
+// 作成者 : 板場
 /******************************************************************************
 
     include
@@ -25,7 +25,7 @@ shader_ns::Blob shader_ns::loadShaderFile(const char* FilePath) {
     std::fstream stream{FilePath, std::ios::binary|std::ios::in};
     if(!stream) return Blob{};
 
-    // f[^i[pobt@쐬
+    // データ格納用バッファを作成
     stream.seekg(0, std::ios::end);
     const auto end = stream.tellg();
     stream.clear();
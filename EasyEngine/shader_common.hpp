@@ -1,10 +1,10 @@
 ///
 /// \file   shader_common.hpp
-/// \brief  VF[_[ʃwb_
+/// \brief  シェーダー共通ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/8/31
 ///
 #ifndef INCLUDED_EGEG_GLIB_SHADER_COMMON_HEADER_
@@ -42,7 +42,7 @@ namespace g_lib {
             return *this;
         }
     };
-    /// VF[_[t@CWJ
+    /// シェーダーファイルを展開
     Blob loadShaderFile(const char* FilePath);
   } // namespace shader_impl
 
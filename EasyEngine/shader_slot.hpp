@@ -1,16 +1,16 @@
 ///
 /// \file   shader_slot.hpp
-/// \brief  VF[_[NX`wb_
+/// \brief  シェーダー基底クラス定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/8/28
-///             - wb_ǉ
-///             - Shader `
+///             - ヘッダ追加
+///             - Shader 定義
 ///         - 2020/8/31
-///             - wb_ύX(shader.hpp -> shader_slot.hpp)
-///             - NXύX(Shader -> ShaderSlot)
+///             - ヘッダ名変更(shader.hpp -> shader_slot.hpp)
+///             - クラス名変更(Shader -> ShaderSlot)
 ///
 #ifndef INCLUDED_EGEG_GLIB_SHADER_SLOT_HEADER_
 #define INCLUDED_EGEG_GLIB_SHADER_SLOT_HEADER_
@@ -32,31 +32,31 @@ namespace g_lib {
 
 ******************************************************************************/
 ///
-/// \brief  VF[_[Xbg
+/// \brief  シェーダースロット
 ///
-///         VF[_[ւ̓͂i[܂B
+///         シェーダーへの入力を格納します。
 ///
 class ShaderSlot {
 public :
     virtual ~ShaderSlot() = default;
 
     ///
-    /// \brief  萔Zbg
+    /// \brief  定数をセット
     ///
-    /// \param[in] Slot     : ZbgXbgԍ
-    /// \param[in] Constant : Zbg萔
+    /// \param[in] Slot     : セットするスロット番号
+    /// \param[in] Constant : セットする定数
     ///
     void setConstant(const UINT Slot, const ConstantBufferData& Constant) {
         constants_[Slot] = Constant.buffer();
     }
     ///
-    /// \brief  ́AXbgԍA萔Zbg
+    /// \brief  複数の、スロット番号が連続した定数をセット
     ///
-    ///         Xg̐擪vfAXbgԍStartSlotɃZbg܂B
-    ///         c̗vf͏1ZꂽXbgԍɃZbg܂B
+    ///         リストの先頭要素が、スロット番号StartSlotにセットされます。
+    ///         残りの要素は順に1ずつ加算されたスロット番号にセットされます。
     ///
-    /// \param[in] StartSlot : XbgJnԍ
-    /// \param[in] Constants : Zbg萔Xg
+    /// \param[in] StartSlot : スロット開始番号
+    /// \param[in] Constants : セットする定数リスト
     ///
     void setConstants(UINT StartSlot, const std::vector<ConstantBufferData>& Constants) {
         for(auto& constant : Constants)
@@ -64,21 +64,21 @@ public :
     }
     
     ///
-    /// \brief  eNX`Zbg
+    /// \brief  テクスチャをセット
     ///
-    /// \param[in] Slot    : ZbgXbgԍ
-    /// \param[in] Texture : ZbgeNX`
+    /// \param[in] Slot    : セットするスロット番号
+    /// \param[in] Texture : セットするテクスチャ
     ///
     void setTexture(const UINT Slot, const Texture& Texture) {
         textures_[Slot] = Texture.texture();
     }
     ///
-    /// \brief  ́AXbgԍAeNX`Zbg
+    /// \brief  複数の、スロット番号が連続したテクスチャをセット
     ///
-    ///         ڍׂsetConstantsƓlłB
+    ///         詳細はsetConstantsと同様です。
     ///
-    /// \param[in] StartSlot : XbgJnԍ
-    /// \param[in] Textures  : ZbgeNX`Xg
+    /// \param[in] StartSlot : スロット開始番号
+    /// \param[in] Textures  : セットするテクスチャリスト
     ///
     void setTextures(UINT StartSlot, const std::vector<Texture>& Textures) {
         for(auto& texture : Textures)
@@ -86,21 +86,21 @@ public :
     }
 
     ///
-    /// \brief  Tv[Xe[gZbg
+    /// \brief  サンプラーステートをセット
     ///
-    /// \param[in] Slot    : ZbgXbgԍ
-    /// \param[in] Sampler : ZbgTv[Xe[g
+    /// \param[in] Slot    : セットするスロット番号
+    /// \param[in] Sampler : セットするサンプラーステート
     ///
     void setSampler(const UINT Slot, const SamplerState& Sampler) {
         samplers_[Slot] = Sampler.state();
     }
     ///
-    /// \brief  ́AXbgԍATv[Xe[gZbg
+    /// \brief  複数の、スロット番号が連続したサンプラーステートをセット
     ///
-    ///         ڍׂSetConstantsƓlł
+    ///         詳細はSetConstantsと同様です
     ///
-    /// \param[in] StartSlot : XbgJnԍ
-    /// \param[in] Samplers  : ZbgTv[Xe[gXg
+    /// \param[in] StartSlot : スロット開始番号
+    /// \param[in] Samplers  : セットするサンプラーステートリスト
     ///
     void setSamplers(UINT StartSlot, const std::vector<SamplerState>& Samplers) {
         for(auto& sampler : Samplers)
@@ -108,11 +108,11 @@ public :
     }
 
 
-    /// XbgԍɃ}bvꂽ萔obt@擾
+    /// スロット番号にマップされた定数バッファを取得
     const std::map<UINT, Microsoft::WRL::ComPtr<ID3D11Buffer>>& constants() const noexcept { return constants_; }
-    /// XbgԍɃ}bvꂽeNX`擾
+    /// スロット番号にマップされたテクスチャを取得
     const std::map<UINT, Microsoft::WRL::ComPtr<ID3D11ShaderResourceView>>& textures() const noexcept { return textures_; }
-    /// XbgԍɃ}bvꂽTv[擾
+    /// スロット番号にマップされたサンプラーを取得
     const std::map<UINT, Microsoft::WRL::ComPtr<ID3D11SamplerState>>& samplers() const noexcept { return samplers_; }
 //protected :
     ShaderSlot() = default;
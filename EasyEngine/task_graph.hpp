@@ -0,0 +1,457 @@
+///
+/// \file   task_graph.hpp
+/// \brief  依存グラフによるタスクスケジューラ定義ヘッダ
+///
+/// \author 板場
+///
+/// \par    履歴
+///         - 2026/10/19
+///             - ヘッダ追加
+///             - TaskGraphStats 定義
+///             - TaskGraph<…> 定義
+///             - プロファイラで計測するよう変更
+///
+#ifndef INCLUDED_EGEG_TLIB_TASK_GRAPH_HEADER_
+#define INCLUDED_EGEG_TLIB_TASK_GRAPH_HEADER_
+
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+#include "noncopyable.hpp"
+#include "event_container.hpp"
+#include "job_system.hpp"
+#include "task_manager.hpp"
+
+namespace easy_engine {
+namespace t_lib {
+
+///
+/// \brief  リソースID
+///
+///         タスクが読み書きするデータを識別します。
+///         TypeIDGenerator<…>や uniqueID(…)で生成した値をそのまま使用できます。
+///
+using ResourceID = std::uintptr_t;
+
+/******************************************************************************
+
+    TaskGraphStats
+
+******************************************************************************/
+///
+/// \brief  タスクグラフの実行統計(1フレーム分)
+///
+struct TaskGraphStats {
+    std::chrono::nanoseconds elapsed{};         ///< グラフ全体の実行時間
+    std::chrono::nanoseconds total_work{};      ///< 各タスクの実行時間の合計
+    std::chrono::nanoseconds critical_path{};   ///< 最も長い依存の連鎖の実行時間
+    size_t num_tasks = 0U;                      ///< タスク数
+    size_t num_waves = 0U;                      ///< 同時に実行できるタスク群の数
+    std::vector<const char*> critical_tasks;    ///< クリティカルパス上のタスク名(実行順)
+
+    /// 理論上の並列度(合計 / クリティカルパス)
+    double parallelism() const noexcept {
+        return critical_path.count() ? static_cast<double>(total_work.count())/critical_path.count() : 0.0;
+    }
+};
+
+/******************************************************************************
+
+    TaskGraph
+
+******************************************************************************/
+///
+/// \brief  依存グラフによるタスクスケジューラ
+///
+///         タスク間の順序を、明示的な依存(after)か、読み書きするリソースの集合で指定します。
+///         リソースによる順序は登録順で決まります。
+///         - 書き込むタスクは、先に登録された同じリソースを読み書きするタスクの後
+///         - 読み込むタスクは、先に登録された同じリソースに書き込むタスクの後
+///
+///         グラフは登録状況が変化した後の最初の実行時にコンパイルされ、
+///         依存の深さ毎のウェーブに分けられます。
+///         同じウェーブのタスクはジョブシステムで並列に実行されます。
+///
+///         実行中(タスク内から)の登録と解除は、その回の実行が終わった後に反映します。
+///         実行中に解除したタスクは、まだ呼び出されていなければその回は呼び出されません。
+///         (同じウェーブで並列に実行中のタスクを解除した場合、そのタスクは最後まで実行されます。)
+///
+/// \attention 実行中以外の登録、解除は run(…)を呼び出すスレッドから行ってください。
+///            実行中は、どのスレッドで実行されるタスクからも登録、解除できます。
+///
+/// \tparam TaskTy : 登録するタスクの型(TaskManager<…>と同様)
+///
+/// \par    登録例
+///         \code
+///         TaskGraph<void(Time)>::TaskDesc desc;
+///         desc.name = "physics";
+///         desc.reads = {TypeIDGenerator<Input>{}};
+///         desc.writes = {TypeIDGenerator<Transform>{}};
+///         auto info = graph.registerTask([](Time){ … }, desc);
+///         \endcode
+///
+template <class TaskTy>
+class TaskGraph : Noncopyable<TaskGraph<TaskTy>> {
+public :
+  // aliases
+    using TaskType = event_impl::EventType<TaskTy>;
+    using TaskID = std::uint32_t;
+
+  // nested class
+    ///< タスクの設定
+    struct TaskDesc {
+        const char* name = "";                  ///< タスク名(統計用)
+        std::vector<TaskID> after;              ///< 先に実行するタスク
+        std::vector<ResourceID> reads;          ///< 読み込むリソース
+        std::vector<ResourceID> writes;         ///< 書き込むリソース
+        TaskAffinity affinity = TaskAffinity::kAnyThread;
+    };
+
+    ///< タスク登録情報
+    class TaskInfo final : Noncopyable<TaskInfo> {
+    public :
+        friend TaskGraph;
+
+        TaskInfo() = default;
+        TaskInfo(TaskInfo&& Right) noexcept : id_{Right.id_}, graph_{Right.graph_} {
+            Right.graph_ = nullptr;
+        }
+        TaskInfo& operator=(TaskInfo&& Right) noexcept {
+            exitFromManager();
+            id_ = Right.id_;
+            graph_ = Right.graph_;
+            Right.graph_ = nullptr;
+
+            return *this;
+        }
+        ~TaskInfo() { exitFromManager(); }
+        void exitFromManager() { if(graph_) graph_->unregisterTask(*this); }
+
+        /// 依存の指定(TaskDesc::after)に使用するID
+        TaskID id() const noexcept { return id_; }
+
+    private :
+        TaskInfo(TaskID ID, TaskGraph* Graph) : id_{ID}, graph_{Graph} {}
+        TaskID id_ = 0U;
+        TaskGraph* graph_ = nullptr;
+    };
+
+  // functions
+    ///
+    /// \brief  タスクを登録
+    ///
+    ///         次の実行時にグラフが再コンパイルされます。
+    ///
+    /// \tparam TaskTy_ : 登録するタスク型
+    /// \param[in] Task : 登録するタスク
+    /// \param[in] Desc : タスクの設定
+    ///
+    /// \return タスクの登録情報
+    ///
+    template <class TaskTy_>
+    [[nodiscard]] TaskInfo registerTask(TaskTy_&& Task, TaskDesc Desc) {
+        Node node{TaskType{std::forward<TaskTy_>(Task)}, std::move(Desc), 0U, {}};
+
+        std::unique_lock<std::mutex> lock{mutex_, std::defer_lock};
+        if(running_) lock.lock();
+
+        const TaskID id = node.id = next_id_++;
+        if(running_) {
+            deferred_.push_back(std::move(node));
+        }
+        else {
+            slots_.emplace(id, nodes_.size());
+            nodes_.push_back(std::move(node));
+            dirty_ = true;
+        }
+        return TaskInfo{id, this};
+    }
+
+    ///
+    /// \brief  タスクを解除
+    ///
+    ///         解除されたタスクへの依存は無視されます。
+    ///         実行中に解除したタスクは、以降呼び出されず、その回の実行が終わった後に取り除かれます。
+    ///
+    /// \param[in] Info : タスクの情報(登録時に生成される)
+    ///
+    void unregisterTask(TaskInfo& Info) {
+        std::unique_lock<std::mutex> lock{mutex_, std::defer_lock};
+        if(running_) lock.lock();
+
+        if(Info.graph_ == this) {
+            const auto found = slots_.find(Info.id_);
+            if(found == slots_.end()) { // 実行中に登録されたタスク
+                deferred_.erase(std::remove_if(deferred_.begin(), deferred_.end(),
+                    [id=Info.id_](const Node& N) { return N.id == id; }), deferred_.end());
+            }
+            else if(running_) { // 実行中のタスク自身である可能性があるため、破棄は実行後
+                if(!removed_[found->second].exchange(true, std::memory_order_release)) ++num_removed_;
+            }
+            else {
+                erase(found);
+            }
+        }
+        Info.graph_ = nullptr;
+    }
+
+    ///
+    /// \brief  グラフをコンパイル
+    ///
+    ///         依存関係からウェーブ毎の実行順を作成します。
+    ///         run(…)が必要に応じて呼び出すため、通常は呼び出す必要はありません。
+    ///
+    /// \throw  std::logic_error : 依存が循環している場合
+    ///
+    void compile() {
+        const size_t num_nodes = nodes_.size();
+
+      // 辺の列挙(登録順に処理して、リソースの読み書きの順序を決める)
+        std::vector<std::uint32_t> by_id(num_nodes);
+        for(std::uint32_t i=0; i<num_nodes; ++i) by_id[i] = i;
+        std::sort(by_id.begin(), by_id.end(), [this](std::uint32_t L, std::uint32_t R) { return nodes_[L].id < nodes_[R].id; });
+
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> edges; // (先, 後)
+        std::unordered_map<ResourceID, std::uint32_t> last_writer;
+        std::unordered_map<ResourceID, std::vector<std::uint32_t>> readers;
+        for(auto n : by_id) {
+            const TaskDesc& desc = nodes_[n].desc;
+            for(auto dependency : desc.after)
+                if(auto found=slots_.find(dependency); found!=slots_.end())
+                    edges.emplace_back(static_cast<std::uint32_t>(found->second), n);
+            for(auto resource : desc.reads) {
+                if(auto writer=last_writer.find(resource); writer!=last_writer.end())
+                    edges.emplace_back(writer->second, n);
+                readers[resource].push_back(n);
+            }
+            for(auto resource : desc.writes) {
+                if(auto writer=last_writer.find(resource); writer!=last_writer.end())
+                    edges.emplace_back(writer->second, n);
+                auto& reader_list = readers[resource];
+                for(auto reader : reader_list) edges.emplace_back(reader, n);
+                reader_list.clear();
+                last_writer[resource] = n;
+            }
+        }
+        edges.erase(std::remove_if(edges.begin(), edges.end(), [](const auto& E) { return E.first == E.second; }), edges.end());
+        std::sort(edges.begin(), edges.end(), [](const auto& L, const auto& R) {
+            return L.second != R.second ? L.second < R.second : L.first < R.first;
+        });
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+      // 先行タスク(CSR)と後続タスク(CSR)
+        pred_offsets_.assign(num_nodes+1U, 0U);
+        preds_.resize(edges.size());
+        std::vector<std::uint32_t> succ_offsets(num_nodes+1U, 0U);
+        std::vector<std::uint32_t> succs(edges.size());
+        for(const auto& edge : edges) { ++pred_offsets_[edge.second+1U]; ++succ_offsets[edge.first+1U]; }
+        for(size_t i=0; i<num_nodes; ++i) {
+            pred_offsets_[i+1U] += pred_offsets_[i];
+            succ_offsets[i+1U] += succ_offsets[i];
+        }
+        {
+            std::vector<std::uint32_t> cursor{succ_offsets.begin(), succ_offsets.end()-1};
+            for(size_t e=0; e<edges.size(); ++e) {
+                preds_[e] = edges[e].first; // edges は後続タスク順に整列済み
+                succs[cursor[edges[e].first]++] = edges[e].second;
+            }
+        }
+
+      // 最長経路の深さでウェーブに分ける(Kahn)
+        std::vector<std::uint32_t> in_degree(num_nodes);
+        std::vector<std::uint32_t> level(num_nodes, 0U);
+        std::vector<std::uint32_t> ready;
+        for(std::uint32_t n=0; n<num_nodes; ++n) {
+            in_degree[n] = pred_offsets_[n+1U] - pred_offsets_[n];
+            if(in_degree[n] == 0U) ready.push_back(n);
+        }
+        size_t num_sorted = 0U;
+        std::uint32_t num_waves = 0U;
+        while(!ready.empty()) {
+            const auto n = ready.back();
+            ready.pop_back();
+            ++num_sorted;
+            num_waves = std::max(num_waves, level[n]+1U);
+            for(auto s=succ_offsets[n]; s<succ_offsets[n+1U]; ++s) {
+                const auto next = succs[s];
+                level[next] = std::max(level[next], level[n]+1U);
+                if(--in_degree[next] == 0U) ready.push_back(next);
+            }
+        }
+        if(num_sorted != num_nodes) {
+            for(std::uint32_t n=0; n<num_nodes; ++n)
+                if(in_degree[n]) throw std::logic_error(std::string{"TaskGraph::compile : cyclic dependency. task: "}+nodes_[n].desc.name);
+        }
+
+        wave_offsets_.assign(num_waves+1U, 0U);
+        for(auto l : level) ++wave_offsets_[l+1U];
+        for(size_t w=0; w<num_waves; ++w) wave_offsets_[w+1U] += wave_offsets_[w];
+        order_.resize(num_nodes);
+        {
+            std::vector<std::uint32_t> cursor{wave_offsets_.begin(), wave_offsets_.end()-1};
+            for(std::uint32_t n=0; n<num_nodes; ++n) order_[cursor[level[n]]++] = n;
+        }
+        dirty_ = false;
+    }
+
+    ///
+    /// \brief  全タスクを実行
+    ///
+    ///         ウェーブ毎に、同じウェーブのタスクを並列に実行します。
+    ///         TaskAffinity::kMainThread のタスクは、この関数を呼び出したスレッドで実行します。
+    ///         タスクから送出された例外は、そのウェーブが完了した後に再送出します。
+    ///
+    /// \tparam ArgTypes : 実行するタスクに渡す引数型リスト
+    /// \param[in] Jobs  : 使用するジョブシステム
+    /// \param[in] Args  : 実行するタスクに渡す引数リスト
+    ///
+    template <class ...ArgTypes>
+    void run(JobSystem& Jobs, ArgTypes ...Args) {
+        using Clock = std::chrono::high_resolution_clock;
+        if(dirty_) compile();
+        if(removed_.size() != nodes_.size()) removed_ = std::vector<std::atomic<bool>>(nodes_.size());
+        for(auto& removed : removed_) removed.store(false, std::memory_order_relaxed);
+        RunScope scope{*this};
+
+        const auto frame_begin = Clock::now();
+        const std::tuple<ArgTypes...> args{Args...};
+        task_impl::TaskError error;
+        auto execute = [this, &args, &error](const std::uint32_t N) {
+            const auto begin = Clock::now();
+            if(nodes_[N].task && !removed_[N].load(std::memory_order_acquire)) {
+                EGEG_PROFILE_SCOPE(nodes_[N].desc.name);
+                error.invoke(nodes_[N].task, args);
+            }
+            nodes_[N].duration = Clock::now() - begin;
+        };
+        for(size_t w=0; w+1U<wave_offsets_.size(); ++w) {
+            JobCounter counter;
+            for(auto i=wave_offsets_[w]; i<wave_offsets_[w+1U]; ++i)
+                if(nodes_[order_[i]].desc.affinity == TaskAffinity::kAnyThread)
+                    Jobs.run([&execute, n=order_[i]]() { execute(n); }, &counter);
+            for(auto i=wave_offsets_[w]; i<wave_offsets_[w+1U]; ++i)
+                if(nodes_[order_[i]].desc.affinity == TaskAffinity::kMainThread)
+                    execute(order_[i]);
+            Jobs.wait(counter);
+            error.rethrow();
+        }
+        stats_.elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - frame_begin);
+        updateStats();
+    }
+
+    /// 最後に実行したフレームの統計
+    const TaskGraphStats& stats() const noexcept { return stats_; }
+    /// 登録されているタスク数
+    size_t size() const noexcept { return nodes_.size() - num_removed_ + deferred_.size(); }
+
+private :
+    struct Node {
+        TaskType task;
+        TaskDesc desc;
+        TaskID id;
+        std::chrono::nanoseconds duration;
+    };
+    // 実行中の状態の設定と、終了時の登録、解除の反映(例外送出時も反映する)
+    struct RunScope {
+        explicit RunScope(TaskGraph& Graph) noexcept : graph{Graph} { graph.running_ = true; }
+        ~RunScope() {
+            graph.running_ = false;
+            graph.applyDeferred();
+        }
+        TaskGraph& graph;
+    };
+
+    // タスクを取り除く(末尾のタスクと入れ替える)
+    void erase(const typename std::unordered_map<TaskID, size_t>::iterator Found) {
+        const size_t slot = Found->second;
+        if(slot != nodes_.size()-1U) {
+            nodes_[slot] = std::move(nodes_.back());
+            slots_[nodes_[slot].id] = slot;
+        }
+        nodes_.pop_back();
+        slots_.erase(Found);
+        dirty_ = true;
+    }
+
+    // 実行中の登録、解除の反映
+    void applyDeferred() {
+        if(num_removed_) {
+            std::vector<TaskID> removed_ids;
+            for(size_t n=0; n<removed_.size(); ++n)
+                if(removed_[n].load(std::memory_order_relaxed)) removed_ids.push_back(nodes_[n].id);
+            for(auto id : removed_ids) erase(slots_.find(id));
+            num_removed_ = 0U;
+        }
+        for(auto& node : deferred_) {
+            slots_.emplace(node.id, nodes_.size());
+            nodes_.push_back(std::move(node));
+            dirty_ = true;
+        }
+        deferred_.clear();
+    }
+
+    // 各タスクの実行時間からクリティカルパスを求める
+    void updateStats() {
+        const size_t num_nodes = nodes_.size();
+        std::vector<std::chrono::nanoseconds> finish(num_nodes);
+        std::vector<std::uint32_t> longest_pred(num_nodes);
+        std::chrono::nanoseconds total{};
+        std::chrono::nanoseconds critical{};
+        std::uint32_t last = 0U;
+        for(auto n : order_) { // ウェーブ順なので先行タスクは処理済み
+            std::chrono::nanoseconds start{};
+            longest_pred[n] = n;
+            for(auto p=pred_offsets_[n]; p<pred_offsets_[n+1U]; ++p) {
+                if(finish[preds_[p]] > start) { start = finish[preds_[p]]; longest_pred[n] = preds_[p]; }
+            }
+            finish[n] = start + nodes_[n].duration;
+            total += nodes_[n].duration;
+            if(finish[n] >= critical) { critical = finish[n]; last = n; }
+        }
+
+        stats_.total_work = total;
+        stats_.critical_path = critical;
+        stats_.num_tasks = num_nodes;
+        stats_.num_waves = wave_offsets_.empty() ? 0U : wave_offsets_.size()-1U;
+        stats_.critical_tasks.clear();
+        if(num_nodes) {
+            for(auto n=last; ; n=longest_pred[n]) {
+                stats_.critical_tasks.push_back(nodes_[n].desc.name);
+                if(longest_pred[n] == n) break;
+            }
+            std::reverse(stats_.critical_tasks.begin(), stats_.critical_tasks.end());
+        }
+    }
+
+    std::vector<Node> nodes_;
+    std::unordered_map<TaskID, size_t> slots_;  // slots_[TaskID] = nodes_ の添え字
+    TaskID next_id_ = 0U;
+    bool dirty_ = false;
+
+  // 実行中の登録、解除
+    bool running_ = false;
+    std::mutex mutex_;                          // 実行中の登録、解除でのみ使用
+    std::vector<Node> deferred_;                // 実行中に登録されたタスク
+    std::vector<std::atomic<bool>> removed_;    // removed_[nodes_ の添え字] 実行中に解除されたか
+    size_t num_removed_ = 0U;
+
+  // コンパイル結果
+    std::vector<std::uint32_t> order_;          // ウェーブ順のタスク
+    std::vector<std::uint32_t> wave_offsets_;   // order_ 内の各ウェーブの範囲
+    std::vector<std::uint32_t> pred_offsets_;   // preds_ 内の各タスクの範囲
+    std::vector<std::uint32_t> preds_;          // 先行タスク
+
+    TaskGraphStats stats_;
+};
+
+} // namespace t_lib
+} // namespace easy_engine
+#endif // !INCLUDED_EGEG_TLIB_TASK_GRAPH_HEADER_
+// EOF
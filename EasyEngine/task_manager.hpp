@@ -1,31 +1,93 @@
 ///
 /// \file   task_manager.hpp
-/// \brief  ^XN}l[W[`wb_
+/// \brief  タスクマネージャー定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \note   TaskTyɂāAboolɕϊ\ł邱Ƃ\RZvgǉ悤Ƃ\n
-///         C++17 std::is_convertible_v<c> ł͈ÖٓIȕϊ肪łsSB\n
-///         C++20 ł́Astd::convertible_toɂ\B
+/// \note   TaskTyについて、boolに変換可能であることを表すコンセプトを追加しようとしたが\n
+///         C++17 std::is_convertible_v<…> では暗黙的な変換しか判定ができず不完全。\n
+///         C++20 では、std::convertible_toにより実現可能。
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/7/25
-///             - wb_ǉ
-///             - TaskManager<c> `
+///             - ヘッダ追加
+///             - TaskManager<…> 定義
 ///         - 2020/7/26
-///             - TaskTy ɊւRZvgǉ
-///             - Rgǉ
+///             - TaskTy に関するコンセプトを追加
+///             - コメント追加
+///         - 2026/10/19
+///             - TaskAffinity 定義
+///             - 同じ優先度のタスクを並列に実行する runParallel(…) 追加
+///             - TaskError を task_impl に移動(TaskGraph<…>と共有)
+///             - タスクの保持を優先度順の連続した配列に変更
+///             - TaskInfo を世代付きのハンドルに変更
+///             - 実行中の登録、解除を実行後に反映するよう変更
+///             - タスク名を追加し、プロファイラで計測するよう変更
+///             - TaskPriorityRange 定義
+///             - 優先度の範囲を指定して実行する runRange(…), runParallelRange(…) 追加
+///             - 派生クラス用に、所有しないハンドル(TaskHandle)による解除を追加
+///             - 派生クラス用に、自身のハンドルを持つタスクの登録 registerTaskWithHandle(…) を追加
 ///
 #ifndef INCLUDED_EGEG_TLIB_TASK_MANAGER_HEADER_
 #define INCLUDED_EGEG_TLIB_TASK_MANAGER_HEADER_
 
 #include <cstdint>
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <tuple>
 #include <type_traits>
+#include <utility>
+#include <vector>
 #include "noncopyable.hpp"
 #include "event_container.hpp"
+#include "job_system.hpp"
+#include "profiler.hpp"
 
 namespace easy_engine {
 namespace t_lib {
+
+///
+/// \brief  タスクを実行するスレッドの指定
+///
+///         TaskManager::runParallel(…)で実行した場合にのみ意味を持ちます。
+///
+enum class TaskAffinity {
+    kAnyThread,  ///< 任意のスレッド
+    kMainThread, ///< runParallel(…)を呼び出したスレッド
+};
+
+///
+/// \brief  実行する優先度の範囲 [first, last]
+///
+///         TaskManager::runRange(…)等で使用します。
+///
+struct TaskPriorityRange {
+    uint32_t first = 0U;            ///< 最初に実行する優先度
+    uint32_t last = UINT32_MAX;     ///< 最後に実行する優先度(この値を含む)
+};
+
+  namespace task_impl {
+    // 並列実行中の例外の受け渡し
+    //  最初に送出された例外のみ保持する
+    class TaskError {
+    public :
+        template <class TaskTy, class TupleTy>
+        void invoke(TaskTy& Task, const TupleTy& Args) noexcept {
+            try { std::apply(Task, Args); }
+            catch(...) {
+                std::lock_guard<std::mutex> lock{mutex_};
+                if(!error_) error_ = std::current_exception();
+            }
+        }
+        void rethrow() {
+            if(error_) std::rethrow_exception(std::exchange(error_, nullptr));
+        }
+    private :
+        std::mutex mutex_;
+        std::exception_ptr error_;
+    };
+  } // namespace task_impl
     
 /******************************************************************************
 
@@ -34,17 +96,17 @@ namespace t_lib {
 ******************************************************************************/
 //
 /// \class  TaskManager
-/// \brief  ^XN}l[W[
+/// \brief  タスクマネージャー
 ///
-///         ob`T|[g܂B
-///         ^XN͗DxɂXPW[OADx͏قǍAɌĂяo܂B
+///         バッチ処理をサポートします。
+///         タスクは優先度によりスケジューリングされ、優先度は小さいほど高く、先に呼び出されます。
 ///
-/// \tparam TaskTy : o^^XŇ^
-/// \tparam DefaultPriority : ftHgŐݒ肷Dx
+/// \tparam TaskTy : 登録するタスクの型
+/// \tparam DefaultPriority : デフォルトで設定する優先度
 ///
-/// \details TaskTy ̓t@N^^A߂l^(^Xg) ̌`Ŏw肵܂B
+/// \details TaskTy はファンクタ型か、戻り値型(引数型リスト) の形で指定します。
 ///
-/// \attention TaskTy boolɕϊ\(ÖفAI킸)łKv܂B
+/// \attention TaskTy はboolに変換可能(暗黙、明示的問わず)である必要があります。
 ///
 template <class TaskTy, uint32_t DefaultPriority=0U>
 class TaskManager {
@@ -58,18 +120,19 @@ public :
     static_assert(std::is_move_assignable_v<TaskType>, "'TaskType' must be the movable type");
 
   // nested class
-    ///< ^XNo^
+    ///< タスク登録情報
     class TaskInfo final : Noncopyable<TaskInfo> {
     public :
         friend TaskManager;
 
         TaskInfo() = default;
-        TaskInfo(TaskInfo&& Right) noexcept : id_{Right.id_}, priority_{Right.priority_}, manager_{Right.manager_} {
+        TaskInfo(TaskInfo&& Right) noexcept : slot_{Right.slot_}, generation_{Right.generation_}, manager_{Right.manager_} {
             Right.manager_ = nullptr; 
         }
         TaskInfo& operator=(TaskInfo&& Right) noexcept {
-            id_ = Right.id_;
-            priority_ = Right.priority_;
+            exitFromManager();
+            slot_ = Right.slot_;
+            generation_ = Right.generation_;
             manager_ = Right.manager_;
             Right.manager_ = nullptr;
 
@@ -79,88 +142,395 @@ public :
         void exitFromManager() { if(manager_) manager_->unregisterTask(*this); }
 
     private :
-        TaskInfo(size_t ID,uint32_t Priority,TaskManager* Manager) : id_{ID}, priority_{Priority}, manager_{Manager} {}
-        size_t id_;
-        uint32_t priority_;
-        TaskManager* manager_;
+        TaskInfo(uint32_t Slot, uint32_t Generation, TaskManager* Manager) : slot_{Slot}, generation_{Generation}, manager_{Manager} {}
+        uint32_t slot_ = 0U;
+        uint32_t generation_ = 0U;
+        TaskManager* manager_ = nullptr;
     };
 
   // functions
     ///
-    /// \brief  ^XNo^
+    /// \brief  タスクを登録
     ///
-    ///         ^XN̗Dx͏قǍAɌĂяo܂B
-    ///         ߂l̃IuWFNg̓^XN̓o^ɕKvłB
-    ///         ܂AXR[v甲ƎŃ^XN̓o^̂ŁA
-    ///         Kvł΃oϐƂĕێȂǂāAXR[vL΂ĂB
+    ///         タスクの優先度は小さいほど高く、先に呼び出されます。
+    ///         戻り値のオブジェクトはタスクの登録解除に必要です。
+    ///         また、スコープから抜けると自動でタスクの登録を解除するので、
+    ///         必要であればメンバ変数として保持するなどして、スコープを伸ばしてください。
+    ///         同じ優先度のタスクの実行順は不定です。
+    ///         実行中(タスク内から)の登録は、その回の実行が終わった後に反映されます。
     ///
-    /// \tparam TaskTy_ : o^^XN^
-    /// \param[in] Task : o^^XN
-    /// \param[in] Priority : ^XN̗Dx
+    /// \tparam TaskTy_ : 登録するタスク型
+    /// \param[in] Task : 登録するタスク
+    /// \param[in] Priority : タスクの優先度
+    /// \param[in] Affinity : タスクを実行するスレッド(runParallel(…)でのみ有効)
+    /// \param[in] Name : タスク名(プロファイラで使用する 文字列リテラル等、登録中は有効な文字列)
     ///
-    /// \return ^XN̓o^
+    /// \return タスクの登録情報
     ///
     template <class TaskTy_>
-    [[nodiscard]] TaskInfo registerTask(TaskTy_&& Task, uint32_t Priority=DefaultPriority) {
-        return TaskInfo{insert(Priority, TaskType{std::forward<TaskTy_>(Task)}), Priority, this};
+    [[nodiscard]] TaskInfo registerTask(TaskTy_&& Task, uint32_t Priority=DefaultPriority,
+                                        TaskAffinity Affinity=TaskAffinity::kAnyThread, const char* Name="task") {
+        TaskType task{std::forward<TaskTy_>(Task)};
+        if(!static_cast<bool>(task)) return TaskInfo{}; // 空のタスクは保持しない
+        return registerTaskWithHandle([&task](TaskHandle) noexcept { return std::move(task); }, Priority, Affinity, Name);
     }
 
     ///
-    /// \brief  ^XN
+    /// \brief  タスクを解除
+    ///
+    ///         既に解除されたタスクの情報(世代の異なるハンドル)は無視します。
+    ///         実行中(タスク内から)解除したタスクは、以降呼び出されず、その回の実行が終わった後に取り除かれます。
     ///
-    /// \param[in] Info : ^XN̏(o^ɐ)
+    /// \attention runParallel(…)の実行中は、同じ優先度の他のタスクを解除しないでください。
+    ///
+    /// \param[in] Info : タスクの情報(登録時に生成される)
     ///
     void unregisterTask(TaskInfo& Info) {
-        tasks_[Info.priority_][Info.id_] = TaskType{};
-        indices_to_free_[Info.priority_].emplace(Info.id_);
+        std::unique_lock<std::mutex> lock{mutex_, std::defer_lock};
+        if(running_) lock.lock();
+
+        if(isRegistered(Info)) {
+            const uint32_t index = slots_[Info.slot_].index;
+            if(index & kDeferredBit) {
+                Node& node = deferred_[index & ~kDeferredBit].node;
+                node.task = TaskType{};
+                node.slot = kInvalidSlot;
+                --num_deferred_;
+            }
+            else if(running_) {
+                nodes_[index].slot = kInvalidSlot; // 実行中のタスク自身である可能性があるため、破棄は実行後
+                ++num_removed_;
+            }
+            else {
+                erase(index);
+            }
 
+            Slot& slot = slots_[Info.slot_];
+            ++slot.generation;
+            slot.index = free_slot_;
+            free_slot_ = Info.slot_;
+        }
         Info.manager_ = nullptr;
     }
 
     ///
-    /// \brief  ێĂS^XNs
+    /// \brief  タスクが登録されているか判定
+    ///
+    /// \param[in] Info : タスクの情報
+    ///
+    /// \return true : 登録されている　false : 解除済み、または別のマネージャーのタスク
+    ///
+    bool isRegistered(const TaskInfo& Info) const noexcept {
+        return Info.manager_ == this && Info.slot_ < slots_.size() &&
+               slots_[Info.slot_].generation == Info.generation_;
+    }
+
+    /// 登録されているタスク数
+    size_t size() const noexcept { return nodes_.size() - num_removed_ + num_deferred_; }
+
     ///
-    ///         s^XN͕ێ܂B
-    ///         Kv΁AunregisterTask(c)ĂяoĉB
+    /// \brief  保持している全タスクを実行
     ///
-    /// \tparam ArgTypes : s^XNɓn^Xg
-    /// \param[in] Args  : s^XNɓnXg
+    ///         実行後もタスクは保持されます。
+    ///         解除する必要があれば、unregisterTask(…)を呼び出して下さい。
     ///
-    /// \note S]ĂȂŔǍĂяoɓnKv邩B(moveɂsh)
+    /// \tparam ArgTypes : 実行するタスクに渡す引数型リスト
+    /// \param[in] Args  : 実行するタスクに渡す引数リスト
+    ///
+    /// \note 引数を完全転送していない理由は、複数の呼び出しに渡す必要があるから。(moveによる不具合を防ぐ)
     ///
     template <class ...ArgTypes>
     void run(ArgTypes ...Args) {
-        for(auto& container : tasks_)
-          for(auto& task : container.second)
-            if(task) task(Args...);
+        runRange(TaskPriorityRange{}, Args...);
+    }
+
+    ///
+    /// \brief  優先度の範囲を指定してタスクを実行
+    ///
+    ///         範囲内の優先度のタスクのみを実行します。
+    ///         実行中の登録、解除は、この関数が終わった時点で反映されます。
+    ///
+    /// \tparam ArgTypes : 実行するタスクに渡す引数型リスト
+    /// \param[in] Range : 実行する優先度の範囲
+    /// \param[in] Args  : 実行するタスクに渡す引数リスト
+    ///
+    template <class ...ArgTypes>
+    void runRange(const TaskPriorityRange& Range, ArgTypes ...Args) {
+        RunScope scope{*this};
+        const auto groups = findGroups(Range);
+        if(groups.first == groups.second) return;
+
+        EGEG_PROFILE_CHAIN(profile);
+        const uint32_t end = groupEnd(groups.second-1U);
+        for(uint32_t i=groups_[groups.first].begin; i<end; ++i)
+            if(nodes_[i].slot != kInvalidSlot) {
+                nodes_[i].task(Args...);
+                EGEG_PROFILE_CHAIN_MARK(profile, nodes_[i].name);
+            }
+    }
+
+    ///
+    /// \brief  保持している全タスクを並列に実行
+    ///
+    ///         優先度毎に、同じ優先度のタスクをジョブシステムで並列に実行します。
+    ///         ある優先度のタスクが全て完了してから、次の優先度のタスクを実行します。
+    ///         TaskAffinity::kMainThread で登録されたタスクは、この関数を呼び出したスレッドで実行します。
+    ///         タスクから送出された例外は、その優先度のタスクが全て完了した後に再送出します。(複数の場合は最初の1つ)
+    ///
+    /// \attention 同じ優先度のタスクは、互いに独立している必要があります。
+    ///
+    /// \tparam ArgTypes : 実行するタスクに渡す引数型リスト
+    /// \param[in] Jobs  : 使用するジョブシステム
+    /// \param[in] Args  : 実行するタスクに渡す引数リスト
+    ///
+    template <class ...ArgTypes>
+    void runParallel(JobSystem& Jobs, ArgTypes ...Args) {
+        runParallelRange(Jobs, TaskPriorityRange{}, Args...);
+    }
+
+    ///
+    /// \brief  優先度の範囲を指定してタスクを並列に実行
+    ///
+    ///         範囲内の優先度のタスクのみを、runParallel(…)と同様に実行します。
+    ///
+    /// \tparam ArgTypes : 実行するタスクに渡す引数型リスト
+    /// \param[in] Jobs  : 使用するジョブシステム
+    /// \param[in] Range : 実行する優先度の範囲
+    /// \param[in] Args  : 実行するタスクに渡す引数リスト
+    ///
+    template <class ...ArgTypes>
+    void runParallelRange(JobSystem& Jobs, const TaskPriorityRange& Range, ArgTypes ...Args) {
+        RunScope scope{*this};
+        const std::tuple<ArgTypes...> args{Args...};
+        task_impl::TaskError error;
+        const auto groups = findGroups(Range);
+        for(size_t group=groups.first; group<groups.second; ++group) {
+            const size_t group_begin = groups_[group].begin;
+            const size_t group_end = groupEnd(group);
+            const size_t grain = std::max<size_t>(1U, (group_end-group_begin)/(Jobs.numThreads()*kJobsPerThread));
+
+            JobCounter counter;
+            for(size_t begin=group_begin; begin<group_end; begin+=grain) {
+                const size_t end = std::min(begin+grain, group_end);
+                Jobs.run([this, &args, &error, begin, end]() {
+                    EGEG_PROFILE_CHAIN(profile);
+                    for(size_t i=begin; i<end; ++i)
+                        if(nodes_[i].affinity == TaskAffinity::kAnyThread && nodes_[i].slot != kInvalidSlot) {
+                            error.invoke(nodes_[i].task, args);
+                            EGEG_PROFILE_CHAIN_MARK(profile, nodes_[i].name);
+                        }
+                }, &counter);
+            }
+            for(size_t i=group_begin; i<group_end; ++i)
+                if(nodes_[i].affinity == TaskAffinity::kMainThread && nodes_[i].slot != kInvalidSlot) {
+                    EGEG_PROFILE_SCOPE(nodes_[i].name);
+                    error.invoke(nodes_[i].task, args);
+                }
+            Jobs.wait(counter);
+            error.rethrow();
+        }
+    }
+
+protected :
+    ///
+    /// \brief  タスクを所有しないハンドル
+    ///
+    ///         タスク自身が自分の登録を解除する場合に使用します。(TaskInfo を持つと所有が循環するため。)
+    ///         破棄しても登録は解除されません。
+    ///
+    struct TaskHandle {
+        uint32_t slot = kInvalidSlot;
+        uint32_t generation = 0U;
+    };
+
+    ///
+    /// \brief  ハンドルによりタスクを解除
+    ///
+    ///         unregisterTask(…)と同様です。既に解除されたタスクのハンドルは無視します。
+    ///
+    void unregisterHandle(const TaskHandle Handle) {
+        TaskInfo info{Handle.slot, Handle.generation, this};
+        unregisterTask(info);
+    }
+
+    ///
+    /// \brief  自身のハンドルを持つタスクを登録
+    ///
+    ///         registerTask(…)と同様です。Factory に登録先のハンドルを渡してタスクを生成するため、
+    ///         タスクは自身のハンドルを内部に保持できます。
+    ///
+    /// \tparam FactoryTy : TaskHandle を受け取り、タスクを返す関数型(例外を送出しないこと)
+    ///
+    template <class FactoryTy>
+    [[nodiscard]] TaskInfo registerTaskWithHandle(FactoryTy&& Factory, const uint32_t Priority,
+                                                  const TaskAffinity Affinity, const char* const Name) {
+        static_assert(std::is_nothrow_invocable_v<FactoryTy&, TaskHandle>, "'FactoryTy' must not throw");
+        std::unique_lock<std::mutex> lock{mutex_, std::defer_lock};
+        if(running_) lock.lock();
+
+        const uint32_t slot = allocateSlot();
+        TaskType task{Factory(TaskHandle{slot, slots_[slot].generation})};
+        if(running_) {
+            slots_[slot].index = static_cast<uint32_t>(deferred_.size()) | kDeferredBit;
+            deferred_.push_back(Deferred{Priority, Node{std::move(task), Name, Affinity, slot}});
+            ++num_deferred_;
+        }
+        else {
+            insert(Priority, Node{std::move(task), Name, Affinity, slot});
+        }
+        return TaskInfo{slot, slots_[slot].generation, this};
     }
 
 private :
+    static constexpr size_t kJobsPerThread = 4U; // runParallel(…)で1スレッド当たりに割り当てるジョブ数の目安
+    static constexpr uint32_t kInvalidSlot = 0xFFFFFFFFU;   // 解除済みのタスク
+    static constexpr uint32_t kDeferredBit = 0x80000000U;   // Slot::index が deferred_ を指すことを表す
+
+    // nodes_ の要素
+    struct Node {
+        TaskType task;
+        const char* name;
+        TaskAffinity affinity;
+        uint32_t slot;
+    };
+    // 実行中に登録されたタスク
+    struct Deferred {
+        uint32_t priority;
+        Node node;
+    };
+    // 実行中の状態の設定と、終了時の登録、解除の反映(例外送出時も反映する)
+    struct RunScope {
+        explicit RunScope(TaskManager& Manager) noexcept : manager{Manager} { manager.running_ = true; }
+        ~RunScope() {
+            manager.running_ = false;
+            manager.applyDeferred();
+        }
+        TaskManager& manager;
+    };
+    // 同じ優先度のタスクの範囲 [begin, 次のグループの begin)
+    struct Group {
+        uint32_t priority;
+        uint32_t begin;
+    };
+    // TaskInfo からタスクへの参照
+    //  使用中は nodes_ の添え字、未使用時は次の未使用スロット
+    struct Slot {
+        uint32_t index;
+        uint32_t generation;
+    };
+
+    // 範囲内の優先度のグループ [first, second)
+    std::pair<size_t, size_t> findGroups(const TaskPriorityRange& Range) const noexcept {
+        const auto first = std::lower_bound(groups_.begin(), groups_.end(), Range.first,
+                                            [](const Group& G, uint32_t P) { return G.priority < P; });
+        const auto last = std::upper_bound(first, groups_.end(), Range.last,
+                                           [](uint32_t P, const Group& G) { return P < G.priority; });
+        return {static_cast<size_t>(first-groups_.begin()), static_cast<size_t>(last-groups_.begin())};
+    }
+    uint32_t groupEnd(const size_t Group) const noexcept {
+        return Group+1U < groups_.size() ? groups_[Group+1U].begin : static_cast<uint32_t>(nodes_.size());
+    }
+    // 要素を移動して、スロットの参照先を更新
+    void relocate(const uint32_t From, const uint32_t To) {
+        nodes_[To] = std::move(nodes_[From]);
+        slots_[nodes_[To].slot].index = To;
+    }
+
+    uint32_t allocateSlot() {
+        if(free_slot_ != kInvalidSlot) {
+            const uint32_t slot = free_slot_;
+            free_slot_ = slots_[slot].index;
+            return slot;
+        }
+        slots_.push_back(Slot{0U, 0U});
+        return static_cast<uint32_t>(slots_.size()-1U);
+    }
+
     ///
-    /// \brief  }
+    /// \brief  挿入
     ///
-    ///         ߂l͑}ʒu
-    ///         TaskInfoIDƂĎgp
+    ///         後続の各グループの先頭要素をグループの末尾へ移して、空きを優先度のグループの末尾まで運びます。
+    ///         移動する要素数は後続のグループ数です。
     ///
-    size_t insert(uint32_t Priority, TaskType&& Task) {
-        auto& container = tasks_[Priority];
+    void insert(const uint32_t Priority, Node&& Task) {
+        auto found = std::lower_bound(groups_.begin(), groups_.end(), Priority,
+                                      [](const Group& G, uint32_t P) { return G.priority < P; });
+        if(found == groups_.end() || found->priority != Priority) {
+            const uint32_t begin = found==groups_.end() ? static_cast<uint32_t>(nodes_.size()) : found->begin;
+            found = groups_.insert(found, Group{Priority, begin});
+        }
+        const size_t group = found - groups_.begin();
 
-      // 󂫗̈ɑ}
-        if(auto free_stack=indices_to_free_.find(Priority); free_stack!=indices_to_free_.end() &&
-           free_stack->second.size()) {
-            size_t idx_to_free = free_stack->second.top();
-            container[idx_to_free] = std::move(Task);
-            free_stack->second.pop();
-            return idx_to_free;
+        uint32_t hole = static_cast<uint32_t>(nodes_.size());
+        nodes_.emplace_back();
+        for(size_t g=groups_.size()-1U; g>group; --g) {
+            if(groups_[g].begin != hole) relocate(groups_[g].begin, hole);
+            hole = groups_[g].begin++;
         }
+        nodes_[hole] = std::move(Task);
+        slots_[nodes_[hole].slot].index = hole;
+    }
 
-      // ɑ}
-        container.emplace_back(std::move(Task));
-        return container.size()-1;
+    ///
+    /// \brief  削除
+    ///
+    ///         グループの末尾要素で穴を埋め、後続の各グループの末尾要素を1つ前へ詰めます。
+    ///
+    void erase(const uint32_t Index) {
+        const size_t group = std::upper_bound(groups_.begin(), groups_.end(), Index,
+                                              [](uint32_t I, const Group& G) { return I < G.begin; }) - groups_.begin() - 1U;
+        uint32_t hole = Index;
+        for(size_t g=group; g<groups_.size(); ++g) {
+            const uint32_t last = groupEnd(g) - 1U;
+            if(last != hole) relocate(last, hole);
+            hole = last;
+            if(g != group) --groups_[g].begin;
+        }
+        nodes_.pop_back();
+        if(groupEnd(group) == groups_[group].begin) groups_.erase(groups_.begin()+group);
     }
-    
-    std::map<uint32_t, EventVector<TaskType>> tasks_;        // tasks_[Priority][Task]
-    std::map<uint32_t, std::stack<size_t>> indices_to_free_; // indices_to_free_[Priority]
+
+    ///
+    /// \brief  実行中の登録、解除の反映
+    ///
+    ///         解除されたタスクを1回の走査で詰めてから、登録されたタスクを挿入します。
+    ///
+    void applyDeferred() {
+        if(num_removed_) {
+            uint32_t live = 0U;
+            for(size_t g=0; g<groups_.size(); ++g) {
+                const uint32_t begin = groups_[g].begin;
+                const uint32_t end = groupEnd(g);
+                groups_[g].begin = live;
+                for(uint32_t i=begin; i<end; ++i) {
+                    if(nodes_[i].slot == kInvalidSlot) continue;
+                    if(i != live) relocate(i, live);
+                    ++live;
+                }
+            }
+            nodes_.erase(nodes_.begin()+live, nodes_.end());
+            for(size_t g=groups_.size(); g-->0U;)
+                if(groupEnd(g) == groups_[g].begin) groups_.erase(groups_.begin()+g);
+            num_removed_ = 0U;
+        }
+
+        for(auto& deferred : deferred_)
+            if(deferred.node.slot != kInvalidSlot) insert(deferred.priority, std::move(deferred.node));
+        deferred_.clear();
+        num_deferred_ = 0U;
+    }
+
+    std::vector<Node> nodes_;       // 登録されているタスク(優先度順)
+    std::vector<Group> groups_;     // 優先度毎の nodes_ 内の範囲(優先度順)
+    std::vector<Slot> slots_;
+    uint32_t free_slot_ = kInvalidSlot;
+
+  // 実行中の登録、解除
+    bool running_ = false;
+    std::mutex mutex_;              // 実行中の登録、解除でのみ使用
+    std::vector<Deferred> deferred_;
+    size_t num_deferred_ = 0U;      // deferred_ 内の解除されていないタスク数
+    size_t num_removed_ = 0U;       // nodes_ 内の解除済みのタスク数
 };
 
 } // namespace t_lib
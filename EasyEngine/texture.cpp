@@ -1,4 +1,4 @@
-// 쐬 : 
+// 作成者 : 板場
 /******************************************************************************
 
     include
@@ -22,11 +22,11 @@ namespace tex_ns = easy_engine::g_lib;
 
 ******************************************************************************/
 tex_ns::Texture::Texture(const char* FilePath) {
-    // 摜t@Cǂݍ
-    //  c X c
-    // eNX`쐬
+    // 画像ファイル読み込み
+    //  … 後々 …
+    // テクスチャ作成
     //  d3dDevice->CreateTexture2D(&desc, image_data, &tex);
-    // r[쐬
+    // ビュー作成
     //  d3dDevice->CreateShaderResourceView(tex, nullptr, &srv);
 }
 // EOF
@@ -1,13 +1,13 @@
 //
 /// \file   texture.hpp
-/// \brief  eNX``wb_
+/// \brief  テクスチャ定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/8/24
-///             - wb_ǉ
-///             - Texture `
+///             - ヘッダ追加
+///             - Texture 定義
 ///
 #ifndef INCLUDED_EGEG_GLIB_TEXTURE_HEADER_
 #define INCLUDED_EGEG_GLIB_TEXTURE_HEADER_
@@ -23,15 +23,15 @@ namespace g_lib {
 
 ******************************************************************************/
 ///
-/// \brief  eNX`(VF[_[\[X)
+/// \brief  テクスチャ(シェーダーリソース)
 ///
-///         RXgN^Ŏw肵摜t@CeNX`Ƃĕێ܂B
-///         t@Cw肵ăRXgN^ĂяoꍇAǂݍݏ܂B
+///         コンストラクタで指定した画像ファイルをテクスチャとして保持します。
+///         ファイル名を指定してコンストラクタを呼び出した場合、読み込み処理が発生します。
 ///
-/// \par    ǂݍ݂xꍇ
-///         - ftHgRXgN^ō\zeNX`ɑ
+/// \par    読み込みを遅延させたい場合
+///         - デフォルトコンストラクタで構築したテクスチャに代入
 ///           Texture texture{};
-///             c
+///             …
 ///           texture = Texture{"hogehoge.png"};
 ///
 class Texture : public TextureResource {
@@ -40,24 +40,24 @@ public :
     virtual ~Texture() = default;
     
     ///
-    /// \brief  ǂݍ݂𔺂\z
+    /// \brief  読み込みを伴う構築
     ///
-    /// \param[in] FilePath : ǂݍމ摜̃t@CpX
+    /// \param[in] FilePath : 読み込む画像のファイルパス
     ///
     Texture(const char* FilePath);
 
     ///
-    /// \brief  LȃeNX`ǂ
+    /// \brief  有効なテクスチャかどうか判定
     ///
-    ///         true  : L
-    ///         false : 
+    ///         true  : 有効
+    ///         false : 無効
     ///
-    /// \return 茋
+    /// \return 判定結果
     ///
     bool isValid() const noexcept { return TextureResource::isValid() && texture_; }
     operator bool() const noexcept { return isValid(); }
 
-    /// eNX`擾
+    /// テクスチャを取得
     ID3D11ShaderResourceView* texture() const noexcept { return texture_.Get(); }
 protected :
     Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> texture_;
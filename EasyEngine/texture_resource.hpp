@@ -1,13 +1,13 @@
 ///
 /// \file   texture_resource.hpp
-/// \brief  eNX`\[X`wb_
+/// \brief  テクスチャリソース定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/9/2
-///             - wb_ǉ
-///             - TextureResource `
+///             - ヘッダ追加
+///             - TextureResource 定義
 ///
 #ifndef INCLUDED_EGEG_GLIB_TEXTURE_RESOURCE_HEADER_
 #define INCLUDED_EGEG_GLIB_TEXTURE_RESOURCE_HEADER_
@@ -24,41 +24,41 @@ namespace g_lib {
 
 ******************************************************************************/
 ///
-/// \brief  eNX`\[X
+/// \brief  テクスチャリソース
 ///
 class TextureResource {
 public :
     virtual ~TextureResource() = default;
 
     ///
-    /// \brief  ftHg̃RXgN^
+    /// \brief  デフォルトのコンストラクタ
     ///
-    ///         eNX`͍쐬܂B
+    ///         テクスチャは作成しません。
     ///
     TextureResource() = default;
 
     ///
-    /// \brief  eNX`̍쐬𔺂RXgN^
+    /// \brief  テクスチャの作成を伴うコンストラクタ
     ///
-    /// \param[in] eNX`̒`
-    /// \param[in] eNX`̏f[^(ȗŏf[^Ȃ)
+    /// \param[in] テクスチャの定義
+    /// \param[in] テクスチャの初期データ(省略で初期データなし)
     ///
     TextureResource(const D3D11_TEXTURE2D_DESC&, const D3D11_SUBRESOURCE_DATA&);
     TextureResource(const D3D11_TEXTURE2D_DESC&);
 
     ///
-    /// \brief  LȃeNX`\[Xǂ
+    /// \brief  有効なテクスチャリソースかどうか判定
     ///
-    ///         true  : L
-    ///         false : 
+    ///         true  : 有効
+    ///         false : 無効
     ///
-    /// \return 茋
+    /// \return 判定結果
     ///
     bool isValid() const noexcept { return resource_; }
     operator bool() const noexcept { return isValid(); }
 
 
-    /// \[X擾
+    /// リソースを取得
     ID3D11Texture2D* resource() const noexcept { return resource_.Get(); }
 protected :
     Microsoft::WRL::ComPtr<ID3D11Texture2D> resource_;
@@ -1,29 +1,32 @@
 ///
 /// \file   time.hpp
-/// \brief  Ԋ֌WNX`wb_
+/// \brief  時間関係クラス定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/8/20
-///             - wb_ǉ
-///             - Time `
-///             - Clock `
+///             - ヘッダ追加
+///             - Time 定義
+///             - Clock 定義
+///         - 2026/10/19
+///             - MSVC 以外のコンパイラに対応
 ///
 #ifndef INCLUDED_EGEG_TIME_HEADER_
 #define INCLUDED_EGEG_TIME_HEADER_
 
 #include <chrono>
+#include <type_traits>
 
 namespace easy_engine {
 
-using ClockUsed = std::chrono::high_resolution_clock; ///< gpĂ鎞ԌvpNX
-using Nanoseconds  = std::chrono::nanoseconds;  ///< ԒPʁuimb(1/1000}CNb)v
-using Microseconds = std::chrono::microseconds; ///< ԒPʁu}CNb(1/1000~b)v
-using Milliseconds = std::chrono::milliseconds; ///< ԒPʁu~b(1/1000b)v
-using Seconds      = std::chrono::seconds;      ///< ԒPʁubv
-using Minutes      = std::chrono::minutes;      ///< ԒPʁuv
-using Hours        = std::chrono::hours;        ///< ԒPʁuv
+using ClockUsed = std::chrono::high_resolution_clock; ///< 使用している時間計測用クラス
+using Nanoseconds  = std::chrono::nanoseconds;  ///< 時間単位「ナノ秒(1/1000マイクロ秒)」
+using Microseconds = std::chrono::microseconds; ///< 時間単位「マイクロ秒(1/1000ミリ秒)」
+using Milliseconds = std::chrono::milliseconds; ///< 時間単位「ミリ秒(1/1000秒)」
+using Seconds      = std::chrono::seconds;      ///< 時間単位「秒」
+using Minutes      = std::chrono::minutes;      ///< 時間単位「分」
+using Hours        = std::chrono::hours;        ///< 時間単位「時」
 
 /******************************************************************************
 
@@ -31,10 +34,10 @@ using Hours        = std::chrono::hours;        ///< 
 
 ******************************************************************************/
 ///
-/// \brief  ԕێpRei
+/// \brief  時間保持用コンテナ
 ///
-///         ɂ́ALԒPʃNXp܂B
-///         .) Time time = Seconds{10}; // time 10bZbg
+///         初期化には、上記時間単位クラスを用います。
+///         例.) Time time = Seconds{10}; // time に10秒をセット
 ///
 class Time {
 public :
@@ -103,11 +106,8 @@ public :
 private :
     template <class DurationTy>
     DurationTy cast() const noexcept {
-        return std::chrono::duration_cast<DurationTy>(time_);
-    }
-    template <>
-    Duration cast<Duration>() const noexcept {
-        return time_;
+        if constexpr(std::is_same_v<DurationTy, Duration>) return time_;
+        else return std::chrono::duration_cast<DurationTy>(time_);
     }
 
     Duration time_{};
@@ -134,17 +134,17 @@ public :
 
 ******************************************************************************/
 ///
-/// \brief  ԌvNX
+/// \brief  時間計測クラス
 ///
-///         ɍŐV̎ԂNXł͂܂B
-///         update()ЂƂ̋؂ƂĂ܂B
+///         常に最新の時間を見るクラスではありません。
+///         update()をひとつの区切りとしています。
 ///
 class Clock {
 public :
     ///
-    /// \brief  RXgN^
+    /// \brief  コンストラクタ
     ///
-    ///         ԌvJn܂B
+    ///         時間計測を開始します。
     ///
     Clock() noexcept :
         start_{ClockUsed::now()},
@@ -153,7 +153,7 @@ public :
         elapsed_{} {}
 
     ///
-    /// \brief  XV
+    /// \brief  更新
     ///
     void update() noexcept(
       noexcept(delta_=ClockUsed::now()-last_point_)&&
@@ -166,21 +166,21 @@ public :
     }
 
     ///
-    /// \brief  vJn
+    /// \brief  計測開始時間
     ///
     ClockUsed::time_point started() const noexcept {
         return start_;
     }
 
     ///
-    /// \brief  ߂̍XVƁÂЂƂO̍XVƂ̎ԍ
+    /// \brief  直近の更新と、そのひとつ前の更新との時間差
     ///
     Time delta() const noexcept {
         return Time{delta_};
     }
 
     ///
-    /// \brief  vJnA߂̍XV܂ł̌oߎ
+    /// \brief  計測開始から、直近の更新までの経過時間
     ///
     Time elapsed() const noexcept {
         return Time{elapsed_};
@@ -0,0 +1,221 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include "timer_wheel.hpp"
+#include <algorithm>
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace egeg_ns = easy_engine;
+namespace {
+    constexpr uint32_t kChunkShift = 10U;   // 1ブロック当たり 1024ノード
+    constexpr uint32_t kChunkMask = (1U << kChunkShift) - 1U;
+    constexpr uint64_t kMaxDelta = UINT32_MAX; // 最上段のホイールが表せる最大のティック数
+} // unnamed namespace
+
+struct egeg_ns::TimerWheel::Node {
+    Callback callback;
+    uint64_t expire = 0U;       // 満了するティック
+    uint64_t period = 0U;       // 繰り返しの周期(ティック) 0で1回のみ
+    uint32_t prev = kNil;
+    uint32_t next = kNil;
+    uint32_t list = kNil;       // 所属するリスト kNil でリストに属していない
+    uint32_t generation = 0U;
+    bool running = false;       // 呼び出し中
+    bool cancelled = false;     // 呼び出し中に取り消された
+};
+
+
+/******************************************************************************
+
+    TimerWheel::
+
+******************************************************************************/
+egeg_ns::TimerWheel::TimerWheel(const Time Resolution) :
+    resolution_{std::max<int64_t>(Resolution.nanoseconds(), 1)},
+    current_{1U} { // ティック0は処理済みとして扱う
+    std::fill(std::begin(heads_), std::end(heads_), kNil);
+    std::fill(std::begin(tails_), std::end(tails_), kNil);
+}
+
+egeg_ns::TimerWheel::~TimerWheel() = default;
+
+egeg_ns::TimerID egeg_ns::TimerWheel::schedule(const Time Delay, Callback Function, const Time Period) {
+    const auto toTicks = [this](const Time Duration) -> uint64_t { // 切り上げ
+        const int64_t ns = Duration.nanoseconds();
+        return ns <= 0 ? 0U : static_cast<uint64_t>((ns+resolution_-1) / resolution_);
+    };
+
+    const uint32_t index = allocate();
+    Node& n = node(index);
+    n.callback = std::move(Function);
+    n.expire = std::max(current_-1U+toTicks(Delay), current_);
+    n.period = Period > Time{} ? std::max<uint64_t>(toTicks(Period), 1U) : 0U;
+    n.cancelled = false;
+    insert(index);
+    ++size_;
+    return TimerID{index, n.generation};
+}
+
+bool egeg_ns::TimerWheel::cancel(const TimerID ID) noexcept {
+    if(!isPending(ID)) return false;
+
+    Node& n = node(ID.index);
+    if(n.running) { // 呼び出し中の関数は破棄できないので、呼び出し後に解放する
+        n.cancelled = true;
+        return true;
+    }
+    unlink(ID.index);
+    release(ID.index);
+    return true;
+}
+
+bool egeg_ns::TimerWheel::isPending(const TimerID ID) const noexcept {
+    if(ID.index >= capacity_) return false;
+    const Node& n = node(ID.index);
+    return n.generation == ID.generation && (n.list != kNil || n.running) && !n.cancelled;
+}
+
+egeg_ns::Time egeg_ns::TimerWheel::remaining(const TimerID ID) const noexcept {
+    if(!isPending(ID)) return Time{};
+    const Node& n = node(ID.index);
+    const uint64_t now = current_ - 1U;
+    const uint64_t expire = n.running ? n.expire+n.period : n.expire;
+    return Nanoseconds{static_cast<int64_t>(expire > now ? expire-now : 0U) * resolution_};
+}
+
+void egeg_ns::TimerWheel::advance(const Time Elapsed) {
+    expire(); // 前回、例外により中断した呼び出しの残り
+
+    elapsed_ += std::max<int64_t>(Elapsed.nanoseconds(), 0);
+    const uint64_t target = static_cast<uint64_t>(elapsed_ / resolution_);
+    if(size_ == 0U) { // 空の場合は走査を省略
+        current_ = std::max(current_, target+1U);
+        return;
+    }
+    while(current_ <= target) {
+        const uint64_t tick = current_;
+
+      // 上段のホイールから、次の周回分のタイマーを下段に移す
+        if((tick & (kNumSlots-1U)) == 0U) {
+            for(uint32_t level = 1U; level < kNumLevels; ++level) {
+                const uint32_t slot = static_cast<uint32_t>(tick >> (kLevelBits*level)) & (kNumSlots-1U);
+                const uint32_t list = level*kNumSlots + slot;
+                uint32_t index = std::exchange(heads_[list], kNil);
+                tails_[list] = kNil;
+                while(index != kNil) {
+                    const uint32_t next = node(index).next;
+                    node(index).list = kNil;
+                    insert(index);
+                    index = next;
+                }
+                if(slot != 0U) break;
+            }
+        }
+
+      // 満了したスロットを呼び出し待ちのリストに移す
+        ++current_; // 以降、呼び出し中に登録されたタイマーは次のティック以降に満了する
+        uint32_t& head = heads_[tick & (kNumSlots-1U)];
+        if(head == kNil) continue;
+        for(uint32_t index = head; index != kNil; index = node(index).next)
+            node(index).list = kExpiringList;
+        heads_[kExpiringList] = std::exchange(head, kNil);
+        tails_[kExpiringList] = std::exchange(tails_[tick & (kNumSlots-1U)], kNil);
+        expire();
+    }
+}
+
+egeg_ns::TimerWheel::Node& egeg_ns::TimerWheel::node(const uint32_t Index) const noexcept {
+    return chunks_[Index >> kChunkShift][Index & kChunkMask];
+}
+
+uint32_t egeg_ns::TimerWheel::allocate() {
+    if(free_ == kNil) {
+        chunks_.emplace_back(new Node[kChunkMask+1U]);
+        for(uint32_t i = kChunkMask+1U; i-- > 0U;) {
+            chunks_.back()[i].next = free_;
+            free_ = capacity_ + i;
+        }
+        capacity_ += kChunkMask+1U;
+    }
+    const uint32_t index = free_;
+    free_ = node(index).next;
+    return index;
+}
+
+void egeg_ns::TimerWheel::release(const uint32_t Index) noexcept {
+    Node& n = node(Index);
+    n.callback = nullptr;
+    n.running = false;
+    n.cancelled = false;
+    ++n.generation;
+    n.next = free_;
+    free_ = Index;
+    --size_;
+}
+
+// 満了までのティック数に応じた段のスロットに登録する
+//  段 L のスロットは、満了時刻の L段目の桁が一致する周回の先頭で下段に移される
+void egeg_ns::TimerWheel::insert(const uint32_t Index) noexcept {
+    const Node& n = node(Index);
+    const uint64_t delta = std::min(std::max(n.expire, current_)-current_, kMaxDelta);
+    const uint64_t tick = current_ + delta; // 最上段を超える場合は、最上段の最後のスロットに置き、移す際に再計算する
+
+    uint32_t level = 0U;
+    while(level+1U < kNumLevels && delta >= (uint64_t{1} << (kLevelBits*(level+1U)))) ++level;
+    const uint32_t slot = static_cast<uint32_t>(tick >> (kLevelBits*level)) & (kNumSlots-1U);
+    link(Index, level*kNumSlots + slot);
+}
+
+void egeg_ns::TimerWheel::link(const uint32_t Index, const uint32_t List) noexcept {
+    Node& n = node(Index);
+    n.list = List;
+    n.prev = tails_[List];
+    n.next = kNil;
+    if(n.prev != kNil) node(n.prev).next = Index;
+    else               heads_[List] = Index;
+    tails_[List] = Index;
+}
+
+void egeg_ns::TimerWheel::unlink(const uint32_t Index) noexcept {
+    Node& n = node(Index);
+    if(n.prev != kNil) node(n.prev).next = n.next;
+    else               heads_[n.list] = n.next;
+    if(n.next != kNil) node(n.next).prev = n.prev;
+    else               tails_[n.list] = n.prev;
+    n.list = kNil;
+}
+
+// 呼び出し待ちのリストを先頭から呼び出す
+void egeg_ns::TimerWheel::expire() {
+    while(heads_[kExpiringList] != kNil) {
+        const uint32_t index = heads_[kExpiringList];
+        Node& n = node(index);
+        unlink(index);
+        n.running = true;
+        try {
+            n.callback();
+        }
+        catch(...) {
+            release(index);
+            throw;
+        }
+        n.running = false;
+        if(n.cancelled || n.period == 0U) {
+            release(index);
+        }
+        else {
+            n.expire += n.period;
+            insert(index);
+        }
+    }
+}
+
+// EOF
@@ -0,0 +1,150 @@
+///
+/// \file   timer_wheel.hpp
+/// \brief  タイマーホイール定義ヘッダ
+///
+/// \author 板場
+///
+/// \par    履歴
+///         - 2026/10/19
+///             - ヘッダ追加
+///             - TimerID 定義
+///             - TimerWheel 定義
+///
+#ifndef INCLUDED_EGEG_TIMER_WHEEL_HEADER_
+#define INCLUDED_EGEG_TIMER_WHEEL_HEADER_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "inplace_function.hpp"
+#include "noncopyable.hpp"
+#include "time.hpp"
+
+namespace easy_engine {
+
+/******************************************************************************
+
+    TimerID
+
+******************************************************************************/
+///
+/// \brief  タイマーの識別子
+///
+///         TimerWheel::schedule の戻り値です。タイマーの取り消しに使用します。
+///         タイマーが満了、または取り消された後は無効になります。(別のタイマーを指すことはありません。)
+///
+struct TimerID {
+    uint32_t index = UINT32_MAX;
+    uint32_t generation = 0U;
+};
+
+
+/******************************************************************************
+
+    TimerWheel
+
+******************************************************************************/
+///
+/// \brief  階層タイマーホイール
+///
+///         指定した時間の経過後に呼び出す関数(タイマー)を管理します。
+///         256スロットのホイールを4段重ねた構成で、登録と取り消しはタイマーの数に関わらず O(1) です。
+///         advance で時間を進めると、満了したスロットのタイマーのみをまとめて呼び出し、
+///         満了していないタイマーは走査しません。
+///
+///         時間は分解能(既定 1ms)単位のティックに切り上げて扱います。
+///         同じフレームで満了するタイマーは満了時刻順に呼び出します。
+///         繰り返しタイマーは、前回の満了時刻に周期を加えた時刻を次の満了時刻とするため、誤差が蓄積しません。
+///         1フレームで複数の周期が経過した場合は、周期の数だけ呼び出します。
+///
+///         タイマーの関数内から、タイマーの登録や取り消し(自身を含む)を行うことができます。
+///
+/// \attention スレッドセーフではありません。同じスレッドから操作してください。
+///
+class TimerWheel final : t_lib::Noncopyable<TimerWheel> {
+public :
+    using Callback = t_lib::InplaceFunction<void()>;
+
+    ///
+    /// \brief  コンストラクタ
+    ///
+    /// \param[in] Resolution : 分解能(1ティックの時間)
+    ///
+    explicit TimerWheel(Time Resolution=Milliseconds{1});
+    ~TimerWheel();
+
+    ///
+    /// \brief  タイマーを登録
+    ///
+    ///         Delay の経過後に Function を呼び出します。
+    ///         Period を指定すると、その後 Period 毎に繰り返し呼び出します。
+    ///
+    /// \param[in] Delay    : 最初に呼び出すまでの時間
+    /// \param[in] Function : 呼び出す関数
+    /// \param[in] Period   : 繰り返しの周期 Time{}で1回のみ
+    ///
+    /// \return タイマーの識別子
+    ///
+    TimerID schedule(Time Delay, Callback Function, Time Period=Time{});
+
+    ///
+    /// \brief  タイマーの取り消し
+    ///
+    ///         呼び出し中のタイマーを取り消した場合、関数は呼び出しの終了後に破棄します。
+    ///
+    /// \param[in] ID : 取り消すタイマー
+    ///
+    /// \return true : 取り消した  false : 既に満了、または取り消されている
+    ///
+    bool cancel(TimerID ID) noexcept;
+
+    /// タイマーが有効(満了、取り消し前)かどうか
+    bool isPending(TimerID ID) const noexcept;
+
+    /// 次に満了するまでの時間(無効なタイマーの場合は Time{})
+    Time remaining(TimerID ID) const noexcept;
+
+    ///
+    /// \brief  時間を進める
+    ///
+    ///         満了したタイマーの関数を呼び出します。
+    ///
+    /// \param[in] Elapsed : 進める時間
+    ///
+    void advance(Time Elapsed);
+
+    /// 有効なタイマーの数
+    size_t size() const noexcept { return size_; }
+    /// 分解能
+    Time resolution() const noexcept { return Nanoseconds{resolution_}; }
+
+private :
+    struct Node;
+    Node& node(uint32_t Index) const noexcept;
+    uint32_t allocate();
+    void release(uint32_t Index) noexcept;
+    void insert(uint32_t Index) noexcept;
+    void link(uint32_t Index, uint32_t List) noexcept;
+    void unlink(uint32_t Index) noexcept;
+    void expire();
+
+    static constexpr uint32_t kLevelBits = 8U;
+    static constexpr uint32_t kNumSlots = 1U << kLevelBits;
+    static constexpr uint32_t kNumLevels = 4U;
+    static constexpr uint32_t kExpiringList = kNumSlots*kNumLevels; // 満了して呼び出し待ちのリスト
+    static constexpr uint32_t kNil = UINT32_MAX;
+
+    std::vector<std::unique_ptr<Node[]>> chunks_; // 呼び出し中に追加されても移動しないよう、ブロック単位で確保
+    uint32_t capacity_ = 0U;
+    uint32_t free_ = kNil;
+    uint32_t heads_[kExpiringList+1U];
+    uint32_t tails_[kExpiringList+1U];
+    size_t size_ = 0U;
+    int64_t resolution_;    // ns
+    int64_t elapsed_ = 0;   // ns
+    uint64_t current_ = 0U; // 次に処理するティック
+};
+
+} // namespace easy_engine
+#endif // !INCLUDED_EGEG_TIMER_WHEEL_HEADER_
+// EOF
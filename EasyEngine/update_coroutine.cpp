@@ -0,0 +1,118 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include "update_coroutine.hpp"
+#ifdef EGEG_ENABLE_COROUTINE
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <mutex>
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace co_ns = easy_engine::coroutine_impl;
+namespace {
+    constexpr size_t kMinBlockShift = 6U;       // 最小ブロック 64byte
+    constexpr size_t kNumClasses = 6U;          // 64, 128, …, 2048byte
+    constexpr size_t kMaxBlockSize = size_t{1} << (kMinBlockShift+kNumClasses-1U);
+    constexpr size_t kChunkSize = 64U * 1024U;  // まとめて確保する領域のサイズ
+
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    // チャンクの保持
+    //  チャンクはプログラムの終了まで返却しないため、ブロックはどのスレッドの空きリストに戻しても良い
+    struct ChunkStorage {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<std::byte[]>> chunks;
+    };
+    ChunkStorage& chunkStorage() {
+        static ChunkStorage instance;
+        return instance;
+    }
+
+    // スレッド毎のサイズクラス別空きリスト
+    //  ロックはチャンクを確保する時のみ
+    struct ThreadCache {
+        FreeBlock* free[kNumClasses] {};
+        std::byte* cursor = nullptr;    // 現在のチャンクの未使用領域
+        size_t remain = 0U;
+    };
+    thread_local ThreadCache tls_cache;
+
+    std::atomic<size_t> g_reserved_bytes{0U};
+    std::atomic<size_t> g_frames_in_use{0U};
+    std::atomic<size_t> g_heap_allocations{0U};
+
+    size_t sizeClass(const size_t Size) noexcept {
+        return Size <= (size_t{1} << kMinBlockShift) ? 0U : std::bit_width(Size-1U) - kMinBlockShift;
+    }
+} // unnamed namespace
+
+
+/******************************************************************************
+
+    FramePool::
+
+******************************************************************************/
+void* co_ns::FramePool::allocate(const size_t Size) {
+    if(Size > kMaxBlockSize) {
+        g_heap_allocations.fetch_add(1U, std::memory_order_relaxed);
+        return ::operator new(Size);
+    }
+
+    ThreadCache& cache = tls_cache;
+    const size_t cls = sizeClass(Size);
+    if(FreeBlock* block = cache.free[cls]) {
+        cache.free[cls] = block->next;
+        g_frames_in_use.fetch_add(1U, std::memory_order_relaxed);
+        return block;
+    }
+
+    const size_t block_size = size_t{1} << (kMinBlockShift+cls);
+    if(cache.remain < block_size) { // 端数(kMaxBlockSize 未満)は捨てる
+        ChunkStorage& storage = chunkStorage();
+        std::lock_guard<std::mutex> lock{storage.mutex};
+        storage.chunks.emplace_back(new std::byte[kChunkSize]);
+        cache.cursor = storage.chunks.back().get();
+        cache.remain = kChunkSize;
+        g_reserved_bytes.fetch_add(kChunkSize, std::memory_order_relaxed);
+    }
+    void* block = cache.cursor;
+    cache.cursor += block_size;
+    cache.remain -= block_size;
+    g_frames_in_use.fetch_add(1U, std::memory_order_relaxed);
+    return block;
+}
+
+void co_ns::FramePool::deallocate(void* Ptr, const size_t Size) noexcept {
+    if(!Ptr) return;
+    if(Size > kMaxBlockSize) {
+        ::operator delete(Ptr);
+        return;
+    }
+
+    ThreadCache& cache = tls_cache;
+    const size_t cls = sizeClass(Size);
+    cache.free[cls] = ::new(Ptr) FreeBlock{cache.free[cls]};
+    g_frames_in_use.fetch_sub(1U, std::memory_order_relaxed);
+}
+
+easy_engine::UpdateCoroutinePoolStats co_ns::FramePool::stats() {
+    return easy_engine::UpdateCoroutinePoolStats {
+        g_reserved_bytes.load(std::memory_order_relaxed),
+        g_frames_in_use.load(std::memory_order_relaxed),
+        g_heap_allocations.load(std::memory_order_relaxed)
+    };
+}
+
+#endif // EGEG_ENABLE_COROUTINE
+// EOF
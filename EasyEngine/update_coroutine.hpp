@@ -0,0 +1,324 @@
+///
+/// \file   update_coroutine.hpp
+/// \brief  コルーチンによる更新処理定義ヘッダ
+///
+///         C++20 のコルーチンが使用できる場合(/std:c++20 以降)にのみ定義されます。
+///         使用できる場合は EGEG_ENABLE_COROUTINE マクロが定義されます。
+///
+/// \author 板場
+///
+/// \par    履歴
+///         - 2026/10/19
+///             - ヘッダ追加
+///             - UpdateCoroutine 定義
+///             - nextFrame, waitFor, waitUntil, whenAll 定義
+///
+#ifndef INCLUDED_EGEG_UPDATE_COROUTINE_HEADER_
+#define INCLUDED_EGEG_UPDATE_COROUTINE_HEADER_
+
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define EGEG_ENABLE_COROUTINE
+#endif
+#endif
+
+#ifdef EGEG_ENABLE_COROUTINE
+#include <array>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <utility>
+#include <vector>
+#include "time.hpp"
+
+namespace easy_engine {
+  namespace coroutine_impl {
+    struct Promise;
+    class FramePool;
+  } // namespace coroutine_impl
+
+/******************************************************************************
+
+    UpdateCoroutinePoolStats
+
+******************************************************************************/
+///
+/// \brief  コルーチンフレーム用プールの統計
+///
+struct UpdateCoroutinePoolStats {
+    size_t reserved_bytes = 0U;     ///< プールが確保している領域のサイズ
+    size_t frames_in_use = 0U;      ///< 使用中のフレーム数
+    size_t heap_allocations = 0U;   ///< プールに収まらず、グローバルヒープから確保した回数
+};
+
+
+/******************************************************************************
+
+    UpdateCoroutine
+
+******************************************************************************/
+///
+/// \brief  複数フレームにまたがる更新処理
+///
+///         戻り値の型を UpdateCoroutine とした関数で、co_await による待機を記述できます。
+///         UpdateManager::registerTask に渡すと、登録した優先度の位置で毎フレーム再開の判定を行います。
+///         使用例.)
+///             UpdateCoroutine Hoge::attack() {
+///                 play("charge");
+///                 co_await waitFor(Milliseconds{500});
+///                 play("swing");
+///                 co_await waitUntil([this] { return isAnimationEnd(); });
+///                 co_await whenAll(shake(), flash());
+///             }
+///             task_ = …registerTask(hoge.attack(), 6U);
+///
+///         コルーチンは生成時には実行されず、最初の tick で開始します。
+///         コルーチンフレームはスレッド毎のプールから確保するため、グローバルヒープを使用しません。
+///         (プールの最大ブロックを超えるフレームのみ、グローバルヒープから確保します。)
+///
+/// \attention コルーチンの引数は、参照ではなく値で受け取るようにしてください。
+///            コルーチンは呼び出し元の関数を抜けた後で再開するため、参照先が破棄されている可能性があります。
+///
+class UpdateCoroutine {
+public :
+    using promise_type = coroutine_impl::Promise;
+
+    UpdateCoroutine() noexcept = default;
+    explicit UpdateCoroutine(const std::coroutine_handle<promise_type> Handle) noexcept : handle_{Handle} {}
+    UpdateCoroutine(UpdateCoroutine&& Right) noexcept : handle_{std::exchange(Right.handle_, nullptr)} {}
+    UpdateCoroutine& operator=(UpdateCoroutine&& Right) noexcept {
+        if(this != &Right) {
+            if(handle_) handle_.destroy();
+            handle_ = std::exchange(Right.handle_, nullptr);
+        }
+        return *this;
+    }
+    ~UpdateCoroutine() { if(handle_) handle_.destroy(); }
+
+    UpdateCoroutine(const UpdateCoroutine&) = delete;
+    UpdateCoroutine& operator=(const UpdateCoroutine&) = delete;
+
+    ///
+    /// \brief  1フレーム分処理を進める
+    ///
+    ///         待機中の条件を満たしていれば、次の co_await まで処理を再開します。
+    ///
+    /// \param[in] Elapsed : 前回の tick からの経過時間
+    ///
+    /// \return true : 完了している  false : 未完了
+    ///
+    /// \throw  コルーチン内で捕捉されなかった例外
+    ///
+    bool tick(Time Elapsed);
+
+    /// 完了しているかどうか(コルーチンを保持していない場合も完了として扱う)
+    bool isDone() const noexcept { return !handle_ || handle_.done(); }
+    bool isValid() const noexcept { return static_cast<bool>(handle_); }
+    explicit operator bool() const noexcept { return isValid(); }
+
+    /// コルーチンフレーム用プールの統計
+    static UpdateCoroutinePoolStats poolStats();
+
+private :
+    std::coroutine_handle<promise_type> handle_;
+};
+
+
+/******************************************************************************
+
+    awaitables
+
+******************************************************************************/
+  namespace coroutine_impl {
+    // 待機条件の判定関数 true で再開する
+    using PollType = bool(*)(void* Awaiter, Time Elapsed);
+
+    class FramePool {
+    public :
+        static void* allocate(size_t Size);
+        static void deallocate(void* Ptr, size_t Size) noexcept;
+        static UpdateCoroutinePoolStats stats();
+    };
+
+    struct Promise {
+        UpdateCoroutine get_return_object() noexcept {
+            return UpdateCoroutine{std::coroutine_handle<Promise>::from_promise(*this)};
+        }
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        std::suspend_always final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() noexcept { exception = std::current_exception(); }
+
+        static void* operator new(const size_t Size) { return FramePool::allocate(Size); }
+        static void operator delete(void* Ptr, const size_t Size) noexcept { FramePool::deallocate(Ptr, Size); }
+
+        PollType poll = nullptr;    // nullptr の場合は次の tick で再開
+        void* awaiter = nullptr;
+        Time waited{};              // 待機を開始してからの経過時間
+        std::exception_ptr exception;
+    };
+
+    // 待機の共通部分
+    //  await_resume は待機していた時間を返す
+    struct AwaiterBase {
+        void suspend(const std::coroutine_handle<Promise> Handle, const PollType Poll) noexcept {
+            promise_ = &Handle.promise();
+            promise_->poll = Poll;
+            promise_->awaiter = this;
+            promise_->waited = Time{};
+        }
+        Time await_resume() const noexcept { return promise_ ? promise_->waited : Time{}; }
+
+        Promise* promise_ = nullptr;
+    };
+
+    struct FrameAwaiter : AwaiterBase {
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(const std::coroutine_handle<Promise> Handle) noexcept { suspend(Handle, nullptr); }
+    };
+
+    struct TimeAwaiter : AwaiterBase {
+        bool await_ready() const noexcept { return duration_ <= Time{}; }
+        void await_suspend(const std::coroutine_handle<Promise> Handle) noexcept {
+            suspend(Handle, [](void* Self, Time) noexcept {
+                const auto self = static_cast<TimeAwaiter*>(Self);
+                return self->promise_->waited >= self->duration_;
+            });
+        }
+
+        Time duration_;
+    };
+
+    template <class PredTy>
+    struct ConditionAwaiter : AwaiterBase {
+        bool await_ready() { return static_cast<bool>(pred_()); }
+        void await_suspend(const std::coroutine_handle<Promise> Handle) noexcept {
+            suspend(Handle, [](void* Self, Time) {
+                return static_cast<bool>(static_cast<ConditionAwaiter*>(Self)->pred_());
+            });
+        }
+
+        PredTy pred_;
+    };
+
+    // 子コルーチンを全て進め、全て完了したら再開する
+    //  子の例外は最初の1つを保持して親を再開し、await_resume で再送出する
+    template <class ContainerTy>
+    struct WhenAllAwaiter : AwaiterBase {
+        bool await_ready() { return tickChildren(Time{}); }
+        void await_suspend(const std::coroutine_handle<Promise> Handle) noexcept {
+            suspend(Handle, [](void* Self, const Time Elapsed) {
+                return static_cast<WhenAllAwaiter*>(Self)->tickChildren(Elapsed);
+            });
+        }
+        Time await_resume() const {
+            if(exception_) std::rethrow_exception(exception_);
+            return AwaiterBase::await_resume();
+        }
+        bool tickChildren(const Time Elapsed) {
+            bool done = true;
+            for(auto& child : children_) {
+                try {
+                    if(!child.tick(Elapsed)) done = false;
+                }
+                catch(...) {
+                    exception_ = std::current_exception();
+                    return true;
+                }
+            }
+            return done;
+        }
+
+        ContainerTy children_;
+        std::exception_ptr exception_;
+    };
+  } // namespace coroutine_impl
+
+///
+/// \brief  次のフレームまで待機
+///
+///         co_await の結果は、そのフレームの経過時間です。
+///
+inline coroutine_impl::FrameAwaiter nextFrame() noexcept { return {}; }
+
+///
+/// \brief  指定した時間が経過するまで待機
+///
+///         経過時間はタスクに渡される時間(固定タイムステップモードではステップの時間)で計ります。
+///         co_await の結果は、実際に待機した時間(Duration 以上)です。
+///
+/// \param[in] Duration : 待機する時間
+///
+inline coroutine_impl::TimeAwaiter waitFor(const Time Duration) noexcept {
+    coroutine_impl::TimeAwaiter awaiter;
+    awaiter.duration_ = Duration;
+    return awaiter;
+}
+
+///
+/// \brief  条件を満たすまで待機
+///
+///         条件は co_await の時点と、以降の毎フレームに判定します。
+///
+/// \param[in] Pred : 条件を満たすと true を返す関数オブジェクト
+///
+template <class PredTy>
+coroutine_impl::ConditionAwaiter<std::decay_t<PredTy>> waitUntil(PredTy&& Pred) {
+    return {{}, std::forward<PredTy>(Pred)};
+}
+
+///
+/// \brief  全てのコルーチンが完了するまで待機
+///
+///         コルーチンは co_await の時点で開始し、以降のフレームでは待機しているコルーチンの位置で、
+///         引数の順に進めます。
+///         いずれかのコルーチンが例外を送出した場合は、co_await の位置で再送出します。
+///
+/// \param[in] Coroutines : 待機するコルーチン
+///
+template <class ...CoroutineTypes>
+coroutine_impl::WhenAllAwaiter<std::array<UpdateCoroutine, sizeof...(CoroutineTypes)>>
+whenAll(CoroutineTypes&&... Coroutines) {
+    static_assert((std::is_same_v<std::decay_t<CoroutineTypes>, UpdateCoroutine> && ...),
+                  "'Coroutines' must be UpdateCoroutine");
+    return {{}, {std::move(Coroutines)...}, nullptr};
+}
+inline coroutine_impl::WhenAllAwaiter<std::vector<UpdateCoroutine>> whenAll(std::vector<UpdateCoroutine> Coroutines) {
+    return {{}, std::move(Coroutines), nullptr};
+}
+
+///
+/// \brief  コルーチンの完了を待機
+///
+///         co_await hoge(); の形式で、別のコルーチンを呼び出します。
+///
+inline coroutine_impl::WhenAllAwaiter<std::array<UpdateCoroutine, 1U>> operator co_await(UpdateCoroutine&& Coroutine) {
+    return whenAll(std::move(Coroutine));
+}
+
+/******************************************************************************
+
+    UpdateCoroutine::
+
+******************************************************************************/
+inline bool UpdateCoroutine::tick(const Time Elapsed) {
+    if(isDone()) return true;
+
+    promise_type& promise = handle_.promise();
+    promise.waited += Elapsed;
+    if(promise.poll && !promise.poll(promise.awaiter, Elapsed)) return false;
+
+    promise.poll = nullptr;
+    handle_.resume();
+    if(promise.exception) std::rethrow_exception(std::exchange(promise.exception, nullptr));
+    return handle_.done();
+}
+
+inline UpdateCoroutinePoolStats UpdateCoroutine::poolStats() {
+    return coroutine_impl::FramePool::stats();
+}
+
+} // namespace easy_engine
+#endif // EGEG_ENABLE_COROUTINE
+#endif // !INCLUDED_EGEG_UPDATE_COROUTINE_HEADER_
+// EOF
@@ -1,29 +1,161 @@
 ///
 /// \file   update_manager.hpp
-/// \brief  XV}l[W[`wb_
+/// \brief  更新処理マネージャー定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/8/20
-///             - wb_ǉ
-///             - UpdateScheduler `
+///             - ヘッダ追加
+///             - UpdateScheduler 定義
 ///         - 2020/8/21
-///             - OύX(t@CANXAetc...)
+///             - 名前変更(ファイル名、クラス名、etc...)
+///         - 2026/10/19
+///             - 並列実行モード追加
+///             - 依存グラフによる更新処理の登録を追加
+///             - UpdateFunctorType を std::function<…>から InplaceFunction<…>に変更
+///             - Delegate<…>による登録を追加
+///             - タスク名を追加(プロファイラ用)
+///             - 固定タイムステップモード追加
+///             - コルーチンによる更新処理の登録を追加
+///             - タイマーホイールを追加
+///             - 時間予算付きタスクの登録を追加
+///             - UpdateInterval 定義
+///             - 実行間隔を指定したタスクの登録を追加
+///             - 登録中のタスク数(size())を公開
+///             - クロックに従うタスクの登録を追加
+///             - 固定タイムステップモードで、シミュレーションの実行間隔をステップ数で数えるよう修正
 /// 
 #ifndef INCLUDED_EGEG_UPDATE_MANAGER_HEADER_
 #define INCLUDED_EGEG_UPDATE_MANAGER_HEADER_
 
+#include <cstdint>
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <typeinfo>
+#include <utility>
+#include <vector>
 #include "task_manager.hpp"
+#include "task_graph.hpp"
+#include "inplace_function.hpp"
 #include "noncopyable.hpp"
 #include "time.hpp"
+#include "update_order.hpp"
+#include "update_coroutine.hpp"
+#include "timer_wheel.hpp"
+#include "budget_scheduler.hpp"
+#include "scaled_clock.hpp"
 
 namespace easy_engine {
 
+/******************************************************************************
+
+    UpdateInterval
+
+******************************************************************************/
+///
+/// \brief  タスクの実行間隔
+///
+///         UpdateManager::registerTask に渡すと、frames 回に1回だけ更新関数を呼び出します。
+///         登録例.) …registerTask(&hoge, &HogeClass::perceive, UpdateInterval{4U}, 6U);
+///
+struct UpdateInterval {
+    uint32_t frames = 1U;   ///< 何回に1回呼び出すか
+    bool stagger = true;    ///< 同じ間隔のタスクを呼び出すフレームを分散するか
+};
+
 namespace impl {
-using UpdateFunctorType = std::function<void(Time)>;
+using UpdateFunctorType = t_lib::InplaceFunction<void(Time)>;
+
+// 間隔毎、位相毎の登録されているタスク数
+//  同じ間隔のタスクを、最もタスクの少ない位相に割り当てる
+class IntervalPhases {
+public :
+    uint32_t acquire(const uint32_t Interval) {
+        std::lock_guard<std::mutex> lock{mutex_};
+        std::vector<uint32_t>& load = loads_[Interval];
+        if(load.empty()) load.resize(Interval, 0U);
+        const auto phase = std::min_element(load.begin(), load.end());
+        ++*phase;
+        return static_cast<uint32_t>(phase - load.begin());
+    }
+    void release(const uint32_t Interval, const uint32_t Phase) noexcept {
+        std::lock_guard<std::mutex> lock{mutex_};
+        const auto found = loads_.find(Interval);
+        if(found != loads_.end()) --found->second[Phase];
+    }
+private :
+    std::mutex mutex_;
+    std::map<uint32_t, std::vector<uint32_t>> loads_;
+};
+
+// 実行間隔を指定したタスク
+//  呼び出されなかった回の経過時間を蓄積し、呼び出す回にまとめて渡す
+//  Counter はタスクを呼び出す毎に1進むカウンタ(フレーム数、またはシミュレーションのステップ数)で、
+//  その値が位相と一致する回に呼び出す
+class IntervalTask {
+public :
+    IntervalTask(UpdateFunctorType&& Task, const uint32_t Interval, const uint32_t Phase, const uint64_t& Counter,
+                 std::shared_ptr<IntervalPhases> Phases) noexcept :
+        task_{std::move(Task)}, phases_{std::move(Phases)}, counter_{Counter}, interval_{Interval}, phase_{Phase} {}
+    ~IntervalTask() { if(phases_) phases_->release(interval_, phase_); }
+
+    void operator()(const Time Elapsed) {
+        accumulated_ += Elapsed;
+        if(!started_) { // 実行中に登録された場合も合うよう、最初の呼び出しで残り回数を決める
+            started_ = true;
+            countdown_ = static_cast<uint32_t>((phase_ + interval_ - counter_%interval_) % interval_);
+        }
+        if(countdown_ > 0U) {
+            --countdown_;
+            return;
+        }
+        countdown_ = interval_ - 1U;
+        task_(std::exchange(accumulated_, Time{}));
+    }
+
+private :
+    UpdateFunctorType task_;
+    std::shared_ptr<IntervalPhases> phases_; // 分散しない場合は nullptr
+    const uint64_t& counter_;
+    Time accumulated_{};
+    uint32_t interval_;
+    uint32_t phase_;
+    uint32_t countdown_ = 0U;   // 次に呼び出すまでにスキップする回数
+    bool started_ = false;
+};
+
+// クロックに従うタスク
+//  フレームの経過時間の代わりに、クロックの経過時間を渡す
+//  停止中(クロックが進まなかった回)は呼び出さず、固定ステップのクロックではステップ数だけ呼び出す
+//  固定タイムステップモード等で1フレームに複数回実行される場合も、クロックの1回の更新につき1回だけ処理する
+class ClockedTask {
+public :
+    ClockedTask(UpdateFunctorType&& Task, const ScaledClock& Clock) noexcept :
+        task_{std::move(Task)}, clock_{Clock}, last_tick_{Clock.ticks()} {}
+
+    void operator()(Time) {
+        if(clock_.ticks() == last_tick_) return;
+        last_tick_ = clock_.ticks();
+        if(!clock_.isFixedStep()) {
+            if(clock_.steps() > 0U) task_(clock_.delta());
+            return;
+        }
+        for(uint32_t i=0; i<clock_.steps(); ++i) task_(clock_.fixedStep());
+    }
+
+private :
+    UpdateFunctorType task_;
+    const ScaledClock& clock_;
+    uint64_t last_tick_;
+};
 } // namespace impl
 using UpdateTaskInfo = t_lib::TaskManager<impl::UpdateFunctorType>::TaskInfo;
+using UpdateGraphDesc = t_lib::TaskGraph<impl::UpdateFunctorType>::TaskDesc;
+using UpdateGraphTaskInfo = t_lib::TaskGraph<impl::UpdateFunctorType>::TaskInfo;
 
 /******************************************************************************
 
@@ -31,15 +163,15 @@ using UpdateTaskInfo = t_lib::TaskManager<impl::UpdateFunctorType>::TaskInfo;
 
 ******************************************************************************/
 ///
-/// \brief  XV}l[W[
+/// \brief  更新マネージャー
 ///
-///         Q[XVɊւ}l[W[łB
-///         ֐̓o^AXPW[OAĂяos܂B
-///          t_lib::TaskManager<c>łB
-///         ڍׂɂĂ t_lib::TaskManager<c>QƂĂB
+///         ゲーム更新処理に関するマネージャーです。
+///         関数の登録、スケジューリング、呼び出し等を行います。
+///         実装は t_lib::TaskManager<…>です。
+///         詳細についても t_lib::TaskManager<…>を参照してください。
 /// \see    t_lib::TaskManager
 ///
-/// \tparam AdminTy : }l[W[ǗNX^
+/// \tparam AdminTy : マネージャーを管理するクラス型
 ///
 template <class AdminTy>
 class UpdateManager final : t_lib::TaskManager<impl::UpdateFunctorType>, t_lib::Noncopyable<UpdateManager<AdminTy>> {
@@ -48,35 +180,381 @@ public :
 
     using TaskInfo = t_lib::TaskManager<impl::UpdateFunctorType>::TaskInfo;
     using t_lib::TaskManager<impl::UpdateFunctorType>::unregisterTask;
+    using t_lib::TaskManager<impl::UpdateFunctorType>::size; // 登録中のタスク数(時間予算付きタスクを除く)
 
     ///
-    /// \brief  ^XNo^
+    /// \brief  タスクを登録
     ///
-    ///         XVo^܂B
-    ///         o^XV֐̓o֐łKv܂B
-    ///         o^.) cregisterTask(&hoge, &HogeClass::update, 6U);
-    ///         registerTask̖߂l͖ł܂B
+    ///         更新処理を登録します。
+    ///         登録する更新関数はメンバ関数である必要があります。
+    ///         登録例.) …registerTask(&hoge, &HogeClass::update, 6U);
+    ///         ※registerTaskの戻り値は無視できません。
     ///
-    /// \tparam OwnerTy : ֐̃I[i[NX^
-    /// \param[in] Owner    : ֐̃I[i[
-    /// \param[in] Function : o^XV֐ւ̃|C^
-    /// \param[in] Priority : ֐̗Dx
+    /// \tparam OwnerTy : 関数のオーナークラス型
+    /// \param[in] Owner    : 関数のオーナー
+    /// \param[in] Function : 登録する更新関数へのポインタ
+    /// \param[in] Priority : 関数の優先度
+    /// \param[in] Affinity : 並列実行モードで関数を実行するスレッド
+    /// \param[in] Name     : タスク名(プロファイラ用) 省略時はオーナーのクラス名
     ///
-    /// \return ^XN̓o^
+    /// \return タスクの登録情報
     ///
     template <class OwnerTy>
     [[nodiscard]] UpdateTaskInfo registerTask(
-    OwnerTy* Owner, void(OwnerTy::*Function)(Time), const uint32_t Priority=5U) {
+    OwnerTy* Owner, void(OwnerTy::*Function)(Time), const uint32_t Priority=5U,
+    const t_lib::TaskAffinity Affinity=t_lib::TaskAffinity::kAnyThread, const char* Name=nullptr) {
+        return t_lib::TaskManager<impl::UpdateFunctorType>::registerTask(
+            [Owner, Function](const Time Elapsed) { (Owner->*Function)(Elapsed); }, Priority, Affinity,
+            Name ? Name : typeid(OwnerTy).name());
+    }
+
+    ///
+    /// \brief  タスクを登録
+    ///
+    ///         更新関数をテンプレート引数で指定する版です。
+    ///         関数ポインタを保持せず、t_lib::Delegate<…>経由で直接呼び出すため、呼び出しのコストが最小になります。
+    ///         登録例.) …registerTask<&HogeClass::update>(&hoge, 6U);
+    ///
+    /// \tparam Function : 登録する更新関数へのポインタ
+    /// \tparam OwnerTy  : 関数のオーナークラス型
+    /// \param[in] Owner    : 関数のオーナー
+    /// \param[in] Priority : 関数の優先度
+    /// \param[in] Affinity : 並列実行モードで関数を実行するスレッド
+    /// \param[in] Name     : タスク名(プロファイラ用) 省略時はオーナーのクラス名
+    ///
+    /// \return タスクの登録情報
+    ///
+    template <auto Function, class OwnerTy>
+    [[nodiscard]] UpdateTaskInfo registerTask(
+    OwnerTy* Owner, const uint32_t Priority=5U,
+    const t_lib::TaskAffinity Affinity=t_lib::TaskAffinity::kAnyThread, const char* Name=nullptr) {
         return t_lib::TaskManager<impl::UpdateFunctorType>::registerTask(
-            std::bind(Function, Owner, std::placeholders::_1), Priority);
+            t_lib::Delegate<void(Time)>::bind<Function>(Owner), Priority, Affinity,
+            Name ? Name : typeid(OwnerTy).name());
+    }
+
+    ///
+    /// \brief  実行間隔を指定してタスクを登録
+    ///
+    ///         AI の知覚や LOD の更新等、毎フレーム実行する必要の無い処理を Interval.frames 回に1回呼び出します。
+    ///         更新関数には、前回呼び出してからの経過時間の合計を渡します。
+    ///         Interval.stagger が true の場合、同じ間隔のタスクを呼び出すフレームが均等にずれるよう割り当て、
+    ///         1フレーム当たりの処理量を平らにします。(false の場合はフレーム番号が間隔の倍数のフレームで呼び出す)
+    ///         描画フェーズより前の優先度のタスク(シミュレーション)は、固定タイムステップモードではフレームではなくステップを数え、
+    ///         分散もステップ単位で、描画フェーズのタスクとは別に行います。(登録時の描画フェーズの設定で判定)
+    ///         登録例.) …registerTask(&hoge, &HogeClass::perceive, UpdateInterval{4U}, 6U);
+    ///
+    /// \tparam OwnerTy : 関数のオーナークラス型
+    /// \param[in] Owner    : 関数のオーナー
+    /// \param[in] Function : 登録する更新関数へのポインタ
+    /// \param[in] Interval : 実行間隔
+    /// \param[in] Priority : 関数の優先度
+    /// \param[in] Affinity : 並列実行モードで関数を実行するスレッド
+    /// \param[in] Name     : タスク名(プロファイラ用) 省略時はオーナーのクラス名
+    ///
+    /// \return タスクの登録情報
+    ///
+    template <class OwnerTy>
+    [[nodiscard]] UpdateTaskInfo registerTask(
+    OwnerTy* Owner, void(OwnerTy::*Function)(Time), const UpdateInterval& Interval, const uint32_t Priority=5U,
+    const t_lib::TaskAffinity Affinity=t_lib::TaskAffinity::kAnyThread, const char* Name=nullptr) {
+        return registerIntervalTask(
+            [Owner, Function](const Time Elapsed) { (Owner->*Function)(Elapsed); }, Interval, Priority, Affinity,
+            Name ? Name : typeid(OwnerTy).name());
+    }
+    template <auto Function, class OwnerTy>
+    [[nodiscard]] UpdateTaskInfo registerTask(
+    OwnerTy* Owner, const UpdateInterval& Interval, const uint32_t Priority=5U,
+    const t_lib::TaskAffinity Affinity=t_lib::TaskAffinity::kAnyThread, const char* Name=nullptr) {
+        return registerIntervalTask(
+            t_lib::Delegate<void(Time)>::bind<Function>(Owner), Interval, Priority, Affinity,
+            Name ? Name : typeid(OwnerTy).name());
+    }
+
+    ///
+    /// \brief  クロックに従うタスクを登録
+    ///
+    ///         更新関数に、フレームの経過時間の代わりに Clock の経過時間(倍率を掛けた時間)を渡します。
+    ///         Clock が停止している間は呼び出しません。
+    ///         固定ステップのクロックの場合は、進んだステップ数だけ1ステップの時間で呼び出します。
+    ///         登録例.) …registerTask(&hoge, &HogeClass::update, EasyEngine::clocks().game, 5U);
+    ///
+    /// \tparam OwnerTy : 関数のオーナークラス型
+    /// \param[in] Owner    : 関数のオーナー
+    /// \param[in] Function : 登録する更新関数へのポインタ
+    /// \param[in] Clock    : 従うクロック(登録を解除するまで破棄しないでください)
+    /// \param[in] Priority : 関数の優先度
+    /// \param[in] Affinity : 並列実行モードで関数を実行するスレッド
+    /// \param[in] Name     : タスク名(プロファイラ用) 省略時はオーナーのクラス名
+    ///
+    /// \return タスクの登録情報
+    ///
+    template <class OwnerTy>
+    [[nodiscard]] UpdateTaskInfo registerTask(
+    OwnerTy* Owner, void(OwnerTy::*Function)(Time), const ScaledClock& Clock, const uint32_t Priority=5U,
+    const t_lib::TaskAffinity Affinity=t_lib::TaskAffinity::kAnyThread, const char* Name=nullptr) {
+        return registerClockedTask(
+            [Owner, Function](const Time Elapsed) { (Owner->*Function)(Elapsed); }, Clock, Priority, Affinity,
+            Name ? Name : typeid(OwnerTy).name());
+    }
+    template <auto Function, class OwnerTy>
+    [[nodiscard]] UpdateTaskInfo registerTask(
+    OwnerTy* Owner, const ScaledClock& Clock, const uint32_t Priority=5U,
+    const t_lib::TaskAffinity Affinity=t_lib::TaskAffinity::kAnyThread, const char* Name=nullptr) {
+        return registerClockedTask(
+            t_lib::Delegate<void(Time)>::bind<Function>(Owner), Clock, Priority, Affinity,
+            Name ? Name : typeid(OwnerTy).name());
     }
 
+#ifdef EGEG_ENABLE_COROUTINE
+    ///
+    /// \brief  コルーチンをタスクとして登録
+    ///
+    ///         複数フレームにまたがる更新処理を登録します。
+    ///         登録した優先度の位置で毎フレーム待機条件を判定し、満たしていれば次の co_await まで再開します。
+    ///         完了したコルーチンは、完了したフレームの実行後に登録を自動で解除します。
+    ///         (戻り値の登録情報はその時点で無効になり、破棄しても何もしません。)
+    ///         登録例.) …registerTask(hoge.attack(), 6U);
+    /// \see    UpdateCoroutine
+    ///
+    /// \param[in] Coroutine : 登録するコルーチン
+    /// \param[in] Priority  : 優先度
+    /// \param[in] Affinity  : 並列実行モードでコルーチンを再開するスレッド
+    /// \param[in] Name      : タスク名(プロファイラ用)
+    ///
+    /// \return タスクの登録情報
+    ///
+    [[nodiscard]] UpdateTaskInfo registerTask(
+    UpdateCoroutine Coroutine, const uint32_t Priority=5U,
+    const t_lib::TaskAffinity Affinity=t_lib::TaskAffinity::kAnyThread, const char* Name="UpdateCoroutine") {
+        // 自身のハンドルはタスクの格納領域に持つ(コルーチンフレーム以外の確保を行わない)
+        return t_lib::TaskManager<impl::UpdateFunctorType>::registerTaskWithHandle(
+            [this, &Coroutine](const TaskHandle Self) noexcept {
+                return [this, coroutine = std::move(Coroutine), Self](const Time Elapsed) mutable {
+                    if(coroutine.tick(Elapsed)) unregisterHandle(Self);
+                };
+            },
+            Priority, Affinity, Name);
+    }
+#endif // EGEG_ENABLE_COROUTINE
+
+    ///
+    /// \brief  時間予算付きタスクを登録
+    ///
+    ///         1回に必要な処理時間に上限の無い処理(経路探索等)を、フレーム毎の予算の範囲で少しずつ実行します。
+    ///         更新関数は渡された予算を使い切ったら途中で戻り、未完了の作業が残っていれば true を返します。
+    ///         予算付きタスクは、フレームの最後(全てのタスクの実行後)にメインスレッドで実行します。
+    ///         登録例.) …registerBudgetedTask(&hoge, &HogeClass::plan, 6U);
+    /// \see    BudgetScheduler
+    ///
+    /// \tparam OwnerTy : 関数のオーナークラス型
+    /// \param[in] Owner    : 関数のオーナー
+    /// \param[in] Function : 登録する更新関数へのポインタ
+    /// \param[in] Priority : 予算を割り当てる優先度
+    /// \param[in] Name     : タスク名(プロファイラ用) 省略時はオーナーのクラス名
+    ///
+    /// \return タスクの登録情報
+    ///
+    template <class OwnerTy>
+    [[nodiscard]] BudgetedTaskInfo registerBudgetedTask(
+    OwnerTy* Owner, bool(OwnerTy::*Function)(const TaskBudget&), const uint32_t Priority=5U, const char* Name=nullptr) {
+        return budget_.registerTask(
+            [Owner, Function](const TaskBudget& Budget) { return (Owner->*Function)(Budget); }, Priority,
+            Name ? Name : typeid(OwnerTy).name());
+    }
+
+    ///
+    /// \brief  時間予算付きタスクのスケジューラ
+    ///
+    ///         予算(既定は1フレームの時間の10%)や飢餓閾値の設定、統計の取得に使用します。
+    ///         登録例.) …budgetScheduler().setBudget(0.2);
+    ///
+    BudgetScheduler& budgetScheduler() noexcept { return budget_; }
+    const BudgetScheduler& budgetScheduler() const noexcept { return budget_; }
+
+    ///
+    /// \brief  依存関係を指定してタスクを登録
+    ///
+    ///         依存グラフに更新処理を登録します。
+    ///         グラフのタスクは、優先度5U の位置でまとめて実行され、
+    ///         依存関係の無いタスク同士は並列実行モードの設定に関わらずジョブシステムで並列に実行されます。
+    ///         登録例.) desc.name = "physics"; desc.writes = {TypeIDGenerator<Transform>{}};
+    ///                  …registerTask(&hoge, &HogeClass::update, desc);
+    /// \see    t_lib::TaskGraph
+    ///
+    /// \tparam OwnerTy : 関数のオーナークラス型
+    /// \param[in] Owner    : 関数のオーナー
+    /// \param[in] Function : 登録する更新関数へのポインタ
+    /// \param[in] Desc     : 依存関係等の設定(名前の省略時はオーナーのクラス名)
+    ///
+    /// \return タスクの登録情報
+    ///
+    template <class OwnerTy>
+    [[nodiscard]] UpdateGraphTaskInfo registerTask(OwnerTy* Owner, void(OwnerTy::*Function)(Time), UpdateGraphDesc Desc) {
+        if(!graph_task_) {
+            graph_task_ = t_lib::TaskManager<impl::UpdateFunctorType>::registerTask(
+                [this](const Time Elapsed) { graph_.run(AdminTy::jobs(), Elapsed); },
+                5U, t_lib::TaskAffinity::kMainThread, "UpdateManager::graph");
+        }
+        if(!Desc.name || !*Desc.name) Desc.name = typeid(OwnerTy).name();
+        return graph_.registerTask(
+            [Owner, Function](const Time Elapsed) { (Owner->*Function)(Elapsed); }, std::move(Desc));
+    }
+
+    /// 依存グラフの直前のフレームの実行統計(クリティカルパス等)
+    const t_lib::TaskGraphStats& graphStats() const noexcept { return graph_.stats(); }
+
+    ///
+    /// \brief  タイマーホイール
+    ///
+    ///         遅延呼び出しや繰り返し呼び出しを登録します。
+    ///         タイマーはフレームの先頭(タスクの実行前)に、フレームの経過時間だけ進めて呼び出します。
+    ///         登録例.) auto id = …timers().schedule(Milliseconds{2500}, [this] { explode(); });
+    /// \see    TimerWheel
+    ///
+    /// \attention タイマーの操作はメインスレッドから行ってください。
+    ///            並列実行モードでは、t_lib::TaskAffinity::kMainThread のタスクから操作してください。
+    ///
+    TimerWheel& timers() noexcept { return timers_; }
+    const TimerWheel& timers() const noexcept { return timers_; }
+
+    ///
+    /// \brief  並列実行モードの設定
+    ///
+    ///         有効にすると、同じ優先度の更新処理をジョブシステムで並列に実行します。
+    ///         描画等、メインスレッドでしか実行できない処理は
+    ///         t_lib::TaskAffinity::kMainThread を指定して登録してください。
+    /// \see    t_lib::TaskManager::runParallel
+    ///
+    /// \param[in] Enable : 有効にするか
+    ///
+    void setParallel(const bool Enable) noexcept { parallel_ = Enable; }
+    bool isParallel() const noexcept { return parallel_; }
+
+    ///
+    /// \brief  固定タイムステップモードの設定
+    ///
+    ///         有効にすると、描画フェーズより前の優先度のタスク(シミュレーション)を、
+    ///         フレームの経過時間に関わらず一定の時間 Step で呼び出します。
+    ///         経過時間は蓄積され、Step 毎に1回ずつ呼び出します。(1フレームで複数回、または0回)
+    ///         描画フェーズのタスクはフレーム毎に1回、実際の経過時間で呼び出します。
+    ///         描画フェーズのタスクは interpolation() により、直前の2ステップ間の補間係数を取得できます。
+    ///
+    ///         処理落ちが続いた場合に呼び出し回数が増え続けないよう、
+    ///         1フレームの呼び出し回数は MaxSteps 回までとし、超過した時間は切り捨てます。
+    ///
+    /// \param[in] Step        : 1ステップの時間 Time{}で無効
+    /// \param[in] MaxSteps    : 1フレームで呼び出す最大回数
+    /// \param[in] RenderPhase : 描画フェーズとする最初の優先度
+    ///
+    void setFixedTimestep(const Time Step, const uint32_t MaxSteps=5U,
+                          const uint32_t RenderPhase=UpdateOrder::kRenderBegin) noexcept {
+        step_ = Step;
+        max_steps_ = MaxSteps ? MaxSteps : 1U;
+        render_phase_ = RenderPhase;
+        accumulator_ = Time{};
+        interpolation_ = 0.0;
+    }
+    bool isFixedTimestep() const noexcept { return step_ > Time{}; }
+    Time fixedTimestep() const noexcept { return step_; }
+
+    ///
+    /// \brief  描画補間係数
+    ///
+    ///         固定タイムステップモードで、最後のステップから次のステップまでの進み具合を[0, 1)で返します。
+    ///         描画時の状態は 前回の状態*(1-α) + 最新の状態*α で補間します。
+    ///         固定タイムステップモードでない場合は常に 1 です。
+    ///
+    double interpolation() const noexcept { return isFixedTimestep() ? interpolation_ : 1.0; }
+    /// 直前のフレームでシミュレーションを呼び出した回数
+    uint32_t lastSteps() const noexcept { return last_steps_; }
+    /// 呼び出し回数の上限により切り捨てた時間の合計
+    Time droppedTime() const noexcept { return dropped_; }
+
 private :
-    static std::unique_ptr<UpdateManager> create() { // AdminTyNXɂĂяo
+    static std::unique_ptr<UpdateManager> create() { // AdminTyクラスにより呼び出される
         return std::unique_ptr<UpdateManager>(new UpdateManager());
     }
-    using t_lib::TaskManager<impl::UpdateFunctorType>::run; // 㓯 ob`
+    void run(const Time Elapsed) { // 上同 バッチ処理
+        ++frames_;
+        timers_.advance(Elapsed);
+        if(!isFixedTimestep()) {
+            ++sim_steps_;
+            runPhase(t_lib::TaskPriorityRange{}, Elapsed);
+        }
+        else {
+            runFixed(Elapsed);
+        }
+        budget_.run();
+    }
+    void runFixed(const Time Elapsed) { // 固定タイムステップモード
+      // シミュレーション
+        accumulator_ += Elapsed;
+        last_steps_ = 0U;
+        if(render_phase_ > 0U) {
+            while(accumulator_ >= step_ && last_steps_ < max_steps_) {
+                ++sim_steps_;
+                runPhase(t_lib::TaskPriorityRange{0U, render_phase_-1U}, step_);
+                accumulator_ -= step_;
+                ++last_steps_;
+            }
+        }
+        if(accumulator_ >= step_) { // 上限を超えた分は切り捨てる
+            const Time remainder = Time{accumulator_} %= step_;
+            dropped_ += accumulator_ - remainder;
+            accumulator_ = remainder;
+        }
+        interpolation_ = static_cast<double>(accumulator_.nanoseconds()) / step_.nanoseconds();
+
+      // 描画
+        runPhase(t_lib::TaskPriorityRange{render_phase_}, Elapsed);
+    }
+    UpdateTaskInfo registerIntervalTask(impl::UpdateFunctorType&& Task, const UpdateInterval& Interval,
+                                        const uint32_t Priority, const t_lib::TaskAffinity Affinity, const char* Name) {
+        const uint32_t interval = std::max(Interval.frames, 1U);
+        if(interval == 1U) {
+            return t_lib::TaskManager<impl::UpdateFunctorType>::registerTask(std::move(Task), Priority, Affinity, Name);
+        }
+        // シミュレーションのタスクはステップ毎に呼び出されるため、ステップを数え、フレームのタスクとは別に分散する
+        const bool simulation = Priority < render_phase_;
+        const std::shared_ptr<impl::IntervalPhases>& phases = simulation ? sim_phases_ : phases_;
+        const uint32_t phase = Interval.stagger ? phases->acquire(interval) : 0U;
+        auto task = std::make_unique<impl::IntervalTask>( // InplaceFunction<…>に収まるよう、状態は別に確保する
+            std::move(Task), interval, phase, simulation ? sim_steps_ : frames_, Interval.stagger ? phases : nullptr);
+        return t_lib::TaskManager<impl::UpdateFunctorType>::registerTask(
+            [task = std::move(task)](const Time Elapsed) { (*task)(Elapsed); }, Priority, Affinity, Name);
+    }
+    UpdateTaskInfo registerClockedTask(impl::UpdateFunctorType&& Task, const ScaledClock& Clock,
+                                       const uint32_t Priority, const t_lib::TaskAffinity Affinity, const char* Name) {
+        auto task = std::make_unique<impl::ClockedTask>(std::move(Task), Clock);
+        return t_lib::TaskManager<impl::UpdateFunctorType>::registerTask(
+            [task = std::move(task)](const Time Elapsed) { (*task)(Elapsed); }, Priority, Affinity, Name);
+    }
+    void runPhase(const t_lib::TaskPriorityRange& Range, const Time Elapsed) {
+        if(parallel_) t_lib::TaskManager<impl::UpdateFunctorType>::runParallelRange(AdminTy::jobs(), Range, Elapsed);
+        else          t_lib::TaskManager<impl::UpdateFunctorType>::runRange(Range, Elapsed);
+    }
     UpdateManager() = default;
+
+    bool parallel_ = false;
+    uint64_t frames_ = 0U;      // run の呼び出し回数
+    uint64_t sim_steps_ = 0U;   // シミュレーション(描画フェーズより前の優先度)のタスクを呼び出した回数
+    // 登録解除がこのクラスの破棄後にも行われるため共有
+    std::shared_ptr<impl::IntervalPhases> phases_ = std::make_shared<impl::IntervalPhases>();
+    std::shared_ptr<impl::IntervalPhases> sim_phases_ = std::make_shared<impl::IntervalPhases>();
+    TimerWheel timers_;
+    BudgetScheduler budget_;
+
+  // 固定タイムステップ
+    Time step_{};
+    uint32_t max_steps_ = 5U;
+    uint32_t render_phase_ = UpdateOrder::kRenderBegin;
+    Time accumulator_{};
+    double interpolation_ = 0.0;
+    uint32_t last_steps_ = 0U;
+    Time dropped_{};
+    t_lib::TaskGraph<impl::UpdateFunctorType> graph_;
+    std::optional<UpdateTaskInfo> graph_task_; // graph_ を実行するタスク(graph_ より先に破棄する)
 };
 
 } // namespace easy_engine
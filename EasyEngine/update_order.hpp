@@ -1,10 +1,10 @@
 ///
 /// \file   update_order.hpp
-/// \brief  XV`wb_
+/// \brief  更新順序定義ヘッダ
 ///
-///         XV}l[W[ɍXVo^ۂ́A
-///         D揇ʎwɎgp܂B
-///         Kvɍ킹ĕύXĂB
+///         更新マネージャーに更新処理を登録する際の、
+///         優先順位指定に使用します。
+///         必要に合わせて変更を加えてください。
 ///
 #ifndef INCLUDED_EGEG_UPDATE_ORDER_HEADER_
 #define INCLUDED_EGEG_UPDATE_ORDER_HEADER_
@@ -1,14 +1,14 @@
 ///
 /// \file   utility_function.hpp
-/// \brief  ֗ȃev[g֐Q`wb_
+/// \brief  少し便利なテンプレート関数群定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/7/27
-///             - wb_ǉ
-///             - arraySize<c>() `
-///             - enumValue<c>() `
+///             - ヘッダ追加
+///             - arraySize<…>() 定義
+///             - enumValue<…>() 定義
 ///
 #ifndef INCLUDED_EGEG_TLIB_UTILITY_FUNCTION_HEADER_
 #define INCLUDED_EGEG_TLIB_UTILITY_FUNCTION_HEADER_
@@ -19,17 +19,17 @@ namespace easy_engine {
 namespace t_lib {
 
 ///
-/// \brief  z̗vf擾
+/// \brief  配列の要素数を取得する
 ///
-///         gp)
+///         使用例)
 ///          int arr[10];
-///          size_t size = arraySize(arr);  c size == u10v
+///          size_t size = arraySize(arr);  … size == 「10」
 ///
-/// \tparam ElemTy : z̗vf^
-/// \tparam Size   : z̗vf
-/// \param[in]     : vf擾z
+/// \tparam ElemTy : 配列の要素型
+/// \tparam Size   : 配列の要素数
+/// \param[in]     : 要素数を取得する配列
 ///
-/// \return z̗vf
+/// \return 配列の要素数
 ///
 template <class ElemTy, size_t Size>
 inline constexpr size_t arraySize(const ElemTy(&)[Size]) noexcept {
@@ -37,20 +37,20 @@ inline constexpr size_t arraySize(const ElemTy(&)[Size]) noexcept {
 }
 
 ///
-/// \brief  b^ɕϊ񋓎q擾
+/// \brief  基礎型に変換した列挙子を取得する
 ///
-///         XR[vȂ񋓌^łXR[vt񋓌^ł삵܂B
-///         gp)
+///         スコープなし列挙型でもスコープ付き列挙型でも動作します。
+///         使用例)
 ///          enum class Hoge { Koreha, Rekkyosi, Dayo };
-///             c  c
+///             … 中略 …
 ///          auto v = enumValue(Hoge::Koreha);
 ///
-/// \tparam EnumTy   : 񋓌^
-/// \param[in] Value : ϊ񋓎q
+/// \tparam EnumTy   : 列挙型
+/// \param[in] Value : 変換する列挙子
 ///
-/// \return b^ɕϊ񋓎q̒l
+/// \return 基礎型に変換した列挙子の値
 ///
-/// \attention Value͗񋓎qłKv܂B
+/// \attention Valueは列挙子である必要があります。
 ///
 template <class EnumTy>
 inline constexpr auto enumValue(EnumTy Value) noexcept {
@@ -1,16 +1,16 @@
 ///
 /// \file   vertex_buffer.hpp
-/// \brief  _obt@`wb_
+/// \brief  頂点バッファ定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/9/1
-///             - wb_ǉ
-///             - VertexBuffer `
+///             - ヘッダ追加
+///             - VertexBuffer 定義
 ///
-/// \note   VertexBuffer KvȂ߁AftHg̃RXgN^`ĂȂB
-///         KvɉĒ`Ă悢B
+/// \note   VertexBuffer 必要性を感じないため、デフォルトのコンストラクタを定義していない。
+///         必要に応じて定義してもよい。
 ///
 #ifndef INCLUDED_EGEG_GLIB_VERTEX_BUFFER_HEADER_
 #define INCLUDED_EGEG_GLIB_VERTEX_BUFFER_HEADER_
@@ -28,43 +28,43 @@ namespace g_lib {
 
 ******************************************************************************/
 ///
-/// \brief  _obt@
+/// \brief  頂点バッファ
 ///
 class VertexBuffer {
 public :
     ///
-    /// \brief  ftHg̃RXgN^
+    /// \brief  デフォルトのコンストラクタ
     ///
-    ///         obt@͍쐬܂B
+    ///         バッファは作成しません。
     ///
     VertexBuffer() = default;
 
     ///
-    /// \brief  obt@̍쐬𔺂RXgN^
+    /// \brief  バッファの作成を伴うコンストラクタ
     ///
-    ///         ̃f[^ŏobt@ێ܂B
+    ///         引数のデータで初期化したバッファを保持します。
     ///
-    /// \param[in] Data : f[^
+    /// \param[in] Data : データ
     ///
     template <class DataTy>
     VertexBuffer(const std::vector<DataTy>& Data) :
       VertexBuffer{sizeof(DataTy)*Data.size(), D3D11_SUBRESOURCE_DATA{Data.data(), 0, 0}, sizeof(DataTy)} {}
 
     ///
-    /// \brief  LȒ_obt@ǂ
+    /// \brief  有効な頂点バッファかどうか判定
     ///
-    ///         true  : L
-    ///         false : 
+    ///         true  : 有効
+    ///         false : 無効
     ///
-    /// \return 茋
+    /// \return 判定結果
     ///
     bool isValid() const noexcept { return vbuf_; }
     operator bool() const noexcept { return isValid(); }
 
 
-    /// obt@IuWFNg擾
+    /// バッファオブジェクトを取得
     ID3D11Buffer* buffer() const noexcept { return vbuf_.Get(); }
-    /// 1vf̃TCY擾
+    /// 1要素のサイズを取得
     UINT stride() const noexcept { return stride_; }
 private :
     VertexBuffer(UINT, const D3D11_SUBRESOURCE_DATA&, UINT);
@@ -1,13 +1,13 @@
 ///
 /// \file   vertex_shader.hpp
-/// \brief  _VF[_[`wb_
+/// \brief  頂点シェーダー定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/8/28
-///             - wb_ǉ
-///             - VertexShader `
+///             - ヘッダ追加
+///             - VertexShader 定義
 ///
 #ifndef INCLUDED_EGEG_GLIB_VERTEX_SHADER_HEADER_
 #define INCLUDED_EGEG_GLIB_VERTEX_SHADER_HEADER_
@@ -24,16 +24,16 @@ namespace g_lib {
 
 ******************************************************************************/
 ///
-/// \brief  _VF[_[
+/// \brief  頂点シェーダー
 ///
-/// \par    ǂݍ݂xꍇ
-///         - ftHgRXgN^ō\zVF[_[ɑ
+/// \par    読み込みを遅延させたい場合
+///         - デフォルトコンストラクタで構築したシェーダーに代入
 ///           VertexShader vs{};
-///             c
-///           vs = VertexShader{"hogehoge.xxx", c};
+///             …
+///           vs = VertexShader{"hogehoge.xxx", …};
 ///
-/// \attention  ̃NXP̂łgpł܂AVF[_[Ƃɂ̃NXƂڍ׃NX`\n
-///             ǐオ܂AオƎv̂ł߂܂B\n
+/// \attention  このクラス単体でも使用できますが、シェーダーごとにこのクラスを基底とした詳細クラスを定義した方が\n
+///             可読性が上がりますし、可搬性も上がると思うのでお勧めします。\n
 ///
 class VertexShader {
 public :
@@ -41,28 +41,28 @@ public :
     VertexShader() = default;
 
     ///
-    /// \brief  ǂݍ݂𔺂RXgN^
+    /// \brief  読み込みを伴うコンストラクタ
     ///
-    /// \param[in] ShaderFilePath : ǂݍރVF[_[t@C̃pX
-    /// \param[in] InputLayout    : ǂݍޒ_VF[_[̓̓CAEg
+    /// \param[in] ShaderFilePath : 読み込むシェーダーファイルのパス
+    /// \param[in] InputLayout    : 読み込む頂点シェーダーの入力レイアウト
     ///
     VertexShader(const char* ShaderFilePath, const std::vector<D3D11_INPUT_ELEMENT_DESC>& InputLayout);
 
     ///
-    /// \brief  LȒ_VF[_[
+    /// \brief  有効な頂点シェーダーか判定
     ///
-    ///         true  : L
-    ///         false : 
+    ///         true  : 有効
+    ///         false : 無効
     ///
-    /// \return 茋
+    /// \return 判定結果
     ///
     bool isValid() const noexcept { return shader_ && layout_; }
     operator bool() const noexcept { return isValid(); }
 
     
-    /// VF[_[IuWFNg擾
+    /// シェーダーオブジェクトを取得
     ID3D11VertexShader* shader() const noexcept { return shader_.Get(); }
-    /// ̓CAEgIuWFNg擾
+    /// 入力レイアウトオブジェクトを取得
     ID3D11InputLayout* layout() const noexcept { return layout_.Get(); }
 protected :
     Microsoft::WRL::ComPtr<ID3D11VertexShader> shader_;
@@ -1,17 +1,17 @@
 ///
 /// \file   window_manager.hpp
-/// \brief  EBhE}l[W[NX`wb_
+/// \brief  ウィンドウマネージャークラス定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/8/25
-///             - wb_ǉ
-///             - WindowManager `
+///             - ヘッダ追加
+///             - WindowManager 定義
 ///
-/// \note   R[obN֐̓o^ɂ\n
-///         _ŕKvȂߒ`ĂȂB
-///         KvɉĒ`B
+/// \note   コールバック関数の登録解除について\n
+///         現時点で必要性を感じないため定義していない。
+///         必要に応じて定義する。
 ///
 #ifndef INCLUDED_EGEG_WINDOW_HEADER_
 #define INCLUDED_EGEG_WINDOW_HEADER_
@@ -32,30 +32,30 @@ class EasyEngine;
 
 ******************************************************************************/
 ///
-/// \brief  EBhE}l[W[
+/// \brief  ウィンドウマネージャー
 ///
-///         ̃NXւ̃ANZX́AEasyEngine::window()gpĂB
+///         このクラスへのアクセスは、EasyEngine::window()を使用してください。
 ///
 class WindowManager {
 public :
     friend EasyEngine;
 
     ///
-    /// \brief  EBhEnh擾
+    /// \brief  ウィンドウハンドルを取得
     ///
-    /// \return EBhEnh
+    /// \return ウィンドウハンドル
     ///
     HWND handle() const noexcept { return handle_; }
     
     ///
-    /// \brief  R[obN֐ǉ
+    /// \brief  コールバック関数を追加
     ///
-    ///         NX̃o֐płB
-    ///         EBhECxgƂɌĂяo֐ǉ܂B
+    ///         クラスのメンバ関数用です。
+    ///         ウィンドウイベントが発生したときに呼び出される関数を追加します。
     ///
-    /// \tparam OwnerTy : ǉ֐̃I[i[^
-    /// \param[in] Owner : ǉ֐̃I[i[
-    /// \param[in] Callback : ǉ֐
+    /// \tparam OwnerTy : 追加する関数のオーナー型
+    /// \param[in] Owner : 追加する関数のオーナー
+    /// \param[in] Callback : 追加する関数
     ///
     template <class OwnerTy>
     void addCallback(OwnerTy* Owner, void(OwnerTy::*Callback)(HWND, UINT, WPARAM, LPARAM)) {
@@ -63,12 +63,12 @@ public :
         addCallback(std::bind(Callback, Owner, _1, _2, _3, _4));
     }
     ///
-    /// \brief  R[obN֐ǉ
+    /// \brief  コールバック関数を追加
     ///
-    ///         EBhECxgƂɌĂяo֐ǉ܂B
+    ///         ウィンドウイベントが発生したときに呼び出される関数を追加します。
     ///
-    /// \tparam FTy : ǉ֐^
-    /// \param[in] Callback : ǉ֐
+    /// \tparam FTy : 追加する関数型
+    /// \param[in] Callback : 追加する関数
     ///
     template <class FTy>
     void addCallback(FTy&& Callback) {
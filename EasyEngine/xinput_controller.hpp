@@ -1,14 +1,14 @@
 ///
 /// \file   xinput_controller.hpp
-/// \brief  XInputGamePadpRg[[`wb_
+/// \brief  XInputGamePad用コントローラー定義ヘッダ
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/8/6
-///             - wb_ǉ
-///             - XInputCtrlerImpl `
-///             - XInputController `
+///             - ヘッダ追加
+///             - XInputCtrlerImpl 定義
+///             - XInputController 定義
 ///
 #ifndef INCLUDED_EGEG_ILIB_XINPUT_CONTROLLER_HEADER_
 #define INCLUDED_EGEG_ILIB_XINPUT_CONTROLLER_HEADER_
@@ -56,7 +56,7 @@ namespace i_lib {
         kRStick
     };
 
-    class XInputCtrlerImpl { // ev[go
+    class XInputCtrlerImpl { // 非テンプレート部抽出
     public :
         XInputCtrlerImpl(const XInputGamepad* Gamepad) noexcept : gamepad_{Gamepad} {}
         void resetGamepad(const XInputGamepad* Gamepad=nullptr) noexcept { gamepad_ = Gamepad; }
@@ -73,18 +73,18 @@ namespace i_lib {
 
 ******************************************************************************/
 ///
-/// \brief  XInputGamePadpRg[[
+/// \brief  XInputGamePad用コントローラー
 ///
-///         o^֐́A͂̏ԂŎ󂯎Kv܂B
-///         o^(map)ہA֐ɑΉL[w肷邱ƂŁA֐ɑΉL[̏Ԃn悤ɂȂ܂B
-///         ɃL[̎ނƓo^ł֐̌^܂B
-///         Buttons  : void (InputFlagType) c ɂ͑Ή{^̓͏ԃtOn܂B
-///         Triggers : void (float)         c ɂ́AΉgK[̓͒l([0.0F : 1.0F])n܂B
-///         Sticks   : void (float, float)  c ɂ́AΉXeBbN̓͒l([0.0F : 1.0F])n܂B
+///         登録する関数は、入力の状態を引数で受け取れる必要があります。
+///         登録(map)する際、関数に対応するキーを指定することで、関数に対応するキーの状態が渡されるようになります。
+///         ↓にキーの種類と登録できる関数の型を示します。
+///         Buttons  : void (InputFlagType) … 引数には対応するボタンの入力状態フラグが渡されます。
+///         Triggers : void (float)         … 引数には、対応するトリガーの入力値([0.0F : 1.0F])が渡されます。
+///         Sticks   : void (float, float)  … 引数には、対応するスティックの入力値([0.0F : 1.0F])が渡されます。
 ///
-/// \tparam TargetTy : Ώۂ̃IuWFNg^
+/// \tparam TargetTy : 操作対象のオブジェクト型
 ///
-/// \attention consto֐ ͓o^ł܂B
+/// \attention constメンバ関数 は登録できません。
 ///
 template <class TargetTy>
 class XInputController : public Controller<TargetTy>, public xcontroller_impl::XInputCtrlerImpl {
@@ -96,10 +96,10 @@ public :
     using XInputCtrlerImpl::getGamepad;
 
     ///
-    /// \brief  RXgN^
+    /// \brief  コンストラクタ
     ///
-    /// \param[in] Gamepad : ͂Q[pbh
-    /// \param[in] Target  : Ώ
+    /// \param[in] Gamepad : 入力を見るゲームパッド
+    /// \param[in] Target  : 操作対象
     ///
     XInputController(const XInputGamepad* Gamepad=nullptr, TargetTy* Target=nullptr) :
         Controller<TargetTy>{Target},
@@ -110,20 +110,20 @@ public :
     }
 
     ///
-    /// \brief  L[Ɗ֐̃}bsO
+    /// \brief  キーと関数のマッピング
     ///
-    ///         xɕ̃yA}bsO邱Ƃł܂B
-    ///         ̏ꍇ́AuL[, ֐|C^ṽyA𑱂ē͂ĂB
-    ///         )  cmap(ckDpadUp , &Hoge::jump,
-    ///                    ckA      , &Hoge::shot,
-    ///                    ckY      , &Hoge::pause);
+    ///         一度に複数のペアをマッピングすることができます。
+    ///         その場合は、「キー, 関数ポインタ」のペアを続けて入力してください。
+    ///         例)  …map(…kDpadUp , &Hoge::jump,
+    ///                    …kA      , &Hoge::shot,
+    ///                    …kY      , &Hoge::pause);
     ///
-    /// \tparam KeyTy     : L[̌^(Buttons, Triggers, Stickŝꂩ)
-    /// \tparam FTy       : }bv֐|C^̌^
-    /// \tparam RestTypes : c̃}bvyA^Xg
-    /// \param[in] Key      : ֐}bvL[
-    /// \param[in] Function : }bv֐
-    /// \param[in] Rest     : ̃yA
+    /// \tparam KeyTy     : キーの型(Buttons, Triggers, Sticksのいずれか)
+    /// \tparam FTy       : マップする関数ポインタの型
+    /// \tparam RestTypes : 残りのマップペア型リスト
+    /// \param[in] Key      : 関数をマップするキー
+    /// \param[in] Function : マップする関数
+    /// \param[in] Rest     : 他のペア
     /// 
     template<class KeyTy, class FTy, class ...RestTypes>
     void map(const KeyTy Key, const FTy Function, RestTypes ...Rest) noexcept {
@@ -132,16 +132,16 @@ public :
     }
 
     ///
-    /// \brief  L[Ɗ֐̃}bv
+    /// \brief  キーと関数のマップを解除
     ///
-    ///         xɕ̃}bv邱Ƃł܂B
-    ///         ̏ꍇ́AL[𑱂ē͂ĂB
-    ///         ) cunmap(ckDpadUp, ckA);
+    ///         一度に複数のマップを解除することができます。
+    ///         その場合は、解除したいキーを続けて入力してください。
+    ///         例) …unmap(…kDpadUp, …kA);
     ///
-    /// \tparam KeyTy        : L[̌^(Buttons, Triggers, Stickŝꂩ)
-    /// \tparam RestKeyTypes : c̃L[̌^
-    /// \param[in] Key   : ֐Ƃ̃}bvL[
-    /// \param[in] Rests : ǉŉL[
+    /// \tparam KeyTy        : キーの型(Buttons, Triggers, Sticksのいずれか)
+    /// \tparam RestKeyTypes : 残りのキーの型
+    /// \param[in] Key   : 関数とのマップを解除するキー
+    /// \param[in] Rests : 追加で解除するキー
     ///
     template <class KeyTy, class ...RestKeyTypes>
     void unmap(const KeyTy Key, const RestKeyTypes ...Rests) noexcept {
@@ -191,7 +191,7 @@ private :
       (std::is_same_v<InvalidKTy, Buttons>&&!std::is_convertible_v<InvalidFTy, void(TargetTy::*)(InputFlagType)>) ||
       (std::is_same_v<InvalidKTy, Triggers>&&!std::is_convertible_v<InvalidFTy, void(TargetTy::*)(float)>) ||
       (std::is_same_v<InvalidKTy, Sticks>&&!std::is_convertible_v<InvalidFTy, void(TargetTy::*)(float, float)>)>>
-    void mapImpl(const InvalidKTy, const InvalidFTy) const noexcept { // OẅႢ͋x
+    void mapImpl(const InvalidKTy, const InvalidFTy) const noexcept { // 例外指定の違いは許可x
         static_assert(false, "such key or such function pointer is not supported");
     }
     void mapImpl(const Buttons Button, void(TargetTy::*Function)(InputFlagType)) noexcept {
@@ -1,4 +1,4 @@
-// 쐬 : 
+// 作成者 : 板場
 /******************************************************************************
 
     include
@@ -36,7 +36,7 @@ namespace {
     constexpr float adjustStick(const SHORT Raw, const int DeadZone) noexcept { 
         if(Raw<DeadZone && Raw>-DeadZone) return 0.0F;
         const float result = normalizeStick(Raw);
-        return result<-1.0F ? -1.0F : result; // K̍ہA}CiXɃI[o[\
+        return result<-1.0F ? -1.0F : result; // 正規化の際、マイナス方向にオーバーする可能性がある
     }
     constexpr bool isStickUp(const float Y) noexcept    { return Y>0 ? detectStickInput(Y) : false; }
     constexpr bool isStickDown(const float Y) noexcept  { return Y<0 ? detectStickInput(Y) : false; }
@@ -55,8 +55,8 @@ void xinput_ns::XInputGamepad::updateState(const DWORD User) {
     if( XInputGetState(User, &curr_state)==ERROR_SUCCESS) {
         state_.connected = true;
         if(curr_state.dwPacketNumber!=last_state_.dwPacketNumber) {
-          // {^
-            // note : tOVtgďPɂ悤ƍlAtO̒lłӏ̂ŒfO
+          // ボタン
+            // note : フラグをシフトさせて処理を単純にしようかと考えたが、フラグの値が飛んでいる箇所があるので断念
             const WORD last_buttons = last_state_.Gamepad.wButtons;
             const WORD curr_buttons = curr_state.Gamepad.wButtons;
             state_.dpad_up = newButtonState(last_buttons, curr_buttons, XINPUT_GAMEPAD_DPAD_UP);
@@ -73,10 +73,10 @@ void xinput_ns::XInputGamepad::updateState(const DWORD User) {
             state_.b = newButtonState(last_buttons, curr_buttons, XINPUT_GAMEPAD_B);
             state_.x = newButtonState(last_buttons, curr_buttons, XINPUT_GAMEPAD_X);
             state_.y = newButtonState(last_buttons, curr_buttons, XINPUT_GAMEPAD_Y);
-          // gK[
+          // トリガー
             state_.ltrigger = normalizeTrigger(curr_state.Gamepad.bLeftTrigger);
             state_.rtrigger = normalizeTrigger(curr_state.Gamepad.bRightTrigger);
-          // XeBbN
+          // スティック
             const float last_lx = state_.lthumbstick_x; // [0.0F : 1.0F]
             const float last_ly = state_.lthumbstick_y; // [0.0F : 1.0F]
             const float last_rx = state_.rthumbstick_x; // [0.0F : 1.0F]
@@ -94,17 +94,17 @@ void xinput_ns::XInputGamepad::updateState(const DWORD User) {
             state_.rstick_left = newState(isStickLeft(last_rx), isStickLeft(state_.rthumbstick_x));
             state_.rstick_right = newState(isStickRight(last_rx), isStickRight(state_.rthumbstick_x));
            
-            // XVpɏԂۑ
+            // 次更新時用に状態を保存
             last_state_ = curr_state;
         }
         else {
-          // Rg[[̕ύXȂ(Down, UptO邾)
+          // コントローラーの変更なし(Down, Upフラグ下げるだけ)
             for(int i=&state_.y-&state_.dpad_up; i>=0; --i)
                 *(&state_.dpad_up+i) &= ~(kDown|kUp);
         }
     }
     else 
-        // foCXڑĂȂ
+        // デバイスが接続されていない
         state_.connected = false;
 }
 // EOF
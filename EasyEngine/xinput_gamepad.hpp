@@ -1,22 +1,25 @@
 ///
 /// \file   xinput_gamepad.hpp
-/// \brief  ̓foCXuXInputQ[pbhv`wb_
+/// \brief  入力デバイス「XInputゲームパッド」定義ヘッダ
 ///
-///         XInputP1, XInputP2, XInputP3, XInputP4ۂɎgp邱ƂɂȂ^łB
-///         ͏ԍXVɂ͊eNXo֐ update()ĂяoĂB
+///         XInputP1, XInputP2, XInputP3, XInputP4が実際に使用することになる型です。
+///         入力状態更新には各クラスメンバ関数 update()を呼び出してください。
 ///
-/// \author 
+/// \author 板場
 ///
-/// \par    
+/// \par    履歴
 ///         - 2020/8/5
-///             - wb_ǉ
-///             - XInputGamepad `
-///             - XInputGamepadImpl `
-///             - XInputP1, XInputP2, XInputP3, XInputP4 `
+///             - ヘッダ追加
+///             - XInputGamepad 定義
+///             - XInputGamepadImpl 定義
+///             - XInputP1, XInputP2, XInputP3, XInputP4 定義
+///         - 2026/10/19
+///             - 入力状態の保存、復元に対応
 ///
 #ifndef INCLUDED_EGEG_ILIB_XINPUT_GAMEPAD_HEADER_
 #define INCLUDED_EGEG_ILIB_XINPUT_GAMEPAD_HEADER_
 
+#include <cstring>
 #include <Windows.h> // target platform
 #include <Xinput.h>
 #include "input_device.hpp"
@@ -30,22 +33,22 @@ namespace i_lib {
 
 ******************************************************************************/
 ///
-/// \brief  XInput̓foCX
+/// \brief  XInput入力デバイス
 ///
-///         ̃NX̓CX^Xł܂B
-///         ۂGamepad̓͂擾ꍇ́Aȉ̌^gpĕϐ`Kv܂B
+///         このクラスはインスタンス化できません。
+///         実際にGamepadからの入力を取得する場合は、以下の型を使用して変数を定義する必要があります。
 ///         XInputP1, XInputP2, XInputP3, XInputP4
 /// 
 class XInputGamepad : public InputDevice {
 public :
     ///
-    /// \struct ͏Ԋi[p\
+    /// \struct 入力状態格納用構造体
     ///
-    /// \details ꂼ̃oA̖OL[̏Ԃi[Ă܂B\n
-    ///          egeg::i_lib OԂɂis~~ ֐gp邱ƂŊȒPɏԂ𒲂ׂ邱Ƃł܂B
+    /// \details それぞれのメンバが、その名前が示すキーの状態を格納しています。\n
+    ///          egeg::i_lib 名前空間にあるis~~ 関数を使用することで簡単に状態を調べることができます。
     ///
     struct State {
-        bool connected; ///< true:ڑς݁@false:ڑȂ
+        bool connected; ///< true:接続済み　false:接続なし
 
         InputFlagType dpad_up;
         InputFlagType dpad_down;
@@ -70,21 +73,26 @@ public :
         InputFlagType x;
         InputFlagType y;
 
-        float ltrigger;      ///< ͈ - [0.0F : 1.0F]
-        float rtrigger;      ///< ͈ - [0.0F : 1.0F]
-        float lthumbstick_x; ///< ͈ - [0.0F : 1.0F]
-        float lthumbstick_y; ///< ͈ - [0.0F : 1.0F]
-        float rthumbstick_x; ///< ͈ - [0.0F : 1.0F]
-        float rthumbstick_y; ///< ͈ - [0.0F : 1.0F]
+        float ltrigger;      ///< 範囲 - [0.0F : 1.0F]
+        float rtrigger;      ///< 範囲 - [0.0F : 1.0F]
+        float lthumbstick_x; ///< 範囲 - [0.0F : 1.0F]
+        float lthumbstick_y; ///< 範囲 - [0.0F : 1.0F]
+        float rthumbstick_x; ///< 範囲 - [0.0F : 1.0F]
+        float rthumbstick_y; ///< 範囲 - [0.0F : 1.0F]
     };
 
     ///
-    /// \brief  ͏Ԃ擾
+    /// \brief  入力状態を取得
     ///
-    /// \return ͏Ԃi[\
+    /// \return 入力状態を格納した構造体
     ///
     const State& getState() const noexcept { return state_; }
 
+// override
+    size_t stateSize() const noexcept override { return sizeof(State); }
+    void saveState(void* Dest) const noexcept override { std::memcpy(Dest, &state_, sizeof(State)); }
+    void loadState(const void* Src) noexcept override { std::memcpy(&state_, Src, sizeof(State)); }
+
 protected :
     void updateState(DWORD);
     State state_{};
@@ -99,10 +107,10 @@ protected :
     };
   } // namespace xinput_impl_ns
   
-using XInputP1 = xinput_impl_ns::XInputGamepadImpl<0UL>; ///< Q[pbh0
-using XInputP2 = xinput_impl_ns::XInputGamepadImpl<1UL>; ///< Q[pbh1
-using XInputP3 = xinput_impl_ns::XInputGamepadImpl<2UL>; ///< Q[pbh2
-using XInputP4 = xinput_impl_ns::XInputGamepadImpl<3UL>; ///< Q[pbh3
+using XInputP1 = xinput_impl_ns::XInputGamepadImpl<0UL>; ///< ゲームパッド0
+using XInputP2 = xinput_impl_ns::XInputGamepadImpl<1UL>; ///< ゲームパッド1
+using XInputP3 = xinput_impl_ns::XInputGamepadImpl<2UL>; ///< ゲームパッド2
+using XInputP4 = xinput_impl_ns::XInputGamepadImpl<3UL>; ///< ゲームパッド3
 
 } // namespace i_lib
 } // namespace easy_engine
@@ -0,0 +1,121 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include <array>
+#include <cstdint>
+#include "budget_scheduler.hpp"
+#include "test.hpp"
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace egeg_ns = easy_engine;
+namespace {
+    constexpr int kAttempts = 50;
+    egeg_ns::Time max_overrun;  // タスクが渡された時間を超過した時間の最大
+
+    // 渡された時間を使い切り、常に作業が残っているタスク
+    bool consumeAll(const egeg_ns::TaskBudget& Budget) {
+        while(!Budget.exhausted()) {}
+        const egeg_ns::Time overrun = Budget.elapsed() - Budget.budget();
+        if(overrun > max_overrun) max_overrun = overrun;
+        return true;
+    }
+
+    template <size_t N>
+    struct Tasks {
+        explicit Tasks(egeg_ns::BudgetScheduler& Scheduler) : scheduler{Scheduler} {
+            for(uint32_t i=0; i<N; ++i) infos[i] = Scheduler.registerTask(&consumeAll, i+1U);
+        }
+        const egeg_ns::BudgetedTaskStats& stats(const size_t Index) const { return *scheduler.stats(infos[Index]); }
+
+        egeg_ns::BudgetScheduler& scheduler;
+        std::array<egeg_ns::BudgetedTaskInfo, N> infos;
+    };
+
+    // Frames フレーム実行する
+    //  スレッドが横取りされる等で、渡された時間を超過したタスクがあった場合 false
+    //  (呼び出しの保証の前提が崩れるため、やり直す)
+    bool runFrames(egeg_ns::BudgetScheduler& Scheduler, const uint32_t Frames) {
+        max_overrun = egeg_ns::Time{};
+        for(uint32_t i=0; i<Frames; ++i) Scheduler.run();
+        return max_overrun <= egeg_ns::Time{egeg_ns::Microseconds{30}};
+    }
+
+    // 飢餓閾値 0 : 作業の残っている全てのタスクを毎フレーム呼び出す
+    bool everyFrame() {
+        egeg_ns::BudgetScheduler scheduler;
+        scheduler.setStarvationLimit(0U);
+        Tasks<4> tasks{scheduler};
+        if(!runFrames(scheduler, 8U)) return false;
+
+        for(size_t i=0; i<4; ++i) {
+            EGEG_CHECK(tasks.stats(i).runs == 8U);
+            EGEG_CHECK(tasks.stats(i).max_starved_frames == 0U);
+        }
+        return true;
+    }
+
+    // 飢餓閾値 N : 飢餓状態のフレーム数は N を超えない
+    bool starvationBound(const uint32_t Limit) {
+        egeg_ns::BudgetScheduler scheduler;
+        scheduler.setStarvationLimit(Limit);
+        Tasks<4> tasks{scheduler};
+        if(!runFrames(scheduler, (Limit+1U)*4U)) return false;
+
+        for(size_t i=0; i<4; ++i) {
+            EGEG_CHECK(tasks.stats(i).runs >= 4U);
+            EGEG_CHECK(tasks.stats(i).max_starved_frames <= Limit);
+        }
+        return true;
+    }
+
+    // 予算/MinSlice 個を超えるタスクが飢餓状態になっても、順番に全て呼び出す
+    //  予算 1.6ms, MinSlice 300us : 1フレームで飢餓状態のタスクを5つまで呼び出せる
+    bool rotation() {
+        constexpr uint32_t kLimit = 2U;
+        constexpr uint32_t kTasks = 12U;
+        constexpr uint32_t kFrames = 24U;
+        egeg_ns::BudgetScheduler scheduler;
+        scheduler.setBudget(0.1, egeg_ns::Microseconds{300});
+        scheduler.setStarvationLimit(kLimit);
+        Tasks<kTasks> tasks{scheduler};
+        if(!runFrames(scheduler, kFrames)) return false;
+
+        const auto per_frame = static_cast<uint32_t>(scheduler.budget().nanoseconds() / 300000);
+        const uint32_t bound = kLimit + (kTasks+per_frame-1U) / per_frame;
+        for(size_t i=0; i<kTasks; ++i) {
+            EGEG_CHECK(tasks.stats(i).runs >= kFrames / (bound+1U));
+            EGEG_CHECK(tasks.stats(i).max_starved_frames <= bound);
+        }
+        return true;
+    }
+
+    // タスクが渡された時間を超過しなかった試行で確認する
+    template <class FTy>
+    void attempt(const char* Name, FTy&& Test) {
+        for(int i=0; i<kAttempts; ++i) if(Test()) return;
+        std::printf("%s : skipped (every attempt overran the task budget)\n", Name);
+    }
+} // unnamed namespace
+
+
+/******************************************************************************
+
+    main
+
+******************************************************************************/
+int main() {
+    attempt("everyFrame", everyFrame);
+    for(const uint32_t limit : {1U, 2U, 4U, 7U})
+        attempt("starvationBound", [limit] { return starvationBound(limit); });
+    attempt("rotation", rotation);
+    return egeg_test::result("budget_scheduler_test");
+}
+// EOF
@@ -0,0 +1,186 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+#include "convex_collision.hpp"
+#include "job_system.hpp"
+#include "test.hpp"
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace egeg_ns = easy_engine;
+namespace {
+    using egeg_ns::m_lib::Vector3D;
+    using egeg_ns::m_lib::Matrix3x4;
+    using egeg_ns::p_lib::ConvexShape;
+    using egeg_ns::p_lib::ConvexPair;
+    using egeg_ns::p_lib::ContactResult;
+    using egeg_ns::p_lib::GjkCache;
+    using egeg_ns::p_lib::NarrowPhaseStats;
+
+    // 判定する形状(球、直方体、カプセル、凸包)
+    struct Shapes {
+        Shapes() {
+            std::mt19937 rng{7U};
+            std::uniform_real_distribution<float> dist{-1.0F, 1.0F};
+            for(auto& v : hull_vertices) { // 単位球面上の点の凸包
+                Vector3D p{dist(rng), dist(rng), dist(rng)};
+                const float len = std::sqrt(p.x*p.x + p.y*p.y + p.z*p.z);
+                v = len > 0.0F ? Vector3D{p.x/len, p.y/len, p.z/len} : Vector3D{1.0F, 0.0F, 0.0F};
+            }
+            list[0] = ConvexShape::sphere(0.5F);
+            list[1] = ConvexShape::box(Vector3D{0.5F, 0.3F, 0.4F});
+            list[2] = ConvexShape::capsule(0.25F, 0.5F);
+            list[3] = ConvexShape::hull(hull_vertices, 32U, 0.05F);
+        }
+        Vector3D hull_vertices[32];
+        ConvexShape list[4];
+    };
+
+    // 回転(軸 Axis 周りに Angle)と平行移動 Position の変換
+    Matrix3x4 transform(const Vector3D& Axis, const float Angle, const Vector3D& Position) {
+        const float len = std::sqrt(Axis.x*Axis.x + Axis.y*Axis.y + Axis.z*Axis.z);
+        const float x = Axis.x/len, y = Axis.y/len, z = Axis.z/len;
+        const float c = std::cos(Angle), s = std::sin(Angle), t = 1.0F - c;
+        return Matrix3x4{
+            t*x*x + c,   t*x*y - s*z, t*x*z + s*y, Position.x,
+            t*x*y + s*z, t*y*y + c,   t*y*z - s*x, Position.y,
+            t*x*z - s*y, t*y*z + s*x, t*z*z + c,   Position.z};
+    }
+
+    // 姿勢と相対位置を乱数で決めたペア
+    //  中心間の距離を [0.2, 1.8] とし、交差するペア(EPA)と離れたペア(GJKのみ)を混在させる
+    struct Scene {
+        Scene(const Shapes& Set, const size_t NumPairs) : caches(NumPairs) {
+            std::mt19937 rng{42U};
+            std::uniform_real_distribution<float> dist{-1.0F, 1.0F};
+            std::uniform_real_distribution<float> gap{0.2F, 1.8F};
+            for(size_t i=0; i<NumPairs; ++i) {
+                Body a{&Set.list[i%4U], {dist(rng), dist(rng), dist(rng)}, dist(rng)*3.0F, {}};
+                Body b{&Set.list[i/4U%4U], {dist(rng), dist(rng), dist(rng)}, dist(rng)*3.0F, {}};
+                Vector3D dir{dist(rng), dist(rng), dist(rng)};
+                const float len = std::sqrt(dir.x*dir.x + dir.y*dir.y + dir.z*dir.z) + 1.0e-6F;
+                const float d = gap(rng);
+                a.position = Vector3D{static_cast<float>(i), 0.0F, 0.0F};
+                b.position = Vector3D{a.position.x + dir.x/len*d, dir.y/len*d, dir.z/len*d};
+                a.axis = nonZero(a.axis);
+                b.axis = nonZero(b.axis);
+                bodies.push_back(a);
+                bodies.push_back(b);
+            }
+            pairs.resize(NumPairs);
+            update(0.0F, false);
+        }
+
+        // 姿勢を Offset だけ回転させたペアを作る(フレーム間の小さな動き)
+        void update(const float Offset, const bool UseCache) {
+            for(size_t i=0; i<pairs.size(); ++i) {
+                const Body& a = bodies[i*2U];
+                const Body& b = bodies[i*2U+1U];
+                pairs[i] = ConvexPair{
+                    a.shape, transform(a.axis, a.angle + Offset, a.position),
+                    b.shape, transform(b.axis, b.angle - Offset, b.position),
+                    UseCache ? &caches[i] : nullptr};
+            }
+        }
+
+        struct Body {
+            const ConvexShape* shape;
+            Vector3D axis;
+            float angle;
+            Vector3D position;
+        };
+        static Vector3D nonZero(const Vector3D& V) {
+            return std::fabs(V.x)+std::fabs(V.y)+std::fabs(V.z) > 1.0e-3F ? V : Vector3D{0.0F, 1.0F, 0.0F};
+        }
+
+        std::vector<Body> bodies;
+        std::vector<ConvexPair> pairs;
+        std::vector<GjkCache> caches;
+    };
+
+    // Frames フレーム分判定し、統計を合計する
+    //  UseCache が true の場合、ペア毎の単体キャッシュをフレーム間で引き継ぐ
+    NarrowPhaseStats measure(egeg_ns::t_lib::JobSystem& Jobs, Scene& Target, const uint32_t Frames,
+                             const bool UseCache, std::vector<ContactResult>& Results) {
+        for(auto& cache : Target.caches) cache = GjkCache{};
+        NarrowPhaseStats total{};
+        for(uint32_t f=0; f<Frames; ++f) {
+            Target.update(0.01F*f, UseCache);
+            const NarrowPhaseStats stats = egeg_ns::p_lib::detectContacts(Jobs, Target.pairs, Results);
+            total.num_pairs += stats.num_pairs;
+            total.gjk_iterations += stats.gjk_iterations;
+            total.epa_iterations += stats.epa_iterations;
+            total.elapsed += stats.elapsed;
+        }
+        return total;
+    }
+
+    void report(const char* Name, const size_t Threads, const NarrowPhaseStats& Stats) {
+        const double pairs = Stats.num_pairs ? static_cast<double>(Stats.num_pairs) : 1.0;
+        std::printf("%-12s : %2zu threads : %9zu pairs  GJK %5.2f  EPA %5.2f  avg iterations %5.2f  %7.1f ns/pair\n",
+            Name, Threads, Stats.num_pairs, Stats.gjk_iterations/pairs, Stats.epa_iterations/pairs,
+            Stats.averageIterations(), Stats.nanosecondsPerPair());
+    }
+
+    // 球同士のペアは、距離を解析解と比較する
+    void checkSpheres(const Scene& Target, const std::vector<ContactResult>& Results) {
+        for(size_t i=0; i<Target.pairs.size(); i+=16U) { // i%4 == 0 かつ i/4%4 == 0 のペアは球同士
+            const Vector3D& pa = Target.bodies[i*2U].position;
+            const Vector3D& pb = Target.bodies[i*2U+1U].position;
+            const float dx = pb.x-pa.x, dy = pb.y-pa.y, dz = pb.z-pa.z;
+            const float expected = std::sqrt(dx*dx + dy*dy + dz*dz) - 1.0F;
+            EGEG_CHECK(std::fabs(Results[i].distance - expected) < 1.0e-3F);
+            EGEG_CHECK(Results[i].intersect == (expected < 0.0F));
+        }
+    }
+} // unnamed namespace
+
+
+/******************************************************************************
+
+    main
+
+******************************************************************************/
+int main(int Argc, char** Argv) {
+    const size_t num_pairs = Argc > 1 ? std::strtoull(Argv[1], nullptr, 10) : 100000U;
+    const uint32_t frames = Argc > 2 ? static_cast<uint32_t>(std::strtoul(Argv[2], nullptr, 10)) : 10U;
+
+    const Shapes shapes;
+    Scene scene{shapes, num_pairs};
+    std::vector<ContactResult> results;
+
+    // ジョブシステムに属していないスレッドからの呼び出しは逐次判定になる
+    egeg_ns::t_lib::JobSystem jobs;
+    auto run = [&](const size_t Threads) {
+        const NarrowPhaseStats cold = measure(jobs, scene, frames, false, results);
+        report("cold", Threads, cold);
+        const NarrowPhaseStats warm = measure(jobs, scene, frames, true, results);
+        report("warm cache", Threads, warm);
+
+        // 前フレームの単体から再開するため、反復回数は減る
+        EGEG_CHECK(warm.gjk_iterations <= cold.gjk_iterations);
+        EGEG_CHECK(cold.num_pairs == num_pairs*frames);
+    };
+    std::thread{run, size_t{1}}.join();
+    run(jobs.numThreads());
+
+    scene.update(0.0F, false);
+    egeg_ns::p_lib::detectContacts(jobs, scene.pairs, results);
+    checkSpheres(scene, results);
+    return egeg_test::result("convex_collision_bench");
+}
+// EOF
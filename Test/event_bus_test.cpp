@@ -0,0 +1,133 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "event_bus.hpp"
+#include "test.hpp"
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace egeg_ns = easy_engine;
+namespace {
+    using egeg_ns::t_lib::EventBus;
+    using egeg_ns::t_lib::EventSpan;
+
+    struct Damage { uint32_t target; int amount; };
+    struct Heal { uint32_t target; int amount; };
+    struct Unused { int value; };
+
+    // 溜めたイベントは dispatch でまとめて1回の呼び出しで配信される
+    void batchedDispatch() {
+        EventBus bus;
+        std::vector<size_t> batches;
+        int total = 0;
+        auto sub = bus.subscribe<Damage>([&](const EventSpan<Damage> Events) {
+            batches.push_back(Events.size());
+            for(auto& damage : Events) total += damage.amount;
+        });
+
+        bus.publish(Damage{1U, 10});
+        bus.emplace<Damage>(2U, 20);
+        bus.publish(Damage{3U, 30});
+        EGEG_CHECK(bus.pending<Damage>() == 3U);
+        EGEG_CHECK(batches.empty());
+
+        bus.dispatch();
+        EGEG_CHECK((batches == std::vector<size_t>{3U}));
+        EGEG_CHECK(total == 60);
+        EGEG_CHECK(bus.pending<Damage>() == 0U);
+
+        // 溜まっていなければ呼び出さない
+        bus.dispatch<Damage>();
+        EGEG_CHECK(batches.size() == 1U);
+
+        // 解除後は配信されない
+        sub.unsubscribe();
+        EGEG_CHECK(!sub.isSubscribed());
+        bus.publish(Damage{1U, 5});
+        bus.dispatch();
+        EGEG_CHECK(total == 60);
+    }
+
+    // 発行も購読もしていない型の pending<…>, dispatch<…> は 0 を返すだけで、チャンネルを作成しない
+    //  作成されると、その型が配信順の先頭になる
+    void pendingWithoutChannel() {
+        EventBus bus;
+        std::string order;
+        EGEG_CHECK(bus.pending<Unused>() == 0U);
+        EGEG_CHECK(bus.pending<Damage>() == 0U);
+        bus.dispatch<Damage>();
+        const EventBus& const_bus = bus;
+        EGEG_CHECK(const_bus.pending<Damage>() == 0U);
+
+        // Damage のチャンネルは最初の購読で作成されるため、配信は Heal の後
+        auto heal = bus.subscribe<Heal>([&order](EventSpan<Heal>) { order += 'H'; });
+        auto damage = bus.subscribe<Damage>([&order](EventSpan<Damage>) { order += 'D'; });
+        bus.publish(Damage{1U, 10});
+        bus.publish(Heal{1U, 5});
+        EGEG_CHECK(bus.pending<Damage>() == 1U);
+        EGEG_CHECK(bus.pending<Heal>() == 1U);
+        bus.dispatch();
+        EGEG_CHECK(order == "HD");
+        EGEG_CHECK(bus.pending<Unused>() == 0U);
+    }
+
+    // 配信中に発行したイベントは次回の dispatch で配信し、即時モードでは発行時に配信する
+    void publishDuringDispatch() {
+        EventBus bus;
+        std::vector<int> received;
+        EventBus::Handler<Damage> handler = [&](const EventSpan<Damage> Events) {
+            for(auto& damage : Events) {
+                received.push_back(damage.amount);
+                if(damage.amount < 3) bus.publish(Damage{0U, damage.amount+1});
+            }
+        };
+        auto sub = bus.subscribe<Damage>(std::move(handler));
+
+        bus.publish(Damage{0U, 1});
+        bus.dispatch();
+        EGEG_CHECK((received == std::vector<int>{1}));
+        EGEG_CHECK(bus.pending<Damage>() == 1U);
+        bus.dispatch();
+        EGEG_CHECK((received == std::vector<int>{1, 2}));
+
+        // 有効にした時点で溜まっているイベントは、次回の dispatch で配信する
+        bus.setImmediate<Damage>(true);
+        EGEG_CHECK(bus.pending<Damage>() == 1U);
+        bus.publish(Damage{0U, 10});
+        EGEG_CHECK((received == std::vector<int>{1, 2, 10}));
+        bus.dispatch();
+        EGEG_CHECK((received == std::vector<int>{1, 2, 10, 3}));
+        EGEG_CHECK(bus.pending<Damage>() == 0U);
+
+        // clear は配信せずに破棄する
+        bus.setImmediate<Damage>(false);
+        bus.publish(Damage{0U, 100});
+        bus.clear();
+        bus.dispatch();
+        EGEG_CHECK(received.size() == 4U);
+    }
+} // unnamed namespace
+
+
+/******************************************************************************
+
+    main
+
+******************************************************************************/
+int main() {
+    batchedDispatch();
+    pendingWithoutChannel();
+    publishDuringDispatch();
+    return egeg_test::result("event_bus_test");
+}
+// EOF
@@ -0,0 +1,146 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+#include "frame_arena.hpp"
+#include "test.hpp"
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace egeg_ns = easy_engine;
+namespace {
+    constexpr size_t kBlockSize = 4096U;
+
+    bool aligned(const void* Ptr, const size_t Alignment) noexcept {
+        return reinterpret_cast<uintptr_t>(Ptr) % Alignment == 0U;
+    }
+
+    // バッファ数のフレームが経過すると、同じ領域を先頭から再利用する
+    void rewind() {
+        for(uint32_t buffers=1U; buffers<=egeg_ns::FrameArena::kMaxBuffers; ++buffers) {
+            egeg_ns::FrameArena arena{buffers, kBlockSize};
+            std::vector<void*> first;
+            for(uint32_t f=0; f<buffers; ++f) {
+                first.push_back(arena.allocate(64U));
+                arena.nextFrame();
+            }
+            // 有効期間中のバッファは別の領域
+            for(uint32_t i=0; i<first.size(); ++i)
+                for(uint32_t j=i+1U; j<first.size(); ++j) EGEG_CHECK(first[i] != first[j]);
+
+            for(uint32_t f=0; f<buffers*2U; ++f) {
+                EGEG_CHECK(arena.allocate(64U) == first[f % buffers]);
+                arena.nextFrame();
+            }
+            const auto stats = arena.stats();
+            EGEG_CHECK(stats.frames == buffers*3U);
+            EGEG_CHECK(stats.last_frame_bytes == 64U);
+            EGEG_CHECK(stats.reserved_bytes == kBlockSize*buffers);
+            EGEG_CHECK(stats.threads == 1U);
+        }
+    }
+
+    // ブロックより大きい確保は専用のブロックを追加し、再利用時に1つのブロックにまとめる
+    void oversize() {
+        egeg_ns::FrameArena arena{2U, kBlockSize};
+        auto frame = [&arena] {
+            auto* small = static_cast<std::byte*>(arena.allocate(100U));
+            auto* large = static_cast<std::byte*>(arena.allocate(kBlockSize*3U));
+            auto* after = static_cast<std::byte*>(arena.allocate(100U));
+            large[0] = large[kBlockSize*3U-1U] = std::byte{1}; // 全体が書き込める
+            EGEG_CHECK(large+kBlockSize*3U <= after || after+100U <= large);
+            EGEG_CHECK(small+100U <= large || large+kBlockSize*3U <= small);
+            arena.nextFrame();
+        };
+
+        frame();
+        const size_t grown = arena.stats().reserved_bytes;
+        EGEG_CHECK(grown > kBlockSize);
+        EGEG_CHECK(arena.stats().peak_frame_bytes == kBlockSize*3U + 200U);
+
+        // 2つ目のバッファも同様に増え、以降は増えない
+        frame();
+        const size_t both = arena.stats().reserved_bytes;
+        EGEG_CHECK(both == grown*2U);
+        for(int i=0; i<6; ++i) frame();
+        EGEG_CHECK(arena.stats().reserved_bytes == both);
+    }
+
+    // 指定したアラインメントを満たし、0 バイトの確保も重ならない有効なポインタを返す
+    void alignment() {
+        egeg_ns::FrameArena arena{2U, kBlockSize};
+        for(size_t align=1U; align<=4096U; align*=2U) {
+            static_cast<void>(arena.allocate(1U, 1U)); // 揃っていない位置にずらす
+            void* ptr = arena.allocate(align*3U, align);
+            EGEG_CHECK(aligned(ptr, align));
+        }
+
+        // 新しいアリーナ(ブロック未確保)での 0 バイト
+        egeg_ns::FrameArena fresh{2U, kBlockSize};
+        void* const zero = fresh.allocate(0U, 16U);
+        void* const zero2 = fresh.allocate(0U, 16U);
+        EGEG_CHECK(zero != nullptr);
+        EGEG_CHECK(zero != zero2);
+        EGEG_CHECK(aligned(zero, 16U) && aligned(zero2, 16U));
+
+        // pmr コンテナ
+        std::pmr::vector<double> values(&arena);
+        for(int i=0; i<1000; ++i) values.push_back(i*0.5);
+        EGEG_CHECK(values[999] == 499.5);
+        EGEG_CHECK(aligned(values.data(), alignof(double)));
+    }
+
+    // スレッド毎に別の領域から確保し、確保中に統計を取得できる
+    void threads() {
+        egeg_ns::FrameArena arena{2U, kBlockSize};
+        constexpr int kThreads = 4;
+        std::atomic<bool> overlapped{false};
+        std::vector<std::thread> workers;
+        for(int t=0; t<kThreads; ++t) {
+            workers.emplace_back([&arena, &overlapped, t] {
+                for(int i=0; i<2000; ++i) {
+                    auto* ptr = static_cast<unsigned char*>(arena.allocate(24U, 8U));
+                    for(int b=0; b<24; ++b) ptr[b] = static_cast<unsigned char>(t);
+                    for(int b=0; b<24; ++b) if(ptr[b] != static_cast<unsigned char>(t)) overlapped = true;
+                }
+            });
+        }
+        size_t reserved = 0U;
+        for(int i=0; i<100; ++i) reserved = std::max(reserved, arena.stats().reserved_bytes);
+        for(auto& worker : workers) worker.join();
+        arena.nextFrame();
+
+        const auto stats = arena.stats();
+        EGEG_CHECK(!overlapped);
+        EGEG_CHECK(stats.threads == kThreads);
+        EGEG_CHECK(stats.last_frame_bytes == kThreads*2000U*24U);
+        EGEG_CHECK(stats.reserved_bytes >= reserved);
+    }
+} // unnamed namespace
+
+
+/******************************************************************************
+
+    main
+
+******************************************************************************/
+int main() {
+    rewind();
+    oversize();
+    alignment();
+    threads();
+    return egeg_test::result("frame_arena_test");
+}
+// EOF
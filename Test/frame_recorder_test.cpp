@@ -0,0 +1,184 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+#include "easy_engine.hpp"
+#include "input_device.hpp"
+#include "input_manager.hpp"
+#include "test.hpp"
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace egeg_ns = easy_engine;
+namespace {
+    constexpr const char* kLogPath = "frame_recorder_test.egrp";
+    constexpr uint64_t kFrames = 120U;
+    constexpr uint32_t kEventTag = 7U;
+
+    // 記録と再生で異なる値を返す入力源
+    uint32_t g_live_input = 0U;
+
+    // 入力状態の保存、復元に対応したデバイス
+    //  数フレーム毎にのみ状態が変化する(変化しないフレームは記録されない)
+    class FakePad : public egeg_ns::i_lib::InputDevice {
+    public :
+        void update() override {
+            g_live_input = g_live_input*1103515245U + 12345U;
+            if(g_live_input % 3U == 0U) value_ = g_live_input;
+        }
+        size_t stateSize() const noexcept override { return sizeof(value_); }
+        void saveState(void* Dest) const noexcept override { std::memcpy(Dest, &value_, sizeof(value_)); }
+        void loadState(const void* Src) noexcept override { std::memcpy(&value_, Src, sizeof(value_)); }
+        uint32_t value() const noexcept { return value_; }
+    private :
+        uint32_t value_ = 0U;
+    };
+
+    // 更新処理に渡された経過時間と入力を記録する
+    //  毎フレーム、フレーム番号をイベントとして記録し、10フレーム毎に追加のタスクの登録、解除を切り替える
+    struct Game {
+        void update(egeg_ns::Time Elapsed) {
+            using namespace egeg_ns;
+            const uint64_t frame = EasyEngine::frameCount();
+            elapsed.push_back(Elapsed);
+            inputs.push_back(EasyEngine::input().device<FakePad>()->value());
+
+            auto& recorder = EasyEngine::recorder();
+            const uint64_t payload = frame == event_diverges_at ? frame+1U : frame;
+            recorder.recordEvent(kEventTag, &payload, sizeof(payload));
+            if(recorder.mode() == FrameRecorder::Mode::kReplay) {
+                const auto& events = recorder.replayedEvents();
+                uint64_t recorded = UINT64_MAX;
+                if(events.size() == 1U && events[0].tag == kEventTag && events[0].size == sizeof(recorded))
+                    std::memcpy(&recorded, events[0].data, sizeof(recorded));
+                replayed.push_back(recorded);
+            }
+
+            if(frame % 10U == 0U && frame != task_diverges_at) {
+                if(extra_registered) extra.exitFromManager();
+                else extra = EasyEngine::updator().registerTask(this, &Game::nop, 1U);
+                extra_registered = !extra_registered;
+            }
+        }
+        void nop(egeg_ns::Time) {}
+
+        uint64_t event_diverges_at = UINT64_MAX;   // このフレームだけ異なるイベントを記録する
+        uint64_t task_diverges_at = UINT64_MAX;    // このフレームだけ追加のタスクを切り替えない
+        std::vector<egeg_ns::Time> elapsed;
+        std::vector<uint32_t> inputs;
+        std::vector<uint64_t> replayed;
+        egeg_ns::UpdateTaskInfo extra;
+        bool extra_registered = false;
+    };
+
+    struct Session {
+        Game game;
+        egeg_ns::ReplayStats stats;
+        uint64_t frames = 0U;
+    };
+
+    // 記録、または再生を行う
+    //  再生時は、実時間で実行する設定と異なる入力源を与え、記録から復元されることを確認する
+    void run(Session& Out, const bool Replay) {
+        using namespace egeg_ns;
+        UpdateTaskInfo task;
+        g_live_input = Replay ? 0xDEADU : 1U;
+
+        EngineConfig config;
+        config.headless = true;
+        config.real_time = Replay;
+        config.fixed_delta = Milliseconds{7};
+        config.max_frames = Replay ? 0U : kFrames; // 再生は記録の終わりで終了する
+        (Replay ? config.replay_path : config.record_path) = kLogPath;
+        config.on_start = [&] {
+            EasyEngine::input().connect<FakePad>();
+            task = EasyEngine::updator().registerTask(&Out.game, &Game::update, 0U);
+        };
+        config.on_exit = [&] {
+            Out.stats = EasyEngine::recorder().stats();
+            Out.frames = EasyEngine::frameCount();
+            task.exitFromManager();
+            Out.game.extra.exitFromManager();
+        };
+        EasyEngine::run(config);
+    }
+
+    // 記録したフレームを再生すると、同じ経過時間と入力が渡され、記録と一致する
+    void replayMatches() {
+        Session recorded;
+        run(recorded, false);
+        EGEG_CHECK(recorded.frames == kFrames);
+        EGEG_CHECK(recorded.game.inputs.size() == kFrames);
+
+        Session replayed;
+        run(replayed, true);
+        EGEG_CHECK(replayed.frames == kFrames);
+        EGEG_CHECK(replayed.game.elapsed == recorded.game.elapsed);
+        EGEG_CHECK(replayed.game.inputs == recorded.game.inputs);
+        EGEG_CHECK(replayed.game.replayed.size() == kFrames);
+        for(uint64_t i=0; i<replayed.game.replayed.size(); ++i) EGEG_CHECK(replayed.game.replayed[i] == i);
+
+        EGEG_CHECK(replayed.stats.frames == kFrames);
+        EGEG_CHECK(replayed.stats.total_frames == kFrames);
+        EGEG_CHECK(replayed.stats.mismatched_frames == 0U);
+        EGEG_CHECK(replayed.stats.first_mismatch == UINT64_MAX);
+    }
+
+    // 再生中に記録と異なるイベント、タスク数になったフレームを検出する
+    void detectDivergence() {
+        Session recorded;
+        run(recorded, false);
+
+        Session event_diverged;
+        event_diverged.game.event_diverges_at = 42U;
+        run(event_diverged, true);
+        EGEG_CHECK(event_diverged.stats.mismatched_frames == 1U);
+        EGEG_CHECK(event_diverged.stats.first_mismatch == 42U);
+
+        // 切り替えなかったフレーム以降は、登録数が記録と常に異なる
+        Session task_diverged;
+        task_diverged.game.task_diverges_at = 50U;
+        run(task_diverged, true);
+        EGEG_CHECK(task_diverged.stats.first_mismatch == 50U);
+        EGEG_CHECK(task_diverged.stats.mismatched_frames == kFrames-50U);
+        EGEG_CHECK(task_diverged.stats.frames == kFrames);
+    }
+
+    // ログの形式が異なるファイルは再生できない
+    void rejectInvalidLog() {
+        {
+            std::ofstream file{kLogPath, std::ios::binary};
+            file << "not a replay log";
+        }
+        egeg_ns::FrameRecorder recorder;
+        EGEG_CHECK(!recorder.startReplay(kLogPath));
+        EGEG_CHECK(recorder.mode() == egeg_ns::FrameRecorder::Mode::kNone);
+        EGEG_CHECK(!recorder.startReplay("frame_recorder_test_missing.egrp"));
+    }
+} // unnamed namespace
+
+
+/******************************************************************************
+
+    main
+
+******************************************************************************/
+int main() {
+    replayMatches();
+    detectDivergence();
+    rejectInvalidLog();
+    std::remove(kLogPath);
+    return egeg_test::result("frame_recorder_test");
+}
+// EOF
@@ -0,0 +1,117 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include <cstdint>
+#include "easy_engine.hpp"
+#include "test.hpp"
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace egeg_ns = easy_engine;
+namespace {
+    // 呼び出された回数と経過時間を数えるだけの更新処理
+    struct Counter {
+        void update(egeg_ns::Time Elapsed) {
+            ++calls;
+            total += Elapsed;
+            if(exit_at && calls == exit_at) egeg_ns::EasyEngine::exit();
+        }
+        uint64_t calls = 0U;
+        uint64_t exit_at = 0U;
+        egeg_ns::Time total{};
+    };
+
+    // 実時間で実行しない場合、指定したフレーム数を固定の経過時間で処理する
+    void fixedStep() {
+        using namespace egeg_ns;
+        Counter counter;
+        UpdateTaskInfo task;
+        bool headless = false;
+        uint64_t frames = 0U;
+        Time now{};
+
+        EngineConfig config;
+        config.headless = true;
+        config.real_time = false;
+        config.max_frames = 600U;
+        config.fixed_delta = Milliseconds{10};
+        config.on_start = [&] { task = EasyEngine::updator().registerTask(&counter, &Counter::update, 0U); };
+        config.on_exit = [&] {
+            headless = EasyEngine::isHeadless();
+            frames = EasyEngine::frameCount();
+            now = EasyEngine::clock().now();
+            task.exitFromManager();
+        };
+        EasyEngine::run(config);
+
+        EGEG_CHECK(headless);
+        EGEG_CHECK(frames == 600U);
+        EGEG_CHECK(counter.calls == 600U);
+        EGEG_CHECK(counter.total == Time{Seconds{6}});
+        EGEG_CHECK(now == Time{Seconds{6}}); // エンジンのクロックは毎フレーム進む
+    }
+
+    // EasyEngine::exit() で、現在のフレームの後に終了する
+    void exitRequest() {
+        using namespace egeg_ns;
+        Counter counter;
+        counter.exit_at = 42U;
+        UpdateTaskInfo task;
+
+        EngineConfig config;
+        config.headless = true;
+        config.real_time = false;
+        config.on_start = [&] { task = EasyEngine::updator().registerTask(&counter, &Counter::update, 0U); };
+        config.on_exit = [&] { task.exitFromManager(); };
+        EasyEngine::run(config);
+
+        EGEG_CHECK(counter.calls == 42U);
+    }
+
+    // 実時間で実行する場合、フレームペーサーの周期でフレームを進める
+    void realTime() {
+        using namespace egeg_ns;
+        Counter counter;
+        UpdateTaskInfo task;
+        FramePacerStats stats;
+
+        EngineConfig config;
+        config.headless = true;
+        config.max_frames = 30U;
+        config.on_start = [&] { task = EasyEngine::updator().registerTask(&counter, &Counter::update, 0U); };
+        config.on_exit = [&] {
+            stats = EasyEngine::pacer().stats();
+            task.exitFromManager();
+        };
+        const auto begin = ClockUsed::now();
+        EasyEngine::run(config);
+        const Time elapsed{ClockUsed::now() - begin};
+
+        EGEG_CHECK(counter.calls == 30U);
+        EGEG_CHECK(stats.frames == 30U);
+        // 1フレーム目は起動処理の分だけ短くなる
+        EGEG_CHECK(elapsed >= Time{Microseconds{kTPF<std::micro>}}*29);
+        EGEG_CHECK(counter.total >= Time{Microseconds{kTPF<std::micro>}}*29);
+    }
+} // unnamed namespace
+
+
+/******************************************************************************
+
+    main
+
+******************************************************************************/
+int main() {
+    fixedStep();
+    exitRequest();
+    realTime();
+    return egeg_test::result("headless_test");
+}
+// EOF
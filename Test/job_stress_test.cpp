@@ -0,0 +1,136 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include "easy_engine.hpp"
+#include "test.hpp"
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace egeg_ns = easy_engine;
+namespace {
+    // 毎フレーム、小さなジョブを大量に登録して完了を待つ更新処理
+    //  ジョブの一部はさらにジョブを登録する(ワーカースレッドからの登録)
+    struct TinyJobs {
+        void update(egeg_ns::Time) {
+            auto& jobs = *system;
+            egeg_ns::t_lib::JobCounter counter;
+            sum.store(0U, std::memory_order_relaxed);
+            for(uint32_t i=0; i<jobs_per_frame; ++i) {
+                jobs.run([this, i, &jobs, &counter] {
+                    sum.fetch_add(i, std::memory_order_relaxed);
+                    if(i % 64U == 0U)
+                        jobs.run([this] { nested.fetch_add(1U, std::memory_order_relaxed); }, &counter);
+                }, &counter);
+            }
+            jobs.wait(counter);
+
+            const uint64_t n = jobs_per_frame;
+            if(sum.load(std::memory_order_relaxed) != n*(n-1U)/2U) ++bad_frames;
+            ++frames;
+        }
+        egeg_ns::t_lib::JobSystem* system = nullptr;
+        uint32_t jobs_per_frame = 0U;
+        std::atomic<uint64_t> sum{0U};
+        std::atomic<uint64_t> nested{0U};
+        uint64_t bad_frames = 0U;
+        uint64_t frames = 0U;
+    };
+} // unnamed namespace
+
+
+/******************************************************************************
+
+    main
+
+******************************************************************************/
+// 引数 : フレーム数 1フレームのジョブ数
+//  エンジンのジョブシステムに加え、ハードウェアの並列数に依らずスチールが起きるよう
+//  ワーカースレッド数を固定したジョブシステムでも実行する
+int main(int Argc, char** Argv) {
+    using namespace egeg_ns;
+    const uint64_t frames = Argc > 1 ? std::strtoull(Argv[1], nullptr, 10) : 300U;
+    const uint32_t jobs_per_frame = Argc > 2 ? static_cast<uint32_t>(std::strtoul(Argv[2], nullptr, 10)) : 10000U;
+
+    auto check = [&](const char* Name, const TinyJobs& Tiny, const Time Elapsed) {
+        EGEG_CHECK(Tiny.frames == frames);
+        EGEG_CHECK(Tiny.bad_frames == 0U);
+        EGEG_CHECK(Tiny.nested.load() == frames * ((jobs_per_frame+63U) / 64U));
+        std::printf("%s : %llu frames x %u jobs : %.3f ms/frame\n", Name,
+            static_cast<unsigned long long>(frames), jobs_per_frame,
+            frames ? Elapsed.nanoseconds() / 1e6 / frames : 0.0);
+    };
+
+    { // エンジンの更新処理から実行
+        TinyJobs tiny;
+        tiny.jobs_per_frame = jobs_per_frame;
+        UpdateTaskInfo task;
+        EngineConfig config;
+        config.headless = true;
+        config.real_time = false;
+        config.max_frames = frames;
+        config.on_start = [&] {
+            tiny.system = &EasyEngine::jobs();
+            task = EasyEngine::updator().registerTask(&tiny, &TinyJobs::update, 0U);
+        };
+        config.on_exit = [&] { task.exitFromManager(); };
+        const auto begin = ClockUsed::now();
+        EasyEngine::run(config);
+        check("engine", tiny, Time{ClockUsed::now() - begin});
+    }
+    { // ワーカースレッド4つ
+        t_lib::JobSystem system{4U};
+        TinyJobs tiny;
+        tiny.system = &system;
+        tiny.jobs_per_frame = jobs_per_frame;
+        const auto begin = ClockUsed::now();
+        for(uint64_t i=0; i<frames; ++i) tiny.update(Time{});
+        check("4 workers", tiny, Time{ClockUsed::now() - begin});
+    }
+    { // ジョブシステムに属していないスレッドからも同時に登録する
+        t_lib::JobSystem system{4U};
+        TinyJobs tiny;
+        tiny.system = &system;
+        tiny.jobs_per_frame = jobs_per_frame;
+
+        constexpr uint32_t kForeignThreads = 3U;
+        std::atomic<uint64_t> foreign_sum{0U};
+        std::vector<std::thread> foreign;
+        const auto begin = ClockUsed::now();
+        for(uint32_t t=0; t<kForeignThreads; ++t) {
+            foreign.emplace_back([&] {
+                EGEG_CHECK(!system.isJobThread());
+                for(uint64_t i=0; i<frames; ++i) {
+                    t_lib::JobCounter counter;
+                    for(uint32_t j=0; j<jobs_per_frame/4U; ++j) {
+                        system.run([&system, &foreign_sum, &counter, j] {
+                            foreign_sum.fetch_add(1U, std::memory_order_relaxed);
+                            if(j % 64U == 0U) // ワーカーのデックへの登録
+                                system.run([&foreign_sum] { foreign_sum.fetch_add(1U, std::memory_order_relaxed); }, &counter);
+                        }, &counter);
+                    }
+                    system.wait(counter);
+                }
+            });
+        }
+        for(uint64_t i=0; i<frames; ++i) tiny.update(Time{});
+        for(auto& thread : foreign) thread.join();
+        check("4 workers + foreign threads", tiny, Time{ClockUsed::now() - begin});
+
+        const uint64_t per_round = jobs_per_frame/4U + (jobs_per_frame/4U + 63U) / 64U;
+        EGEG_CHECK(foreign_sum.load() == kForeignThreads * frames * per_round);
+    }
+    return egeg_test::result("job_stress_test");
+}
+// EOF
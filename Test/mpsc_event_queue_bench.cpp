@@ -0,0 +1,128 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "event_container.hpp"
+#include "mpsc_event_queue.hpp"
+#include "time.hpp"
+#include "test.hpp"
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace egeg_ns = easy_engine;
+namespace {
+    // 比較用 : ミューテックスで保護した EventQueue
+    class LockedQueue {
+    public :
+        template <class ...ArgTypes_>
+        void emplace(ArgTypes_&& ...Args) {
+            std::lock_guard<std::mutex> lock{mutex_};
+            queue_.emplace(std::forward<ArgTypes_>(Args)...);
+        }
+        size_t drainAll() {
+            size_t count = 0U;
+            std::unique_lock<std::mutex> lock{mutex_};
+            while(!queue_.empty()) {
+                auto func = std::move(queue_.top());
+                queue_.pop();
+                lock.unlock();
+                func();
+                ++count;
+                lock.lock();
+            }
+            return count;
+        }
+    private :
+        std::mutex mutex_;
+        egeg_ns::t_lib::EventQueue<void()> queue_;
+    };
+
+    // 追加できたかどうか(容量無制限のキューは常に追加できる)
+    template <class QueueTy, class FTy>
+    bool push(QueueTy& Queue, FTy&& Func) {
+        if constexpr(std::is_void_v<decltype(Queue.emplace(std::forward<FTy>(Func)))>) {
+            Queue.emplace(std::forward<FTy>(Func));
+            return true;
+        }
+        else {
+            return Queue.emplace(std::forward<FTy>(Func));
+        }
+    }
+
+    // Producers スレッドから Events 個ずつ追加し、1スレッドで全て取り出すまでの時間
+    //  容量固定のキューが一杯の場合、追加側は取り出されるまで再試行する
+    template <class QueueTy>
+    void contention(const char* Name, const uint32_t Producers, const uint64_t Events) {
+        QueueTy queue;
+        std::atomic<uint64_t> sum{0U};
+        std::atomic<uint64_t> retries{0U};
+        std::atomic<bool> start{false};
+        std::vector<std::thread> producers;
+        for(uint32_t p=0; p<Producers; ++p) {
+            producers.emplace_back([&, p] {
+                while(!start.load(std::memory_order_acquire)) std::this_thread::yield();
+                uint64_t retry = 0U;
+                for(uint64_t i=0; i<Events; ++i) {
+                    const uint64_t value = p*Events + i;
+                    while(!push(queue, [&sum, value] { sum.fetch_add(value, std::memory_order_relaxed); })) {
+                        ++retry;
+                        std::this_thread::yield();
+                    }
+                }
+                retries.fetch_add(retry, std::memory_order_relaxed);
+            });
+        }
+
+        const uint64_t total = static_cast<uint64_t>(Producers) * Events;
+        const auto begin = egeg_ns::ClockUsed::now();
+        start.store(true, std::memory_order_release);
+        uint64_t drained = 0U;
+        while(drained < total) {
+            const size_t count = queue.drainAll();
+            if(!count) std::this_thread::yield();
+            drained += count;
+        }
+        const egeg_ns::Time elapsed{egeg_ns::ClockUsed::now() - begin};
+        for(auto& producer : producers) producer.join();
+
+        EGEG_CHECK(sum.load() == total*(total-1U)/2U);
+        std::printf("%-24s : %2u producers x %8llu events : %8.2f ms  %7.2f Mevents/s  %6.1f ns/event  retries %llu\n",
+            Name, Producers, static_cast<unsigned long long>(Events), elapsed.nanoseconds()/1e6,
+            total*1e3/elapsed.nanoseconds(), static_cast<double>(elapsed.nanoseconds())/total,
+            static_cast<unsigned long long>(retries.load()));
+    }
+} // unnamed namespace
+
+
+/******************************************************************************
+
+    main
+
+******************************************************************************/
+// 引数 : 1スレッドが追加するイベント数 追加するスレッド数
+int main(int Argc, char** Argv) {
+    using namespace egeg_ns::t_lib;
+    const uint64_t events = Argc > 1 ? std::strtoull(Argv[1], nullptr, 10) : 200000U;
+    const uint32_t producers = Argc > 2 ? static_cast<uint32_t>(std::strtoul(Argv[2], nullptr, 10)) : 16U;
+
+    contention<LockedQueue>("mutex + EventQueue", producers, events);
+    contention<MpscEventQueue<void()>>("MpscEventQueue", producers, events);
+    contention<BoundedMpscEventQueue<void(), 1024U>>("BoundedMpscEventQueue", producers, events);
+    return egeg_test::result("mpsc_event_queue_bench");
+}
+// EOF
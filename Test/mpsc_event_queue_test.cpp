@@ -0,0 +1,69 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include <stdexcept>
+#include "mpsc_event_queue.hpp"
+#include "test.hpp"
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace egeg_ns = easy_engine;
+namespace {
+    // コピー時に例外を送出できる関数オブジェクト
+    struct Thrower {
+        explicit Thrower(int* Calls, bool Throw=false) noexcept : calls{Calls}, do_throw{Throw} {}
+        Thrower(const Thrower& Right) : calls{Right.calls}, do_throw{Right.do_throw} {
+            if(do_throw) throw std::runtime_error{"Thrower"};
+        }
+        void operator()() const { ++*calls; }
+        int* calls;
+        bool do_throw;
+    };
+
+    // イベントの構築に失敗しても、以降のイベントを取り出せる
+    template <class QueueTy>
+    void constructionFailure() {
+        QueueTy queue;
+        int calls = 0;
+        const Thrower ok{&calls};
+        const Thrower bad{&calls, true};
+
+        queue.emplace(ok);
+        bool thrown = false;
+        try { queue.emplace(bad); }
+        catch(const std::runtime_error&) { thrown = true; }
+        EGEG_CHECK(thrown);
+        queue.emplace(ok);
+
+        EGEG_CHECK(queue.drainAll() == 2U);
+        EGEG_CHECK(calls == 2);
+        EGEG_CHECK(queue.empty());
+
+        // 失敗したセルを再利用できる(一周させる)
+        for(size_t i=0; i<3000U; ++i) {
+            try { queue.emplace(i%3U ? ok : bad); } catch(const std::runtime_error&) {}
+            queue.drainAll();
+        }
+        EGEG_CHECK(calls == 2+2000);
+    }
+} // unnamed namespace
+
+
+/******************************************************************************
+
+    main
+
+******************************************************************************/
+int main() {
+    constructionFailure<egeg_ns::t_lib::BoundedMpscEventQueue<void()>>();
+    constructionFailure<egeg_ns::t_lib::MpscEventQueue<void()>>();
+    return egeg_test::result("mpsc_event_queue_test");
+}
+// EOF
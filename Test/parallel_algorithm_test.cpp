@@ -0,0 +1,195 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include <cstdint>
+#include <cstring>
+#include <atomic>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+#include "job_system.hpp"
+#include "parallel_algorithm.hpp"
+#include "test.hpp"
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace egeg_ns = easy_engine;
+namespace {
+    using egeg_ns::t_lib::JobSystem;
+    using egeg_ns::t_lib::ParallelOptions;
+
+    // 浮動小数点数の一致(ビット単位)
+    bool same(const float Lhs, const float Rhs) noexcept { return std::memcmp(&Lhs, &Rhs, sizeof(float)) == 0; }
+
+    // 桁の異なる値を混ぜ、結合の順序で合計が変わる入力を作る
+    std::vector<float> mixedValues(const size_t Count) {
+        std::vector<float> values(Count);
+        uint32_t random = 1U;
+        for(auto& value : values) {
+            random = random*1664525U + 1013904223U;
+            const float scale = (random >> 30) == 0U ? 1e6F : 1e-3F;
+            value = static_cast<float>(random >> 8) / static_cast<float>(1U << 24) * scale;
+        }
+        return values;
+    }
+
+    // 全ての要素が1回ずつ呼び出される
+    void forEachIndex(JobSystem& Jobs) {
+        constexpr size_t kCount = 100000U;
+        std::vector<std::atomic<uint32_t>> calls(kCount);
+        egeg_ns::t_lib::parallelFor(Jobs, 0U, kCount, [&](const size_t I) { calls[I].fetch_add(1U, std::memory_order_relaxed); });
+        for(const auto& call : calls) EGEG_CHECK(call.load() == 1U);
+
+        std::vector<uint32_t> values(kCount, 1U);
+        egeg_ns::t_lib::parallelFor(Jobs, values, [](uint32_t& V) { V *= 3U; }, ParallelOptions{7U, false});
+        EGEG_CHECK(std::accumulate(values.begin(), values.end(), uint64_t{0U}) == uint64_t{3U}*kCount);
+
+        // 空の範囲は呼び出さない
+        bool called = false;
+        egeg_ns::t_lib::parallelFor(Jobs, 5U, 5U, [&](size_t) { called = true; });
+        EGEG_CHECK(!called);
+    }
+
+    // その場での累積は、逐次処理の累積と一致する
+    void scanInPlace(JobSystem& Jobs) {
+        for(const size_t count : {size_t{1U}, size_t{1000U}, size_t{100003U}}) {
+            std::vector<uint64_t> values(count);
+            for(size_t i=0; i<count; ++i) values[i] = i % 17U;
+            std::vector<uint64_t> expected(count);
+            std::partial_sum(values.begin(), values.end(), expected.begin());
+
+            const uint64_t total = egeg_ns::t_lib::parallelScan(Jobs, values.begin(), values.end(), values.begin(),
+                uint64_t{0U}, std::plus<>{}, ParallelOptions{0U, count % 2U == 0U});
+            EGEG_CHECK(values == expected);
+            EGEG_CHECK(total == expected.back());
+        }
+    }
+
+    // ジョブの中から呼び出しても完了する(ワーカーが全て使用中でも待ち続けない)
+    void nested(JobSystem& Jobs) {
+        constexpr size_t kRows = 64U;
+        constexpr size_t kColumns = 2000U;
+        std::vector<uint64_t> sums(kRows);
+        std::vector<std::vector<uint64_t>> scans(kRows, std::vector<uint64_t>(kColumns, 1U));
+        egeg_ns::t_lib::parallelFor(Jobs, 0U, kRows, [&](const size_t Row) {
+            sums[Row] = egeg_ns::t_lib::parallelReduce(Jobs, 0U, kColumns, uint64_t{0U},
+                [Row](const size_t C) { return static_cast<uint64_t>(Row*C); }, std::plus<>{});
+            egeg_ns::t_lib::parallelScan(Jobs, scans[Row].begin(), scans[Row].end(), scans[Row].begin(),
+                uint64_t{0U}, std::plus<>{});
+        }, ParallelOptions{1U, false});
+
+        for(size_t row=0; row<kRows; ++row) {
+            EGEG_CHECK(sums[row] == row*kColumns*(kColumns-1U)/2U);
+            EGEG_CHECK(scans[row].back() == kColumns);
+        }
+
+        // 単独のジョブの中からの呼び出し
+        egeg_ns::t_lib::JobCounter counter;
+        uint64_t in_job = 0U;
+        Jobs.run([&] {
+            in_job = egeg_ns::t_lib::parallelReduce(Jobs, 0U, size_t{10000U}, uint64_t{0U},
+                [](const size_t I) { return static_cast<uint64_t>(I); }, std::plus<>{});
+        }, &counter);
+        Jobs.wait(counter);
+        EGEG_CHECK(in_job == uint64_t{10000U}*9999U/2U);
+    }
+
+    // 関数から送出された例外は呼び出し側に伝わり、その後もジョブシステムは使用できる
+    void exceptions(JobSystem& Jobs) {
+        auto expectThrow = [](auto&& Func) {
+            bool thrown = false;
+            try { Func(); }
+            catch(const std::runtime_error&) { thrown = true; }
+            EGEG_CHECK(thrown);
+        };
+
+        expectThrow([&] {
+            egeg_ns::t_lib::parallelFor(Jobs, 0U, 100000U, [](const size_t I) {
+                if(I == 54321U) throw std::runtime_error{"for"};
+            });
+        });
+        expectThrow([&] {
+            egeg_ns::t_lib::parallelReduce(Jobs, 0U, 100000U, 0, [](const size_t I) {
+                if(I == 99999U) throw std::runtime_error{"reduce"};
+                return 1;
+            }, std::plus<>{}, ParallelOptions{0U, true});
+        });
+        std::vector<int> values(10000U, 1);
+        expectThrow([&] {
+            egeg_ns::t_lib::parallelScan(Jobs, values.begin(), values.end(), values.begin(), 0, [](const int Sum, const int V) {
+                if(Sum == 5000) throw std::runtime_error{"scan"};
+                return Sum + V;
+            });
+        });
+        // 入れ子の呼び出しで送出された例外
+        expectThrow([&] {
+            egeg_ns::t_lib::parallelFor(Jobs, 0U, 16U, [&](const size_t Row) {
+                egeg_ns::t_lib::parallelFor(Jobs, 0U, 1000U, [Row](const size_t C) {
+                    if(Row == 7U && C == 500U) throw std::runtime_error{"nested"};
+                });
+            }, ParallelOptions{1U, false});
+        });
+
+        forEachIndex(Jobs);
+    }
+
+    // 決定的な集計と累積は、スレッド数や実行毎に依らずビット単位で一致する
+    struct DeterministicResult {
+        float reduce;
+        float scan_total;
+        std::vector<float> scan;
+    };
+    DeterministicResult deterministic(JobSystem& Jobs, const std::vector<float>& Values) {
+        const ParallelOptions options{0U, true};
+        DeterministicResult result;
+        result.reduce = egeg_ns::t_lib::parallelReduce(Jobs, Values, 0.0F, [](const float V) { return V; }, std::plus<>{}, options);
+        result.scan.resize(Values.size());
+        result.scan_total = egeg_ns::t_lib::parallelScan(Jobs, Values.begin(), Values.end(), result.scan.begin(),
+            0.0F, std::plus<>{}, options);
+
+        for(int i=0; i<8; ++i) {
+            const float again = egeg_ns::t_lib::parallelReduce(Jobs, 0U, Values.size(), 0.0F,
+                [&Values](const size_t I) { return Values[I]; }, std::plus<>{}, options);
+            EGEG_CHECK(same(again, result.reduce));
+        }
+        EGEG_CHECK(same(result.scan_total, result.scan.back()));
+        return result;
+    }
+} // unnamed namespace
+
+
+/******************************************************************************
+
+    main
+
+******************************************************************************/
+int main() {
+    const std::vector<float> values = mixedValues(200000U);
+    std::vector<DeterministicResult> results;
+
+    // ワーカーの数を変えて、同じ処理を行う
+    for(const size_t workers : {size_t{0U}, size_t{1U}, size_t{3U}, size_t{7U}}) {
+        JobSystem jobs{workers};
+        forEachIndex(jobs);
+        scanInPlace(jobs);
+        nested(jobs);
+        exceptions(jobs);
+        results.push_back(deterministic(jobs, values));
+    }
+
+    for(const auto& result : results) {
+        EGEG_CHECK(same(result.reduce, results.front().reduce));
+        EGEG_CHECK(same(result.scan_total, results.front().scan_total));
+        EGEG_CHECK(std::memcmp(result.scan.data(), results.front().scan.data(), sizeof(float)*result.scan.size()) == 0);
+    }
+    return egeg_test::result("parallel_algorithm_test");
+}
+// EOF
@@ -0,0 +1,144 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include "profiler.hpp"
+#include "time.hpp"
+#include "test.hpp"
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace egeg_ns = easy_engine;
+namespace {
+    using egeg_ns::ClockUsed;
+    using egeg_ns::t_lib::Profiler;
+    constexpr const char* kTracePath = "profiler_bench.json";
+    constexpr uint64_t kEventsPerFrame = 1024U; // 1フレームで記録する区間数(リングバッファより十分小さくする)
+
+    volatile uint64_t g_sink = 0U;
+
+    // 計測対象の処理(最適化で消えないようにする)
+    void work(const uint64_t I) noexcept { g_sink = g_sink + I; }
+
+    double nanosecondsPer(const ClockUsed::duration Elapsed, const uint64_t Count) {
+        return static_cast<double>(egeg_ns::Time{Elapsed}.nanoseconds()) / static_cast<double>(Count);
+    }
+
+    // 1区間当たりの記録の負荷
+    //  計測なしのループとの差を、スコープと連続区間それぞれで求める
+    //  endFrame() の集計は別に計測する
+    void overhead(const uint64_t Iterations) {
+        double frame_ns = 0.0;
+        uint64_t frames = 0U;
+        auto endFrame = [&] {
+            const auto begin = ClockUsed::now();
+            Profiler::endFrame();
+            frame_ns += static_cast<double>(egeg_ns::Time{ClockUsed::now() - begin}.nanoseconds());
+            ++frames;
+        };
+
+        auto begin = ClockUsed::now();
+        for(uint64_t i=0; i<Iterations; ++i) work(i);
+        const double base = nanosecondsPer(ClockUsed::now() - begin, Iterations);
+
+        ClockUsed::duration scope_time{};
+        for(uint64_t i=0; i<Iterations; i+=kEventsPerFrame) {
+            begin = ClockUsed::now();
+            for(uint64_t j=i; j<i+kEventsPerFrame; ++j) {
+                EGEG_PROFILE_SCOPE("bench/scope");
+                work(j);
+            }
+            scope_time += ClockUsed::now() - begin;
+            endFrame();
+        }
+        const double scope = nanosecondsPer(scope_time, Iterations);
+
+        ClockUsed::duration chain_time{};
+        for(uint64_t i=0; i<Iterations; i+=kEventsPerFrame) {
+            begin = ClockUsed::now();
+            EGEG_PROFILE_CHAIN(chain);
+            for(uint64_t j=i; j<i+kEventsPerFrame; ++j) {
+                work(j);
+                EGEG_PROFILE_CHAIN_MARK(chain, "bench/chain");
+            }
+            chain_time += ClockUsed::now() - begin;
+            endFrame();
+        }
+        const double chain = nanosecondsPer(chain_time, Iterations);
+
+        std::printf("%10llu events : base %6.2f ns  scope +%6.2f ns/event  chain +%6.2f ns/event  endFrame %6.2f ns/event\n",
+            static_cast<unsigned long long>(Iterations), base, scope-base, chain-base,
+            frames ? frame_ns / static_cast<double>(frames*kEventsPerFrame) : 0.0);
+    }
+
+    // 複数のスレッドから同時に記録した場合の負荷(スレッド毎のバッファのため、ロックを取らない)
+    void threaded(const uint64_t Iterations, const uint32_t Threads) {
+        const uint64_t per_thread = Iterations / Threads;
+        std::vector<double> ns(Threads);
+        std::vector<std::thread> threads;
+        for(uint32_t t=0; t<Threads; ++t) {
+            threads.emplace_back([&ns, per_thread, t] {
+                const auto begin = ClockUsed::now();
+                for(uint64_t i=0; i<per_thread; ++i) {
+                    EGEG_PROFILE_SCOPE("bench/threaded");
+                    work(i);
+                }
+                ns[t] = nanosecondsPer(ClockUsed::now() - begin, per_thread);
+            });
+        }
+        for(auto& thread : threads) thread.join();
+        Profiler::endFrame(); // 記録しているスレッドが無い時点で集計する
+
+        double worst = 0.0;
+        for(const double n : ns) worst = n > worst ? n : worst;
+        std::printf("%10u threads : scope %6.2f ns/event (slowest thread)\n", Threads, worst);
+    }
+
+    // 計測した区間が統計とトレースに出力される
+    void results() {
+        bool scope_found = false;
+        bool chain_found = false;
+        for(const auto& stat : Profiler::stats()) {
+            if(std::strcmp(stat.name, "bench/scope") == 0) {
+                scope_found = true;
+                EGEG_CHECK(stat.calls_per_frame > 0.0);
+                EGEG_CHECK(stat.min <= stat.avg);
+            }
+            if(std::strcmp(stat.name, "bench/chain") == 0) chain_found = true;
+        }
+        EGEG_CHECK(scope_found);
+        EGEG_CHECK(chain_found);
+        EGEG_CHECK(Profiler::writeChromeTrace(kTracePath, 4U));
+        std::remove(kTracePath);
+    }
+} // unnamed namespace
+
+
+/******************************************************************************
+
+    main
+
+******************************************************************************/
+// 引数 : 区間数 スレッド数
+int main(int Argc, char** Argv) {
+    const uint64_t iterations = Argc > 1 ? std::strtoull(Argv[1], nullptr, 10) : 10000000U;
+    const uint32_t threads = Argc > 2 ? static_cast<uint32_t>(std::strtoul(Argv[2], nullptr, 10)) : 4U;
+
+    overhead(iterations);
+    threaded(iterations, threads > 0U ? threads : 1U);
+    results();
+    return egeg_test::result("profiler_bench");
+}
+// EOF
@@ -0,0 +1,154 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include <cstdint>
+#include <memory>
+#include "scaled_clock.hpp"
+#include "test.hpp"
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace egeg_ns = easy_engine;
+namespace {
+    using egeg_ns::ScaledClock;
+    using egeg_ns::Time;
+    using egeg_ns::Nanoseconds;
+    using egeg_ns::Milliseconds;
+
+    // 倍率を掛けた時間の端数は持ち越され、合計がずれない
+    void fractionalScale() {
+        ScaledClock root;
+        ScaledClock half{&root, 0.5};
+        ScaledClock third{&root, 1.0/3.0};
+        ScaledClock sixth{&half, 1.0/3.0}; // 端数は子でも持ち越される
+
+        // 1回の更新では 1ns 未満になる
+        for(int i=0; i<3001; ++i) root.advance(Nanoseconds{1});
+        EGEG_CHECK(root.now() == Time{Nanoseconds{3001}});
+        EGEG_CHECK(half.now() == Time{Nanoseconds{1500}});
+        EGEG_CHECK(third.now() >= Time{Nanoseconds{999}} && third.now() <= Time{Nanoseconds{1000}});
+        EGEG_CHECK(sixth.now() >= Time{Nanoseconds{499}} && sixth.now() <= Time{Nanoseconds{500}});
+
+        for(int i=0; i<1001; ++i) root.advance(Nanoseconds{3});
+        EGEG_CHECK(half.now() == Time{Nanoseconds{3002}}); // (3001 + 3003) / 2
+
+        // 倍率 0 では進まない(負の値は 0)
+        half.setScale(-1.0);
+        EGEG_CHECK(half.scale() == 0.0);
+        const Time stopped = half.now();
+        root.advance(Milliseconds{16});
+        EGEG_CHECK(half.now() == stopped);
+        EGEG_CHECK(half.steps() == 0U);
+        EGEG_CHECK(sixth.delta() == Time{});
+    }
+
+    // 停止すると、自身と子孫の経過時間が 0 になり、兄弟は進み続ける
+    void pausePropagation() {
+        egeg_ns::EngineClocks clocks;
+        ScaledClock physics{&clocks.game};
+        ScaledClock animation{&physics, 2.0};
+
+        clocks.real.advance(Milliseconds{10});
+        EGEG_CHECK(animation.delta() == Time{Milliseconds{20}});
+
+        clocks.game.pause();
+        clocks.real.advance(Milliseconds{10});
+        EGEG_CHECK(clocks.game.isPaused() && physics.isPaused() && animation.isPaused());
+        EGEG_CHECK(!clocks.ui.isPaused() && !clocks.real.isPaused());
+        EGEG_CHECK(physics.delta() == Time{} && animation.delta() == Time{});
+        EGEG_CHECK(animation.steps() == 0U);
+        EGEG_CHECK(clocks.ui.delta() == Time{Milliseconds{10}});
+        // 停止中も更新回数は数える
+        EGEG_CHECK(animation.ticks() == 2U);
+
+        clocks.game.resume();
+        clocks.real.advance(Milliseconds{5});
+        EGEG_CHECK(!animation.isPaused());
+        EGEG_CHECK(animation.now() == Time{Milliseconds{30}});
+        EGEG_CHECK(clocks.ui.now() == Time{Milliseconds{25}});
+
+        // 子の停止は親に伝わらない
+        physics.setPaused(true);
+        clocks.real.advance(Milliseconds{5});
+        EGEG_CHECK(!clocks.game.isPaused());
+        EGEG_CHECK(clocks.game.delta() == Time{Milliseconds{5}});
+        EGEG_CHECK(animation.delta() == Time{});
+    }
+
+    // 固定ステップは、1回の更新のステップ数が上限までに制限され、超過した時間は切り捨てられる
+    void fixedStepCap() {
+        ScaledClock root;
+        ScaledClock fixed{&root};
+        ScaledClock child{&fixed};
+        fixed.setFixedStep(Milliseconds{10}, 3U);
+        EGEG_CHECK(fixed.isFixedStep());
+
+        root.advance(Milliseconds{25});
+        EGEG_CHECK(fixed.steps() == 2U);
+        EGEG_CHECK(fixed.delta() == Time{Milliseconds{20}});
+        EGEG_CHECK(fixed.interpolation() == 0.5);
+        EGEG_CHECK(child.delta() == Time{Milliseconds{20}}); // 子にはステップ単位の時間が伝わる
+
+        // 上限を超えた分は、1ステップ未満の端数を残して切り捨てる
+        root.advance(Milliseconds{100});
+        EGEG_CHECK(fixed.steps() == 3U);
+        EGEG_CHECK(fixed.delta() == Time{Milliseconds{30}});
+        EGEG_CHECK(fixed.interpolation() == 0.5);
+
+        root.advance(Milliseconds{5});
+        EGEG_CHECK(fixed.steps() == 1U);
+        EGEG_CHECK(fixed.interpolation() == 0.0);
+
+        root.advance(Milliseconds{3});
+        EGEG_CHECK(fixed.steps() == 0U);
+        EGEG_CHECK(child.delta() == Time{});
+        EGEG_CHECK(fixed.now() == Time{Milliseconds{60}});
+        EGEG_CHECK(child.now() == Time{Milliseconds{60}});
+
+        // 上限 0 は 1 として扱う
+        fixed.setFixedStep(Milliseconds{10}, 0U);
+        root.advance(Milliseconds{50});
+        EGEG_CHECK(fixed.steps() == 1U);
+
+        // 無効にすると、親の経過時間で進む
+        fixed.setFixedStep(Time{});
+        root.advance(Milliseconds{7});
+        EGEG_CHECK(!fixed.isFixedStep());
+        EGEG_CHECK(fixed.delta() == Time{Milliseconds{7}});
+        EGEG_CHECK(fixed.interpolation() == 1.0);
+    }
+
+    // 親を先に破棄すると、子はルートになる
+    void parentDestroyed() {
+        auto parent = std::make_unique<ScaledClock>();
+        ScaledClock child{parent.get(), 2.0};
+        parent->advance(Milliseconds{1});
+        parent.reset();
+        EGEG_CHECK(child.parent() == nullptr);
+        child.advance(Milliseconds{1});
+        EGEG_CHECK(child.delta() == Time{Milliseconds{2}});
+        EGEG_CHECK(child.now() == Time{Milliseconds{4}});
+    }
+} // unnamed namespace
+
+
+/******************************************************************************
+
+    main
+
+******************************************************************************/
+int main() {
+    fractionalScale();
+    pausePropagation();
+    fixedStepCap();
+    parentDestroyed();
+    return egeg_test::result("scaled_clock_test");
+}
+// EOF
@@ -0,0 +1,114 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "job_system.hpp"
+#include "task_graph.hpp"
+#include "test.hpp"
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace egeg_ns = easy_engine;
+namespace {
+    using Graph = egeg_ns::t_lib::TaskGraph<void()>;
+
+    // 依存の連鎖 a -> b -> c の実行中に、登録、解除を行う
+    //  a : c を解除する(後のウェーブのため、その回から呼び出されない)
+    //  b : d を登録する(次の実行から呼び出される)
+    void mutateDuringRun() {
+        egeg_ns::t_lib::JobSystem jobs{4U};
+        Graph graph;
+        int a = 0, b = 0, c = 0, d = 0;
+        Graph::TaskInfo info_c;
+        Graph::TaskInfo info_d;
+
+        Graph::TaskDesc desc_a;
+        desc_a.name = "a";
+        auto info_a = graph.registerTask([&] { ++a; info_c.exitFromManager(); }, desc_a);
+        Graph::TaskDesc desc_b;
+        desc_b.name = "b";
+        desc_b.after = {info_a.id()};
+        auto info_b = graph.registerTask([&] {
+            ++b;
+            if(!info_d.id()) info_d = graph.registerTask([&] { ++d; }, Graph::TaskDesc{});
+        }, desc_b);
+        Graph::TaskDesc desc_c;
+        desc_c.name = "c";
+        desc_c.after = {info_b.id()};
+        info_c = graph.registerTask([&] { ++c; }, desc_c);
+
+        graph.run(jobs);
+        EGEG_CHECK(a == 1 && b == 1 && c == 0 && d == 0);
+        EGEG_CHECK(graph.size() == 3U); // a, b, d
+
+        graph.run(jobs);
+        EGEG_CHECK(a == 2 && b == 2 && c == 0 && d == 1);
+        EGEG_CHECK(graph.stats().num_tasks == 3U);
+    }
+
+    // タスクが自身の登録情報を破棄する
+    void unregisterSelf() {
+        egeg_ns::t_lib::JobSystem jobs{4U};
+        Graph graph;
+        int calls = 0;
+        auto info = std::make_unique<Graph::TaskInfo>();
+        *info = graph.registerTask([&] { ++calls; info.reset(); }, Graph::TaskDesc{});
+
+        graph.run(jobs);
+        graph.run(jobs);
+        EGEG_CHECK(calls == 1);
+        EGEG_CHECK(graph.size() == 0U);
+    }
+
+    // 多数の並列タスクが、ワーカースレッドから登録と解除を繰り返す
+    void churnFromWorkers() {
+        constexpr int kTasks = 256;
+        constexpr int kFrames = 50;
+        egeg_ns::t_lib::JobSystem jobs{4U};
+        Graph graph;
+        std::atomic<int> spawned_calls{0};
+        std::vector<Graph::TaskInfo> owners(kTasks);
+        std::vector<Graph::TaskInfo> spawned(kTasks);
+        for(int i=0; i<kTasks; ++i) {
+            owners[i] = graph.registerTask([&, i] {
+                // 前回登録したタスクを解除し、新しく登録する
+                spawned[i] = graph.registerTask([&] { spawned_calls.fetch_add(1, std::memory_order_relaxed); }, Graph::TaskDesc{});
+            }, Graph::TaskDesc{});
+        }
+
+        for(int f=0; f<kFrames; ++f) {
+            graph.run(jobs);
+            EGEG_CHECK(graph.size() == static_cast<size_t>(kTasks*2));
+        }
+        // 各フレームで、前のフレームに登録されたタスクのうち、
+        //  置き換えられる前に実行されたものだけが呼び出される
+        EGEG_CHECK(spawned_calls.load() <= kTasks*(kFrames-1));
+        spawned.clear();
+        owners.clear();
+        EGEG_CHECK(graph.size() == 0U);
+    }
+} // unnamed namespace
+
+
+/******************************************************************************
+
+    main
+
+******************************************************************************/
+int main() {
+    mutateDuringRun();
+    unregisterSelf();
+    churnFromWorkers();
+    return egeg_test::result("task_graph_test");
+}
+// EOF
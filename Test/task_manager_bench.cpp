@@ -0,0 +1,92 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "inplace_function.hpp"
+#include "task_manager.hpp"
+#include "time.hpp"
+#include "test.hpp"
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace egeg_ns = easy_engine;
+namespace {
+    using Manager = egeg_ns::t_lib::TaskManager<egeg_ns::t_lib::InplaceFunction<void(egeg_ns::Time)>>;
+    constexpr uint32_t kPriorities = 8U;
+
+    // 呼び出された回数を数えるだけのタスク
+    Manager::TaskInfo registerCounter(Manager& Tasks, uint64_t& Calls, const uint32_t Priority) {
+        return Tasks.registerTask([&Calls](egeg_ns::Time) { ++Calls; }, Priority);
+    }
+
+    // Tasks 個のタスクを登録し、Frames フレーム実行する
+    //  各フレームで Churn 個のタスクを解除し、同じ数を別の優先度で登録し直す(登録情報の上書きで解除)
+    void churn(const size_t Tasks, const uint32_t Frames, const size_t Churn) {
+        using egeg_ns::ClockUsed;
+        Manager manager;
+        uint64_t calls = 0U;
+        std::mt19937 rng{1U};
+        std::uniform_int_distribution<size_t> pick{0U, Tasks-1U};
+        std::uniform_int_distribution<uint32_t> priority{0U, kPriorities-1U};
+
+        std::vector<Manager::TaskInfo> handles;
+        handles.reserve(Tasks);
+        for(size_t i=0; i<Tasks; ++i) handles.push_back(registerCounter(manager, calls, priority(rng)));
+        EGEG_CHECK(manager.size() == Tasks);
+
+        egeg_ns::Time churn_time{};
+        egeg_ns::Time run_time{};
+        for(uint32_t f=0; f<Frames; ++f) {
+            const auto begin = ClockUsed::now();
+            for(size_t i=0; i<Churn; ++i) handles[pick(rng)] = registerCounter(manager, calls, priority(rng));
+            const auto middle = ClockUsed::now();
+            calls = 0U;
+            manager.run(egeg_ns::Time{});
+            const auto end = ClockUsed::now();
+
+            churn_time += egeg_ns::Time{middle - begin};
+            run_time += egeg_ns::Time{end - middle};
+            EGEG_CHECK(calls == Tasks);
+        }
+        EGEG_CHECK(manager.size() == Tasks);
+
+        // 解除済みの登録情報は無視される
+        Manager::TaskInfo stale = std::move(handles.back());
+        manager.unregisterTask(stale);
+        EGEG_CHECK(!manager.isRegistered(stale));
+        manager.unregisterTask(stale);
+        EGEG_CHECK(manager.size() == Tasks-1U);
+
+        std::printf("%8zu tasks, %6zu churn/frame : register+unregister %8.3f ms/frame  run %8.3f ms/frame  %5.1f ns/task\n",
+            Tasks, Churn, churn_time.nanoseconds()/1e6/Frames, run_time.nanoseconds()/1e6/Frames,
+            static_cast<double>(run_time.nanoseconds())/(static_cast<double>(Tasks)*Frames));
+    }
+} // unnamed namespace
+
+
+/******************************************************************************
+
+    main
+
+******************************************************************************/
+int main(int Argc, char** Argv) {
+    const size_t tasks = Argc > 1 ? std::strtoull(Argv[1], nullptr, 10) : 100000U;
+    const uint32_t frames = Argc > 2 ? static_cast<uint32_t>(std::strtoul(Argv[2], nullptr, 10)) : 100U;
+    const uint32_t percent = Argc > 3 ? static_cast<uint32_t>(std::strtoul(Argv[3], nullptr, 10)) : 10U;
+
+    churn(tasks, frames, 0U);
+    churn(tasks, frames, tasks*percent/100U);
+    return egeg_test::result("task_manager_bench");
+}
+// EOF
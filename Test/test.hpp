@@ -0,0 +1,41 @@
+///
+/// \file   test.hpp
+/// \brief  テスト用の簡易チェック定義ヘッダ
+///
+/// \author 板場
+///
+/// \par    履歴
+///         - 2026/10/19
+///             - ヘッダ追加
+///             - EGEG_CHECK 定義
+///
+#ifndef INCLUDED_EGEG_TEST_HEADER_
+#define INCLUDED_EGEG_TEST_HEADER_
+
+#include <cstdio>
+
+namespace egeg_test {
+    inline int& failures() noexcept { static int count = 0; return count; }
+
+    inline void check(const bool Result, const char* Expr, const char* File, const int Line) noexcept {
+        if(Result) return;
+        ++failures();
+        std::fprintf(stderr, "%s(%d) : check failed : %s\n", File, Line, Expr);
+    }
+
+    /// main の戻り値 失敗したチェックがある場合 1
+    inline int result(const char* Name) noexcept {
+        std::printf("%s : %s\n", Name, failures() ? "FAILED" : "passed");
+        return failures() ? 1 : 0;
+    }
+} // namespace egeg_test
+
+///
+/// \brief  条件が偽の場合に失敗を記録
+///
+///         テストは続行します。
+///
+#define EGEG_CHECK(Expr) ::egeg_test::check(static_cast<bool>(Expr), #Expr, __FILE__, __LINE__)
+
+#endif // !INCLUDED_EGEG_TEST_HEADER_
+// EOF
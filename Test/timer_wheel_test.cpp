@@ -0,0 +1,179 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include <cstdint>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+#include "timer_wheel.hpp"
+#include "test.hpp"
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace egeg_ns = easy_engine;
+namespace {
+    using egeg_ns::TimerWheel;
+    using egeg_ns::TimerID;
+    using egeg_ns::Time;
+    using egeg_ns::Milliseconds;
+    using egeg_ns::Microseconds;
+
+    // 上段のホイールに登録されたタイマーは、下段に移されて満了したティックで呼び出される
+    //  1ティックずつ進め、呼び出されたティックを記録する
+    void cascade() {
+        TimerWheel wheel;
+        const uint64_t delays[] = {1U, 255U, 256U, 257U, 300U, 511U, 512U, 65535U, 65536U, 65537U, 65536U+256U, 70000U};
+        std::vector<uint64_t> fired(std::size(delays), 0U);
+        uint64_t now = 0U;
+        for(size_t i=0; i<std::size(delays); ++i)
+            wheel.schedule(Milliseconds{static_cast<int64_t>(delays[i])}, [&fired, &now, i] { fired[i] = now; });
+        EGEG_CHECK(wheel.size() == std::size(delays));
+
+        for(now=1U; now<=70001U; ++now) wheel.advance(Milliseconds{1});
+        for(size_t i=0; i<std::size(delays); ++i) EGEG_CHECK(fired[i] == delays[i]);
+        EGEG_CHECK(wheel.size() == 0U);
+
+        // 最上段(2^24 ティック以上)のタイマーは、1回で大きく進めた場合も満了時刻に呼び出される
+        bool far = false;
+        const TimerID far_id = wheel.schedule(Milliseconds{(int64_t{1} << 24) + 5}, [&far] { far = true; });
+        wheel.advance(Milliseconds{int64_t{1} << 24});
+        EGEG_CHECK(!far);
+        EGEG_CHECK(wheel.remaining(far_id) == Time{Milliseconds{5}});
+        wheel.advance(Milliseconds{5});
+        EGEG_CHECK(far);
+    }
+
+    // 1回の advance で複数のタイマーが満了した場合は、満了時刻順(同時刻は登録順)に呼び出される
+    void firingOrder() {
+        TimerWheel wheel;
+        const int64_t delays[] = {300, 70000, 256, 65537, 257, 1, 300, 65536, 2, 256};
+        std::vector<size_t> order;
+        for(size_t i=0; i<std::size(delays); ++i)
+            wheel.schedule(Milliseconds{delays[i]}, [&order, i] { order.push_back(i); });
+
+        wheel.advance(Milliseconds{100000});
+        std::vector<size_t> expected(std::size(delays));
+        for(size_t i=0; i<expected.size(); ++i) expected[i] = i;
+        std::stable_sort(expected.begin(), expected.end(), [&delays](size_t L, size_t R) { return delays[L] < delays[R]; });
+        EGEG_CHECK(order == expected);
+    }
+
+    // 繰り返しタイマーは、1回で複数周期が経過すると周期の数だけ呼び出され、誤差が蓄積しない
+    void periodic() {
+        TimerWheel wheel;
+        uint32_t calls = 0U;
+        const TimerID id = wheel.schedule(Milliseconds{10}, [&calls] { ++calls; }, Milliseconds{10});
+
+        wheel.advance(Milliseconds{35});
+        EGEG_CHECK(calls == 3U);
+        EGEG_CHECK(wheel.remaining(id) == Time{Milliseconds{5}});
+        wheel.advance(Milliseconds{5});
+        EGEG_CHECK(calls == 4U);
+        wheel.advance(Milliseconds{1000});
+        EGEG_CHECK(calls == 104U);
+
+        // 分解能未満の経過時間も蓄積される
+        for(int i=0; i<3000; ++i) wheel.advance(Microseconds{1500});
+        EGEG_CHECK(calls == 104U + 450U);
+
+        // 周期が段をまたぐ場合
+        uint32_t long_calls = 0U;
+        wheel.schedule(Milliseconds{300}, [&long_calls] { ++long_calls; }, Milliseconds{300});
+        const int64_t steps[] = {1, 7, 13, 256, 999, 3};
+        int64_t total = 0;
+        for(int i=0; total < 300*1000; ++i) {
+            const int64_t step = std::min<int64_t>(steps[i % std::size(steps)], 300*1000 - total);
+            wheel.advance(Milliseconds{step});
+            total += step;
+        }
+        EGEG_CHECK(long_calls == 1000U);
+        EGEG_CHECK(wheel.cancel(id));
+        EGEG_CHECK(!wheel.isPending(id));
+        EGEG_CHECK(!wheel.cancel(id));
+    }
+
+    // 関数内からの取り消しと登録
+    void cancelInCallback() {
+        TimerWheel wheel;
+
+        // 自身の取り消し
+        uint32_t calls = 0U;
+        TimerID self{};
+        self = wheel.schedule(Milliseconds{1}, [&] { if(++calls == 3U) EGEG_CHECK(wheel.cancel(self)); }, Milliseconds{1});
+        wheel.advance(Milliseconds{10});
+        EGEG_CHECK(calls == 3U);
+        EGEG_CHECK(!wheel.isPending(self));
+        EGEG_CHECK(wheel.size() == 0U);
+
+        // 同じ advance で後に満了するタイマーの取り消しと、新しいタイマーの登録
+        bool cancelled_called = false;
+        bool added_called = false;
+        TimerID later{};
+        wheel.schedule(Milliseconds{5}, [&] {
+            EGEG_CHECK(wheel.cancel(later));
+            wheel.schedule(Milliseconds{2}, [&] { added_called = true; });
+        });
+        later = wheel.schedule(Milliseconds{5}, [&] { cancelled_called = true; });
+        wheel.advance(Milliseconds{10});
+        EGEG_CHECK(!cancelled_called);
+        EGEG_CHECK(added_called);
+        EGEG_CHECK(wheel.size() == 0U);
+
+        // 取り消したタイマーの識別子は、再利用されたノードを指さない
+        const TimerID reused = wheel.schedule(Milliseconds{1}, [] {});
+        EGEG_CHECK(!wheel.isPending(later));
+        EGEG_CHECK(!wheel.cancel(later));
+        EGEG_CHECK(wheel.isPending(reused));
+    }
+
+    // 関数が例外を送出した場合、そのタイマーは解放され、次の advance で残りのタイマーから再開する
+    void resumeAfterException() {
+        TimerWheel wheel;
+        std::vector<int> order;
+        const TimerID thrower = wheel.schedule(Milliseconds{5}, [&order] {
+            order.push_back(0);
+            throw std::runtime_error{"timer"};
+        }, Milliseconds{5});
+        wheel.schedule(Milliseconds{5}, [&order] { order.push_back(1); });
+        wheel.schedule(Milliseconds{8}, [&order] { order.push_back(2); });
+        wheel.schedule(Milliseconds{12}, [&order] { order.push_back(3); });
+
+        bool thrown = false;
+        try { wheel.advance(Milliseconds{10}); }
+        catch(const std::runtime_error&) { thrown = true; }
+        EGEG_CHECK(thrown);
+        EGEG_CHECK((order == std::vector<int>{0}));
+        EGEG_CHECK(!wheel.isPending(thrower));
+
+        // 経過時間は失われず、同じティックの残りと、中断した advance の範囲が処理される
+        wheel.advance(Time{});
+        EGEG_CHECK((order == std::vector<int>{0, 1, 2}));
+        wheel.advance(Milliseconds{2});
+        EGEG_CHECK((order == std::vector<int>{0, 1, 2, 3}));
+        EGEG_CHECK(wheel.size() == 0U);
+    }
+} // unnamed namespace
+
+
+/******************************************************************************
+
+    main
+
+******************************************************************************/
+int main() {
+    cascade();
+    firingOrder();
+    periodic();
+    cancelInCallback();
+    resumeAfterException();
+    return egeg_test::result("timer_wheel_test");
+}
+// EOF
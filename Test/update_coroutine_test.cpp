@@ -0,0 +1,123 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+#include "job_system.hpp"
+#include "update_manager.hpp"
+#include "test.hpp"
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace egeg_ns = easy_engine;
+namespace {
+    std::atomic<size_t> g_allocations{0U}; // グローバルの operator new の呼び出し回数
+    // エンジンの代わりに UpdateManager を管理する
+    struct TestAdmin {
+        static egeg_ns::t_lib::JobSystem& jobs() {
+            static egeg_ns::t_lib::JobSystem jobs{4U};
+            return jobs;
+        }
+        static auto create() { return egeg_ns::UpdateManager<TestAdmin>::create(); }
+        static void run(egeg_ns::UpdateManager<TestAdmin>& Manager) { Manager.run(egeg_ns::Time{}); }
+        static size_t size(const egeg_ns::UpdateManager<TestAdmin>& Manager) { return Manager.size(); }
+    };
+    using Manager = egeg_ns::UpdateManager<TestAdmin>;
+
+    // 指定したフレーム数だけ待機して完了する
+    egeg_ns::UpdateCoroutine waitFrames(const uint32_t Frames, uint32_t& Resumed) {
+        for(uint32_t i=0; i<Frames; ++i) {
+            co_await egeg_ns::nextFrame();
+            ++Resumed;
+        }
+    }
+
+    // 毎フレーム、登録されているタスク数を記録する
+    struct SizeRecorder {
+        void update(egeg_ns::Time) { sizes.push_back(TestAdmin::size(*manager)); }
+        void nop(egeg_ns::Time) {}
+        const Manager* manager;
+        std::vector<size_t> sizes;
+    };
+
+    // 完了したコルーチンは登録が解除され、呼び出し側の登録情報の破棄は何もしない
+    void unregisterOnDone(const bool Parallel) {
+        using namespace egeg_ns;
+        const auto manager = TestAdmin::create();
+        manager->setParallel(Parallel);
+        SizeRecorder recorder{manager.get(), {}};
+        uint32_t resumed = 0U;
+
+        UpdateTaskInfo recorder_task = manager->registerTask(&recorder, &SizeRecorder::update, 9U);
+        UpdateTaskInfo coroutine_task = manager->registerTask(waitFrames(3U, resumed), 0U);
+        for(uint32_t i=0; i<10U; ++i) TestAdmin::run(*manager);
+
+        // 解除されたスロットを再利用したタスクは、古い登録情報の破棄により解除されない
+        UpdateTaskInfo reused_task = manager->registerTask(&recorder, &SizeRecorder::nop, 0U);
+        coroutine_task.exitFromManager();
+        const size_t size_after_reuse = TestAdmin::size(*manager);
+        reused_task.exitFromManager();
+        recorder_task.exitFromManager();
+
+        EGEG_CHECK(resumed == 3U);
+        EGEG_CHECK(recorder.sizes.size() == 10U);
+        // 初回の tick(…) で最初の co_await まで進むため、4フレーム目に完了し、以降は数えられない
+        for(size_t i=0; i<recorder.sizes.size(); ++i)
+            EGEG_CHECK(recorder.sizes[i] == (i < 3U ? 2U : 1U));
+        EGEG_CHECK(size_after_reuse == 2U);
+    }
+
+    // 登録では、コルーチンフレーム以外の確保を行わない
+    void registerWithoutAllocation() {
+        using namespace egeg_ns;
+        const auto manager = TestAdmin::create();
+        uint32_t resumed = 0U;
+        { // 配列とフレームプールの領域を確保しておく
+            UpdateTaskInfo warm = manager->registerTask(waitFrames(1U, resumed), 0U);
+        }
+        const size_t before = g_allocations.load();
+        UpdateTaskInfo task = manager->registerTask(waitFrames(1U, resumed), 0U);
+        EGEG_CHECK(g_allocations.load() == before);
+        TestAdmin::run(*manager);
+        TestAdmin::run(*manager);
+        EGEG_CHECK(resumed == 1U);
+        EGEG_CHECK(TestAdmin::size(*manager) == 0U);
+    }
+} // unnamed namespace
+
+// 確保回数を数えるため、グローバルの operator new, delete を malloc, free で置き換える
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void* operator new(const size_t Size) {
+    ++g_allocations;
+    if(void* const ptr = std::malloc(Size ? Size : 1U)) return ptr;
+    throw std::bad_alloc{};
+}
+void operator delete(void* const Ptr) noexcept { std::free(Ptr); }
+void operator delete(void* const Ptr, size_t) noexcept { ::operator delete(Ptr); }
+
+
+/******************************************************************************
+
+    main
+
+******************************************************************************/
+int main() {
+    unregisterOnDone(false);
+    unregisterOnDone(true);
+    registerWithoutAllocation();
+    return egeg_test::result("update_coroutine_test");
+}
+// EOF
@@ -0,0 +1,124 @@
+// 作成者 : 板場
+/******************************************************************************
+
+    include
+
+******************************************************************************/
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "job_system.hpp"
+#include "update_manager.hpp"
+#include "test.hpp"
+
+
+/******************************************************************************
+
+    definition & declaration
+
+******************************************************************************/
+namespace egeg_ns = easy_engine;
+namespace {
+    // エンジンの代わりに UpdateManager を管理する
+    struct TestAdmin {
+        static egeg_ns::t_lib::JobSystem& jobs() {
+            static egeg_ns::t_lib::JobSystem jobs{2U};
+            return jobs;
+        }
+        static auto create() { return egeg_ns::UpdateManager<TestAdmin>::create(); }
+        static void run(egeg_ns::UpdateManager<TestAdmin>& Manager, const egeg_ns::Time Elapsed) { Manager.run(Elapsed); }
+    };
+
+    constexpr uint32_t kSimulation = 0U;                                // シミュレーションのタスクの優先度
+    constexpr uint32_t kSimulationEnd = egeg_ns::kRenderBegin - 1U;     // シミュレーションの最後
+    constexpr uint32_t kRender = egeg_ns::kRenderBegin;                 // 描画フェーズのタスクの優先度
+    constexpr uint32_t kRenderEnd = egeg_ns::kRenderEnd;
+
+    // 実行間隔を指定したタスク
+    struct IntervalCounter {
+        void update(egeg_ns::Time Elapsed) {
+            ++*calls;
+            elapsed.push_back(Elapsed);
+        }
+        uint32_t* calls;
+        std::vector<egeg_ns::Time> elapsed;
+    };
+
+    // 呼び出し毎(ステップ毎、フレーム毎)に、間隔を指定したタスクが呼び出された数を記録する
+    struct CallRecorder {
+        void update(egeg_ns::Time) { per_call.push_back(std::exchange(calls, 0U)); }
+        uint32_t calls = 0U;
+        std::vector<uint32_t> per_call;
+    };
+
+    // 固定タイムステップモードで、シミュレーションのタスクはステップ単位で分散される
+    //  1フレームのステップ数が変わっても、後から登録したタスクの位相がずれない
+    //  WithRender が true の場合、描画フェーズのタスクも登録する(フレーム単位で、シミュレーションとは別に分散される)
+    void fixedTimestep(const bool WithRender) {
+        using namespace egeg_ns;
+        const auto manager = TestAdmin::create();
+        manager->setFixedTimestep(Milliseconds{10}, 5U);
+
+        CallRecorder sim_recorder;
+        CallRecorder render_recorder;
+        UpdateTaskInfo sim_recorder_task = manager->registerTask(&sim_recorder, &CallRecorder::update, kSimulationEnd);
+        UpdateTaskInfo render_recorder_task = manager->registerTask(&render_recorder, &CallRecorder::update, kRenderEnd);
+
+        std::vector<std::unique_ptr<IntervalCounter>> sim_tasks;
+        std::vector<std::unique_ptr<IntervalCounter>> render_tasks;
+        std::vector<UpdateTaskInfo> infos;
+        auto add = [&](std::vector<std::unique_ptr<IntervalCounter>>& Tasks, uint32_t* Calls,
+                       const uint32_t Interval, const uint32_t Priority) {
+            Tasks.push_back(std::make_unique<IntervalCounter>(IntervalCounter{Calls, {}}));
+            infos.push_back(manager->registerTask(Tasks.back().get(), &IntervalCounter::update, UpdateInterval{Interval}, Priority));
+        };
+
+        // 1フレームのステップ数は 0 ~ 5(上限)で変化する
+        const Milliseconds deltas[] = {Milliseconds{25}, Milliseconds{15}, Milliseconds{7}, Milliseconds{38},
+                                       Milliseconds{100}, Milliseconds{3}, Milliseconds{12}};
+        size_t frame = 0U;
+        auto runFrames = [&](const size_t Frames) {
+            for(size_t i=0; i<Frames; ++i, ++frame) TestAdmin::run(*manager, Time{deltas[frame%std::size(deltas)]});
+        };
+
+        // 間隔4のタスクを2つずつ登録する 後の2つは空いている位相に割り当てられ、全てのステップで1つずつ呼び出される
+        for(uint32_t i=0; i<2U; ++i) add(sim_tasks, &sim_recorder.calls, 4U, kSimulation);
+        for(uint32_t i=0; WithRender && i<2U; ++i) add(render_tasks, &render_recorder.calls, 4U, kRender);
+        runFrames(9U);
+        const size_t first_steps = sim_recorder.per_call.size();
+        const size_t first_frames = render_recorder.per_call.size();
+        EGEG_CHECK((first_steps - frame) % 4U != 0U); // ステップ数とフレーム数の位相がずれた状態で追加する
+
+        for(uint32_t i=0; i<2U; ++i) add(sim_tasks, &sim_recorder.calls, 4U, kSimulation);
+        for(uint32_t i=0; WithRender && i<2U; ++i) add(render_tasks, &render_recorder.calls, 4U, kRender);
+        runFrames(40U);
+
+        for(size_t i=0; i<first_steps; ++i) EGEG_CHECK(sim_recorder.per_call[i] == ((i+1U)%4U < 2U ? 1U : 0U)); // 位相 0, 1
+        for(size_t i=first_steps; i<sim_recorder.per_call.size(); ++i) EGEG_CHECK(sim_recorder.per_call[i] == 1U);
+        // 描画フェーズのタスクはフレームを数える
+        for(size_t i=first_frames; i<render_recorder.per_call.size(); ++i)
+            EGEG_CHECK(render_recorder.per_call[i] == (WithRender ? 1U : 0U));
+
+        // 2回目以降の呼び出しには、間隔分の時間がまとめて渡される
+        for(const auto& task : sim_tasks) {
+            EGEG_CHECK(task->elapsed.size() >= 2U);
+            for(size_t i=1; i<task->elapsed.size(); ++i) EGEG_CHECK(task->elapsed[i] == Time{Milliseconds{40}});
+        }
+        for(const auto& task : render_tasks) EGEG_CHECK(task->elapsed.size() >= 10U);
+    }
+} // unnamed namespace
+
+
+/******************************************************************************
+
+    main
+
+******************************************************************************/
+int main() {
+    fixedTimestep(false);
+    fixedTimestep(true);
+    return egeg_test::result("update_interval_test");
+}
+// EOF